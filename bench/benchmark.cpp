@@ -0,0 +1,516 @@
+/*!
+ * \file benchmark.cpp
+ * \brief Benchmarks of manual::LinkedList and manual::DoublyLinkedList against the standard containers.
+ * \author Raphaël Lefèvre
+ *
+ * Self-contained (no dependency besides the standard library), build it from the root of the repository:
+ *
+ *     g++ -O2 -DNDEBUG -std=c++14 -I. bench/benchmark.cpp -o benchmark
+ *     ./benchmark --json > results.json
+ *
+ * Options:
+ * - `--json`: print the results as JSON (in the format of Google Benchmark, so that its `tools/compare.py` can diff two runs)
+ * - `--filter=<text>`: only run the benchmarks whose name contains `<text>` (e.g. `--filter=push_back/` or `--filter=/DoublyLinkedList/`)
+ * - `--min-size=<n>`, `--max-size=<n>`: the range of sizes (powers of 10, from 10 to 10M by default, both positive with `--min-size` <= `--max-size`)
+ * - `--min-time=<seconds>`: the minimal measured time of each benchmark (0.1 by default)
+ *
+ * Each benchmark reports the median time per item over its repetitions, an item being one call of the measured operation
+ * (one `push_back()`, one access through `operator[]`, one element visited or copied...).
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <forward_list>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "linkedlist.h"
+#include "doublylinkedlist.h"
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    /*!
+     * \brief Keep a value alive, so that the compiler does not optimize the measured code away.
+     */
+    volatile long long sink = 0;
+
+    /*!
+     * \brief The number of walking operations (positional access, middle insertion and removal) per repetition.
+     */
+    constexpr size_t walk_count = 1000;
+
+    /*!
+     * \class Timer
+     * \brief Accumulate the time of the measured part of a repetition (the setup is not measured).
+     */
+    class Timer final
+    {
+        private:
+            Clock::time_point start_;
+            double elapsed_ = 0; // nanoseconds
+
+        public:
+            void start()
+            {
+                start_ = Clock::now();
+            }
+            void stop()
+            {
+                elapsed_ += std::chrono::duration<double, std::nano>(Clock::now() - start_).count();
+            }
+            double elapsed() const
+            {
+                return elapsed_;
+            }
+    };
+
+    // Uniform access to the containers (the standard ones have no positional access)
+    template <typename C>
+    void fill(C & c, size_t n)
+    {
+        for(size_t i = 0; i < n; ++i)
+            c.push_back(int(i));
+    }
+    template <typename T>
+    void fill(std::forward_list<T> & c, size_t n)
+    {
+        for(size_t i = n; i > 0; --i)
+            c.push_front(int(i-1));
+    }
+
+    template <typename C>
+    int & at(C & c, size_t i)
+    {
+        return c[i];
+    }
+    template <typename T>
+    int & at(std::list<T> & c, size_t i)
+    {
+        return *std::next(c.begin(), i);
+    }
+    template <typename T>
+    int & at(std::forward_list<T> & c, size_t i)
+    {
+        return *std::next(c.begin(), i);
+    }
+
+    template <typename C>
+    void insert_at(C & c, size_t i, int v)
+    {
+        c.insert(i, v);
+    }
+    template <typename T>
+    void insert_at(std::list<T> & c, size_t i, int v)
+    {
+        c.insert(std::next(c.begin(), i), v);
+    }
+    template <typename T>
+    void insert_at(std::deque<T> & c, size_t i, int v)
+    {
+        c.insert(c.begin() + i, v);
+    }
+    template <typename T>
+    void insert_at(std::forward_list<T> & c, size_t i, int v)
+    {
+        c.insert_after(std::next(c.before_begin(), i), v);
+    }
+
+    template <typename C>
+    void remove_at(C & c, size_t i)
+    {
+        c.remove(i);
+    }
+    template <typename T>
+    void remove_at(std::list<T> & c, size_t i)
+    {
+        c.erase(std::next(c.begin(), i));
+    }
+    template <typename T>
+    void remove_at(std::deque<T> & c, size_t i)
+    {
+        c.erase(c.begin() + i);
+    }
+    template <typename T>
+    void remove_at(std::forward_list<T> & c, size_t i)
+    {
+        c.erase_after(std::next(c.before_begin(), i));
+    }
+
+    /*!
+     * \struct Result
+     * \brief The measures of one benchmark.
+     */
+    struct Result final
+    {
+        std::string name;
+        std::string operation;
+        std::string container;
+        size_t size;
+        size_t repetitions;
+        size_t items;       // per repetition
+        double ns_per_item; // median over the repetitions
+    };
+
+    /*!
+     * \struct Options
+     * \brief The command line options.
+     */
+    struct Options final
+    {
+        bool json = false;
+        std::string filter;
+        size_t min_size = 10;
+        size_t max_size = 10000000;
+        double min_time = 0.1;
+    };
+
+    /*!
+     * \brief A measured operation: prepares `batch` containers of size `n`, measures the operation on all of them and returns the number of items.
+     */
+    typedef std::function<size_t(size_t n, size_t batch, Timer & timer)> Body;
+
+    /*!
+     * \brief Get the number of containers measured together (many small containers, so that the timer overhead stays negligible).
+     */
+    size_t batch_size(size_t n)
+    {
+        return std::max<size_t>(1, (1 << 14) / n);
+    }
+
+    /*!
+     * \brief Run one benchmark: repeat the operation until the measured time reaches `min_time`.
+     */
+    Result measure(const std::string & operation, const std::string & container, size_t n, const Body & body, const Options & options)
+    {
+        std::vector<double> samples;
+        double total = 0;
+        size_t items = 0;
+        while((total < options.min_time * 1e9 || samples.size() < 3) && samples.size() < 1000)
+        {
+            Timer timer;
+            items = body(n, batch_size(n), timer);
+            samples.push_back(timer.elapsed() / double(items));
+            total += timer.elapsed();
+            if(total >= options.min_time * 1e9 * 10) // a single repetition is long enough (huge sizes)
+                break;
+        }
+        std::sort(samples.begin(), samples.end());
+        return Result{operation + "/" + container + "/" + std::to_string(n), operation, container, n, samples.size(), items, samples[samples.size() / 2]};
+    }
+
+    /*!
+     * \class Suite
+     * \brief The benchmarks of one container type.
+     */
+    template <typename C>
+    class Suite final
+    {
+        private:
+            static std::vector<C> make(size_t n, size_t batch)
+            {
+                std::vector<C> res(batch);
+                for(C & c : res)
+                    fill(c, n);
+                return res;
+            }
+
+        public:
+            static size_t push_back(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs(batch);
+                timer.start();
+                for(C & c : cs)
+                    fill(c, n);
+                timer.stop();
+                return n * batch;
+            }
+            static size_t push_front(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs(batch);
+                timer.start();
+                for(C & c : cs)
+                {
+                    for(size_t i = 0; i < n; ++i)
+                        c.push_front(int(i));
+                }
+                timer.stop();
+                return n * batch;
+            }
+            static size_t pop_back(size_t n, size_t batch, Timer & timer)
+            {
+                size_t count = std::min(n, walk_count); // LinkedList::pop_back walks the list
+                std::vector<C> cs = make(n, batch);
+                timer.start();
+                for(C & c : cs)
+                {
+                    for(size_t i = 0; i < count; ++i)
+                        c.pop_back();
+                }
+                timer.stop();
+                return count * batch;
+            }
+            static size_t pop_front(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs = make(n, batch);
+                timer.start();
+                for(C & c : cs)
+                {
+                    for(size_t i = 0; i < n; ++i)
+                        c.pop_front();
+                }
+                timer.stop();
+                return n * batch;
+            }
+            static size_t index(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs = make(n, batch);
+                size_t count = std::min(n, walk_count);
+                long long sum = 0;
+                timer.start();
+                for(C & c : cs)
+                {
+                    size_t i = 0;
+                    for(size_t k = 0; k < count; ++k)
+                    {
+                        i = (i * 1103515245 + 12345) % n; // spread the positions over the container
+                        sum += at(c, i);
+                    }
+                }
+                timer.stop();
+                sink = sum;
+                return count * batch;
+            }
+            static size_t insert_middle(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs = make(n, batch);
+                size_t count = std::min(n, walk_count);
+                timer.start();
+                for(C & c : cs)
+                {
+                    for(size_t k = 0; k < count; ++k)
+                        insert_at(c, (n + k) / 2, int(k));
+                }
+                timer.stop();
+                return count * batch;
+            }
+            static size_t remove_middle(size_t n, size_t batch, Timer & timer)
+            {
+                size_t count = std::min(n, walk_count);
+                std::vector<C> cs = make(n + count, batch);
+                timer.start();
+                for(C & c : cs)
+                {
+                    for(size_t k = count; k > 0; --k)
+                        remove_at(c, (n + k) / 2);
+                }
+                timer.stop();
+                return count * batch;
+            }
+            static size_t iterate(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs = make(n, batch);
+                long long sum = 0;
+                timer.start();
+                for(C & c : cs)
+                {
+                    for(int v : c)
+                        sum += v;
+                }
+                timer.stop();
+                sink = sum;
+                return n * batch;
+            }
+            static size_t copy(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs = make(n, batch);
+                std::vector<std::unique_ptr<C>> copies(batch);
+                timer.start();
+                for(size_t i = 0; i < batch; ++i)
+                    copies[i].reset(new C(cs[i]));
+                timer.stop();
+                return n * batch;
+            }
+            static size_t clear(size_t n, size_t batch, Timer & timer)
+            {
+                std::vector<C> cs = make(n, batch);
+                timer.start();
+                for(C & c : cs)
+                    c.clear();
+                timer.stop();
+                return n * batch;
+            }
+    };
+
+    typedef std::vector<std::tuple<std::string, std::string, Body>> Benchmarks; /*!< The list of (operation, container, body) */
+
+    /*!
+     * \brief Register the benchmarks of a container.
+     * \param[in,out] benchmarks The list of benchmarks to fill
+     * \param[in] container The name of the container
+     */
+    template <typename C>
+    void add(Benchmarks & benchmarks, const std::string & container)
+    {
+        benchmarks.emplace_back("push_front", container, &Suite<C>::push_front);
+        benchmarks.emplace_back("pop_front", container, &Suite<C>::pop_front);
+        benchmarks.emplace_back("index", container, &Suite<C>::index);
+        benchmarks.emplace_back("insert_middle", container, &Suite<C>::insert_middle);
+        benchmarks.emplace_back("remove_middle", container, &Suite<C>::remove_middle);
+        benchmarks.emplace_back("iterate", container, &Suite<C>::iterate);
+        benchmarks.emplace_back("copy", container, &Suite<C>::copy);
+        benchmarks.emplace_back("clear", container, &Suite<C>::clear);
+    }
+    /*!
+     * \brief Register the benchmarks of a container having `push_back()` and `pop_back()`.
+     * \param[in,out] benchmarks The list of benchmarks to fill
+     * \param[in] container The name of the container
+     */
+    template <typename C>
+    void add_with_back(Benchmarks & benchmarks, const std::string & container)
+    {
+        benchmarks.emplace_back("push_back", container, &Suite<C>::push_back);
+        benchmarks.emplace_back("pop_back", container, &Suite<C>::pop_back);
+        add<C>(benchmarks, container);
+    }
+
+    /*!
+     * \brief Escape a string for JSON.
+     */
+    std::string escape(const std::string & text)
+    {
+        std::string res;
+        for(char c : text)
+        {
+            if(c == '"' || c == '\\')
+                res += '\\';
+            res += c;
+        }
+        return res;
+    }
+
+    void print_json(const std::vector<Result> & results, const Options & options)
+    {
+        std::printf("{\n  \"context\": {\n");
+        std::printf("    \"library\": \"manual\",\n");
+#if defined(__VERSION__)
+        std::printf("    \"compiler\": \"%s\",\n", escape(__VERSION__).c_str());
+#endif
+#ifdef NDEBUG
+        std::printf("    \"library_build_type\": \"release\",\n");
+#else
+        std::printf("    \"library_build_type\": \"debug\",\n");
+#endif
+        std::printf("    \"cplusplus\": %ld,\n", static_cast<long>(__cplusplus));
+        std::printf("    \"min_time\": %g\n  },\n  \"benchmarks\": [\n", options.min_time);
+        for(size_t i = 0; i < results.size(); ++i)
+        {
+            const Result & r = results[i];
+            std::printf("    {\n      \"name\": \"%s\",\n      \"run_name\": \"%s\",\n      \"run_type\": \"iteration\",\n", r.name.c_str(), r.name.c_str());
+            std::printf("      \"operation\": \"%s\",\n      \"container\": \"%s\",\n      \"size\": %zu,\n", r.operation.c_str(), r.container.c_str(), r.size);
+            std::printf("      \"repetitions\": %zu,\n      \"iterations\": %zu,\n", r.repetitions, r.items);
+            std::printf("      \"real_time\": %.4f,\n      \"cpu_time\": %.4f,\n      \"time_unit\": \"ns\",\n", r.ns_per_item, r.ns_per_item);
+            std::printf("      \"items_per_second\": %.1f\n    }%s\n", 1e9 / r.ns_per_item, i + 1 < results.size() ? "," : "");
+        }
+        std::printf("  ]\n}\n");
+    }
+
+    void print_table(const Result & r)
+    {
+        std::printf("%-44s %12.2f ns/item %8zu reps\n", r.name.c_str(), r.ns_per_item, r.repetitions);
+        std::fflush(stdout);
+    }
+
+    bool parse_size(const char * text, size_t & size)
+    {
+        char * end = nullptr;
+        errno = 0;
+        const unsigned long long value = std::strtoull(text, &end, 10);
+        if(*text < '0' || *text > '9' || *end || errno || !value || value > std::numeric_limits<size_t>::max())
+            return false;
+        size = static_cast<size_t>(value);
+        return true;
+    }
+
+    bool parse_time(const char * text, double & time)
+    {
+        char * end = nullptr;
+        errno = 0;
+        const double value = std::strtod(text, &end);
+        if(end == text || *end || errno || !(value > 0) || !std::isfinite(value))
+            return false;
+        time = value;
+        return true;
+    }
+
+    bool parse(int argc, char ** argv, Options & options)
+    {
+        bool valid = true;
+        for(int i = 1; valid && i < argc; ++i)
+        {
+            const char * arg = argv[i];
+            if(!std::strcmp(arg, "--json"))
+                options.json = true;
+            else if(!std::strncmp(arg, "--filter=", 9))
+                options.filter = arg + 9;
+            else if(!std::strncmp(arg, "--min-size=", 11))
+                valid = parse_size(arg + 11, options.min_size);
+            else if(!std::strncmp(arg, "--max-size=", 11))
+                valid = parse_size(arg + 11, options.max_size);
+            else if(!std::strncmp(arg, "--min-time=", 11))
+                valid = parse_time(arg + 11, options.min_time);
+            else
+                valid = false;
+        }
+        if(valid && options.min_size <= options.max_size)
+            return true;
+        std::fprintf(stderr, "usage: %s [--json] [--filter=<text>] [--min-size=<n>] [--max-size=<n>] [--min-time=<seconds>]\n", argv[0]);
+        std::fprintf(stderr, "       the sizes must be positive integers with min-size <= max-size, the time a positive number of seconds\n");
+        return false;
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    Options options;
+    if(!parse(argc, argv, options))
+        return 1;
+
+    Benchmarks benchmarks;
+    add_with_back<manual::LinkedList<int>>(benchmarks, "LinkedList");
+    add<std::forward_list<int>>(benchmarks, "std::forward_list");
+    add_with_back<manual::DoublyLinkedList<int>>(benchmarks, "DoublyLinkedList");
+    add_with_back<std::list<int>>(benchmarks, "std::list");
+    add_with_back<std::deque<int>>(benchmarks, "std::deque");
+
+    std::vector<Result> results;
+    for(size_t n = options.min_size; ; n *= 10)
+    {
+        for(const auto & benchmark : benchmarks)
+        {
+            std::string name = std::get<0>(benchmark) + "/" + std::get<1>(benchmark) + "/" + std::to_string(n);
+            if(name.find(options.filter) == std::string::npos)
+                continue;
+            results.push_back(measure(std::get<0>(benchmark), std::get<1>(benchmark), n, std::get<2>(benchmark), options));
+            if(!options.json)
+                print_table(results.back());
+        }
+        if(n > options.max_size / 10)
+            break;
+    }
+    if(options.json)
+        print_json(results, options);
+    return 0;
+}
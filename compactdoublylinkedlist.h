@@ -0,0 +1,2650 @@
+#ifndef MANUAL_COMPACTDOUBLYLINKEDLIST_H
+#define MANUAL_COMPACTDOUBLYLINKEDLIST_H
+
+/*!
+ * \file compactdoublylinkedlist.h
+ * \brief A doubly linked list with 32-bit links into a contiguous buffer of nodes (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#include <memory_resource>
+#define MANUAL_HAS_PMR
+#endif
+#endif
+
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(no_unique_address)
+#define MANUAL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+#endif
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#define MANUAL_NO_UNIQUE_ADDRESS
+#endif
+#endif
+
+namespace manual
+{
+    /*!
+     * \class CompactDoublyLinkedList
+     * \brief A doubly linked list whose nodes live in one contiguous buffer and are linked by 32-bit indexes.
+     *
+     * A node is two `uint32_t` links and the value (e.g. 12 bytes for an `int`, instead of 24 bytes for a DoublyLinkedList node),
+     * and all the nodes share one allocation: the traversal stays within a contiguous block of memory.<br/>
+     * The removed nodes are kept in a free list and reused by the next insertions; the buffer grows geometrically when it is full.
+     *
+     * The public interface is the one of DoublyLinkedList, except the operations moving nodes between two lists (splice, merge, split),
+     * which would have to copy the values from one buffer to the other.
+     *
+     * \note The iterators refer to the nodes by index: they remain valid when the buffer grows.
+     * \warning The references and pointers to the values are invalidated when the buffer grows (use reserve() to prevent it).
+     * \warning The container holds at most `2^32 - 2` elements.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class CompactDoublyLinkedList
+    {
+        protected:
+            /*!
+             * \struct Slot
+             * \brief Internal representation of a node (or of a free slot of the buffer).
+             */
+            struct Slot final
+            {
+                uint32_t next;                               /*!< Index of the next node (of the next free slot for a free slot) */
+                uint32_t previous;                           /*!< Index of the previous node */
+                alignas(T) unsigned char storage[sizeof(T)]; /*!< The storage of the value */
+
+                /*!
+                 * \brief Get the value of the node.
+                 * \return The address of the value
+                 */
+                T * value()
+                {
+                    return reinterpret_cast<T*>(storage);
+                }
+            };
+
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Slot> SlotAllocator; /*!< The allocator rebound to the slot type */
+            typedef std::allocator_traits<SlotAllocator> SlotAllocatorTraits;                             /*!< The slot allocator traits */
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<T> ValueAllocator;   /*!< The allocator rebound to the value type */
+            typedef std::allocator_traits<ValueAllocator> ValueAllocatorTraits;                           /*!< The value allocator traits */
+
+            /*!
+             * \brief Enable a function template only for the input iterators (so that it is not picked for two integers).
+             */
+            template <typename InputIt>
+            using RequireInputIterator = typename std::enable_if<std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type;
+
+            static constexpr uint32_t npos = 0xFFFFFFFF; /*!< The null link */
+
+            // data members
+            Slot * slots_;                                     /*!< The buffer of nodes */
+            uint32_t capacity_;                                /*!< The number of slots of the buffer */
+            uint32_t used_;                                    /*!< The number of slots ever used since the last clear (the others are uninitialized) */
+            uint32_t free_;                                    /*!< Index of the first free slot (`npos` if none) */
+            uint32_t head_;                                    /*!< Index of the head (`npos` if empty) */
+            uint32_t tail_;                                    /*!< Index of the tail (`npos` if empty) */
+            uint32_t size_;                                    /*!< The size */
+            MANUAL_NO_UNIQUE_ADDRESS SlotAllocator allocator_; /*!< The slot allocator */
+
+            // Node management
+            /*!
+             * \brief Construct a value in a slot.
+             * \param[in,out] buffer The buffer holding the slot
+             * \param[in] index The index of the slot
+             * \param[in] args The arguments to construct the value from
+             */
+            template <typename... Args>
+            void construct_value(Slot * buffer, uint32_t index, Args &&... args)
+            {
+                ValueAllocator alloc(allocator_);
+                ValueAllocatorTraits::construct(alloc, buffer[index].value(), std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Destroy a value (the slot is kept).
+             * \param[in,out] buffer The buffer holding the slot
+             * \param[in] index The index of the slot
+             */
+            void destroy_value(Slot * buffer, uint32_t index)
+            {
+                ValueAllocator alloc(allocator_);
+                ValueAllocatorTraits::destroy(alloc, buffer[index].value());
+            }
+            /*!
+             * \brief Move the nodes to another buffer, at the same indexes.
+             * \param[in,out] buffer The new buffer (at least `used_` slots)
+             * \param[in] capacity The number of slots of \p buffer
+             *
+             * The old buffer is deallocated and replaced by \p buffer.
+             * \note Strong guarantee: if a value throws while being moved (or copied, if its move constructor may throw), the new values are destroyed and the container is left unchanged.
+             */
+            void relocate_to(Slot * buffer, uint32_t capacity)
+            {
+                uint32_t current = head_;
+                try
+                {
+                    for(; current != npos; current = slots_[current].next)
+                        construct_value(buffer, current, std::move_if_noexcept(*slots_[current].value()));
+                }
+                catch(...)
+                {
+                    for(uint32_t done = head_; done != current; done = slots_[done].next)
+                        destroy_value(buffer, done);
+                    throw;
+                }
+
+                for(uint32_t i = 0; i < used_; ++i)
+                {
+                    buffer[i].next = slots_[i].next;
+                    buffer[i].previous = slots_[i].previous;
+                }
+                for(current = head_; current != npos; current = slots_[current].next)
+                    destroy_value(slots_, current);
+                if(slots_)
+                    SlotAllocatorTraits::deallocate(allocator_, slots_, capacity_);
+                slots_ = buffer;
+                capacity_ = capacity;
+            }
+            /*!
+             * \brief Get the capacity to grow a full buffer to.
+             * \return The next capacity
+             *
+             * \throws std::length_error If the buffer cannot grow anymore.
+             */
+            uint32_t next_capacity() const
+            {
+                if(capacity_ == npos - 1)
+                    throw std::length_error(std::string("[Length error] - manual::CompactDoublyLinkedList - (max_size: ") + std::to_string(max_size()) + ").");
+                if(!capacity_)
+                    return 8;
+                return capacity_ > (npos - 1) / 2 ? npos - 1 : 2 * capacity_;
+            }
+            /*!
+             * \brief Construct a value in a free slot.
+             * \param[in] args The arguments to construct the value from
+             * \return The index of the new node (not linked)
+             *
+             * \note When the buffer is full, the value is constructed in the new buffer before the nodes are moved, so that \p args may refer to an element.
+             */
+            template <typename... Args>
+            uint32_t create_node(Args &&... args)
+            {
+                if(free_ != npos)
+                {
+                    uint32_t index = free_;
+                    construct_value(slots_, index, std::forward<Args>(args)...);
+                    free_ = slots_[index].next;
+                    return index;
+                }
+                if(used_ < capacity_)
+                {
+                    construct_value(slots_, used_, std::forward<Args>(args)...);
+                    return used_++;
+                }
+
+                uint32_t capacity = next_capacity();
+                Slot * buffer = SlotAllocatorTraits::allocate(allocator_, capacity);
+                try
+                {
+                    construct_value(buffer, used_, std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    SlotAllocatorTraits::deallocate(allocator_, buffer, capacity);
+                    throw;
+                }
+                try
+                {
+                    relocate_to(buffer, capacity);
+                }
+                catch(...)
+                {
+                    destroy_value(buffer, used_);
+                    SlotAllocatorTraits::deallocate(allocator_, buffer, capacity);
+                    throw;
+                }
+                return used_++;
+            }
+            /*!
+             * \brief Destroy a node and give its slot back to the free list.
+             * \param[in] index The index of the node (already unlinked)
+             */
+            void destroy_node(uint32_t index)
+            {
+                destroy_value(slots_, index);
+                slots_[index].next = free_;
+                free_ = index;
+            }
+            /*!
+             * \brief Link a node before a given node.
+             * \param[in] pos The node before which to insert (`npos` to append)
+             * \param[in] index The node to insert (not linked)
+             * \return \p index
+             */
+            uint32_t link_before(uint32_t pos, uint32_t index)
+            {
+                uint32_t previous = (pos == npos) ? tail_ : slots_[pos].previous;
+                slots_[index].previous = previous;
+                slots_[index].next = pos;
+                if(previous != npos)
+                    slots_[previous].next = index;
+                else
+                    head_ = index;
+                if(pos != npos)
+                    slots_[pos].previous = index;
+                else
+                    tail_ = index;
+                ++size_;
+                return index;
+            }
+            /*!
+             * \brief Unlink and destroy a node.
+             * \param[in] index The node to remove
+             * \return The index of the node following the removed one (`npos` if none)
+             */
+            uint32_t erase_node(uint32_t index)
+            {
+                uint32_t next = slots_[index].next;
+                uint32_t previous = slots_[index].previous;
+                if(previous != npos)
+                    slots_[previous].next = next;
+                else
+                    head_ = next;
+                if(next != npos)
+                    slots_[next].previous = previous;
+                else
+                    tail_ = previous;
+                destroy_node(index);
+                --size_;
+                return next;
+            }
+            /*!
+             * \brief Grow the buffer for the values of a range (the size of the range is known).
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the last one of the range
+             */
+            template <typename ForwardIt>
+            void reserve_range(ForwardIt first, ForwardIt last, std::true_type)
+            {
+                reserve(size_ + static_cast<size_t>(std::distance(first, last)));
+            }
+            /*!
+             * \brief Do nothing (the size of the range is unknown, the buffer grows geometrically instead).
+             */
+            template <typename InputIt>
+            void reserve_range(InputIt, InputIt, std::false_type)
+            {}
+            /*!
+             * \brief Find the node at the given index.
+             * \param[in] index The position of the node (must be lower than `size_`)
+             * \return The index of the slot of the node
+             *
+             * \note Walks from the closest end.
+             */
+            uint32_t node_at(size_t index) const
+            {
+                uint32_t current;
+                if(index > size_ / 2)
+                {
+                    current = tail_;
+                    for(size_t i = size_ - 1; i > index; --i)
+                        current = slots_[current].previous;
+                }
+                else
+                {
+                    current = head_;
+                    for(size_t i = 0; i < index; ++i)
+                        current = slots_[current].next;
+                }
+                return current;
+            }
+            /*!
+             * \brief Destroy all the values and deallocate the buffer.
+             */
+            void release()
+            {
+                clear();
+                if(slots_)
+                    SlotAllocatorTraits::deallocate(allocator_, slots_, capacity_);
+                slots_ = nullptr;
+                capacity_ = 0;
+            }
+            /*!
+             * \brief Copy the allocator of \p other (it follows the copied content).
+             * \param[in] other The CompactDoublyLinkedList being copied
+             *
+             * \warning The container must be empty.
+             */
+            void copy_allocator(const CompactDoublyLinkedList<T, Allocator> & other, std::true_type)
+            {
+                if(allocator_ != other.allocator_)
+                    release();
+                allocator_ = other.allocator_;
+            }
+            /*!
+             * \brief Keep the current allocator (it does not follow the copied content).
+             */
+            void copy_allocator(const CompactDoublyLinkedList<T, Allocator> &, std::false_type)
+            {}
+            /*!
+             * \brief Steal the buffer of \p other.
+             * \param[in,out] other The CompactDoublyLinkedList to move from (left empty, without buffer)
+             *
+             * \warning The container must be empty, without buffer.
+             */
+            void steal(CompactDoublyLinkedList<T, Allocator> & other) noexcept
+            {
+                slots_ = std::exchange(other.slots_, nullptr);
+                capacity_ = std::exchange(other.capacity_, 0);
+                used_ = std::exchange(other.used_, 0);
+                free_ = std::exchange(other.free_, npos);
+                head_ = std::exchange(other.head_, npos);
+                tail_ = std::exchange(other.tail_, npos);
+                size_ = std::exchange(other.size_, 0);
+            }
+            /*!
+             * \brief Steal the content of \p other (the allocator follows the moved content).
+             * \param[in,out] other The CompactDoublyLinkedList to move from
+             */
+            void move_from(CompactDoublyLinkedList<T, Allocator> & other, std::true_type) noexcept
+            {
+                release();
+                allocator_ = std::move(other.allocator_);
+                steal(other);
+            }
+            /*!
+             * \brief Steal the content of \p other if the allocators are equal, move the values one by one otherwise.
+             * \param[in,out] other The CompactDoublyLinkedList to move from
+             */
+            void move_from(CompactDoublyLinkedList<T, Allocator> & other, std::false_type)
+            {
+                if(allocator_ == other.allocator_)
+                {
+                    release();
+                    steal(other);
+                }
+                else
+                {
+                    clear();
+                    reserve(other.size_);
+                    for(uint32_t current = other.head_; current != npos; current = other.slots_[current].next)
+                        emplace_back(std::move(*other.slots_[current].value()));
+                    other.clear();
+                }
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list (no buffer is allocated).
+             */
+            CompactDoublyLinkedList() : CompactDoublyLinkedList(Allocator())
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the buffer from
+             *
+             * Creates an empty list (no buffer is allocated).
+             */
+            explicit CompactDoublyLinkedList(const Allocator & alloc) : slots_(nullptr), capacity_(0), used_(0), free_(npos), head_(npos), tail_(npos), size_(0), allocator_(alloc)
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The CompactDoublyLinkedList to copy
+             *
+             * \note The copy is compact: its nodes are laid out in traversal order in a buffer of the exact size.
+             */
+            CompactDoublyLinkedList(const CompactDoublyLinkedList<T, Allocator> & other) : CompactDoublyLinkedList(SlotAllocatorTraits::select_on_container_copy_construction(other.allocator_))
+            {
+                reserve(other.size_);
+                for(uint32_t current = other.head_; current != npos; current = other.slots_[current].next)
+                    emplace_back(*other.slots_[current].value());
+            }
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The CompactDoublyLinkedList to move from
+             *
+             * \note The moved CompactDoublyLinkedList will be left empty but still valid.
+             */
+            CompactDoublyLinkedList(CompactDoublyLinkedList<T, Allocator> && other) noexcept : CompactDoublyLinkedList(Allocator(std::move(other.allocator_)))
+            {
+                steal(other);
+            }
+            /*!
+             * \brief Initialization constructor.
+             * \param[in] init_list An initializer list to copy
+             * \param[in] alloc The allocator to get the buffer from
+             */
+            CompactDoublyLinkedList(const std::initializer_list<T> & init_list, const Allocator & alloc = Allocator()) : CompactDoublyLinkedList(init_list.begin(), init_list.end(), alloc)
+            {}
+            /*!
+             * \brief Range constructor.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             * \param[in] alloc The allocator to get the buffer from
+             *
+             * \note When the size of the range is known (forward iterators), the buffer is allocated once with the exact size.
+             */
+            template <typename InputIt, typename = RequireInputIterator<InputIt>>
+            CompactDoublyLinkedList(InputIt first, InputIt last, const Allocator & alloc = Allocator()) : CompactDoublyLinkedList(alloc)
+            {
+                reserve_range(first, last, std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::forward_iterator_tag>());
+                for(; first != last; ++first)
+                    emplace_back(*first);
+            }
+            ~CompactDoublyLinkedList()
+            {
+                release();
+            }
+
+            /*!
+             * \brief Get the allocator.
+             * \return A copy of the allocator the buffer is obtained from
+             */
+            Allocator get_allocator() const
+            {
+                return Allocator(allocator_);
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const
+            {
+                return size_;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the list is empty, `false` otherwise
+             */
+            bool empty() const
+            {
+                return !size_;
+            }
+            /*!
+             * \brief Get the maximal size of the container.
+             * \return The maximal size (`2^32 - 2`, the last index is the null link)
+             */
+            size_t max_size() const
+            {
+                return npos - 1;
+            }
+            /*!
+             * \brief Get the number of nodes the buffer can hold.
+             * \return The capacity
+             */
+            size_t capacity() const
+            {
+                return capacity_;
+            }
+            /*!
+             * \brief Grow the buffer to hold at least a given number of nodes.
+             * \param[in] capacity The number of nodes to make room for
+             *
+             * \throws std::length_error If \p capacity exceeds max_size().
+             * \note Invalidates the references to the values (not the iterators) if the buffer grows.
+             */
+            void reserve(size_t capacity)
+            {
+                if(capacity <= capacity_)
+                    return;
+                if(capacity > max_size())
+                    throw std::length_error(std::string("[Length error] - manual::CompactDoublyLinkedList::reserve() - (capacity: ") + std::to_string(capacity) + ", max_size: " + std::to_string(max_size()) + ").");
+
+                Slot * buffer = SlotAllocatorTraits::allocate(allocator_, capacity);
+                try
+                {
+                    relocate_to(buffer, static_cast<uint32_t>(capacity));
+                }
+                catch(...)
+                {
+                    SlotAllocatorTraits::deallocate(allocator_, buffer, capacity);
+                    throw;
+                }
+            }
+            /*!
+             * \brief Move the nodes to a buffer of the exact size, in traversal order.
+             *
+             * The free slots are dropped and the traversal becomes a linear scan of the buffer.
+             * \warning Invalidates all the iterators and references.
+             */
+            void shrink_to_fit()
+            {
+                if(size_ == capacity_ && used_ == size_)
+                {
+                    bool ordered = true;
+                    for(uint32_t current = head_, i = 0; current != npos && ordered; current = slots_[current].next, ++i)
+                        ordered = (current == i);
+                    if(ordered)
+                        return;
+                }
+
+                CompactDoublyLinkedList<T, Allocator> tmp(get_allocator());
+                tmp.reserve(size_);
+                for(uint32_t current = head_; current != npos; current = slots_[current].next)
+                    tmp.emplace_back(std::move_if_noexcept(*slots_[current].value()));
+                release();
+                steal(tmp);
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the first element.
+             * \return A direct reference to the head value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & front()
+            {
+                return *slots_[head_].value();
+            }
+            /*!
+             * \brief Get the first element.
+             * \return A direct `const` reference to the head value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return *slots_[head_].value();
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct reference to the tail value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & back()
+            {
+                return *slots_[tail_].value();
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct `const` reference to the tail value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & back() const
+            {
+                return *slots_[tail_].value();
+            }
+            /*!
+             * \brief Access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A `const` reference to the element value at the given index
+             *
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
+             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             */
+            const T & operator[](size_t index) const
+            {
+                return *slots_[node_at(index)].value();
+            }
+            /*!
+             * \brief Access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A reference to the element value at the given index
+             *
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
+             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             */
+            T & operator[](size_t index)
+            {
+                return const_cast<T&>(const_cast<const CompactDoublyLinkedList<T, Allocator> &>(*this)[index]);
+            }
+            /*!
+             * \brief Safely access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A `const` reference to the element value at the given index
+             *
+             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
+             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             */
+            const T & at(size_t index) const
+            {
+                if(index >= size_)
+                    throw std::out_of_range(std::string("[Out of range error] - manual::CompactDoublyLinkedList::at() - (index: ") + std::to_string(index) + ", size: " + std::to_string(size_) + ").");
+
+                return (*this)[index];
+            }
+            /*!
+             * \brief Safely access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A reference to the element value at the given index
+             *
+             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
+             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             */
+            T & at(size_t index)
+            {
+                return const_cast<T&>(const_cast<const CompactDoublyLinkedList<T, Allocator> &>(*this).at(index));
+            }
+
+            // Modifiers
+            /*!
+             * \brief Clear the container.
+             *
+             * \note The buffer is kept for the next insertions (see shrink_to_fit()).
+             */
+            void clear()
+            {
+                for(uint32_t current = head_; current != npos; current = slots_[current].next)
+                    destroy_value(slots_, current);
+                used_ = 0;
+                free_ = npos;
+                head_ = npos;
+                tail_ = npos;
+                size_ = 0;
+            }
+            /*!
+             * \brief Replace the contents with the values of a range.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             *
+             * \note The values are copied into a new buffer before the old one is released: the contents are unchanged if an exception is thrown
+             * (and the range can be part of the container).
+             */
+            template <typename InputIt, typename = RequireInputIterator<InputIt>>
+            void assign(InputIt first, InputIt last)
+            {
+                CompactDoublyLinkedList<T, Allocator> tmp(first, last, get_allocator());
+                release();
+                steal(tmp);
+            }
+            /*!
+             * \brief Replace the contents with copies of a value.
+             * \param[in] count The new size
+             * \param[in] val The value to copy (can be an element of the container)
+             *
+             * \throws std::length_error If \p count exceeds max_size().
+             * \note The contents are unchanged if an exception is thrown.
+             */
+            void assign(size_t count, const T & val)
+            {
+                CompactDoublyLinkedList<T, Allocator> tmp(get_allocator());
+                tmp.reserve(count);
+                for(size_t i = 0; i < count; ++i)
+                    tmp.emplace_back(val);
+                release();
+                steal(tmp);
+            }
+            /*!
+             * \brief Replace the contents with the values of an initializer list.
+             * \param[in] init_list The initializer list to copy
+             */
+            void assign(const std::initializer_list<T> & init_list)
+            {
+                assign(init_list.begin(), init_list.end());
+            }
+            /*!
+             * \brief Add a value at the end of the container.
+             * \param[in] val The value to append
+             */
+            void push_back(const T & val)
+            {
+                emplace_back(val);
+            }
+            /*!
+             * \brief Add a value at the end of the container.
+             * \param[in,out] val The value to append (moved)
+             */
+            void push_back(T && val)
+            {
+                emplace_back(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the end of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_back(Args &&... args)
+            {
+                uint32_t index = create_node(std::forward<Args>(args)...); // may move the buffer
+                return *slots_[link_before(npos, index)].value();
+            }
+            /*!
+             * \brief Add the values of a range at the end of the container.
+             * \param[in] range The values to append (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             *
+             * \warning The range must not be part of the container (Undefined Behaviour).
+             * \note The contents are unchanged if an exception is thrown (except for the capacity).
+             */
+            template <typename Range>
+            void append_range(Range && range)
+            {
+                insert_range(cend(), std::forward<Range>(range));
+            }
+            /*!
+             * \brief Add a value at the beginning of the container.
+             * \param[in] val The value to prepend
+             */
+            void push_front(const T & val)
+            {
+                emplace_front(val);
+            }
+            /*!
+             * \brief Add a value at the beginning of the container.
+             * \param[in,out] val The value to prepend (moved)
+             */
+            void push_front(T && val)
+            {
+                emplace_front(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the beginning of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_front(Args &&... args)
+            {
+                uint32_t index = create_node(std::forward<Args>(args)...); // may move the buffer
+                return *slots_[link_before(head_, index)].value();
+            }
+            /*!
+             * \brief Remove the last value of the container (if any).
+             */
+            void pop_back()
+            {
+                if(size_)
+                    erase_node(tail_);
+            }
+            /*!
+             * \brief Remove the first value of the container (if any).
+             */
+            void pop_front()
+            {
+                if(size_)
+                    erase_node(head_);
+            }
+            /*!
+             * \brief Insert a value at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in] val The element to be inserted
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            void insert(size_t index, const T & val)
+            {
+                emplace(index, val);
+            }
+            /*!
+             * \brief Insert a value at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in,out] val The element to be inserted (moved)
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            void insert(size_t index, T && val)
+            {
+                emplace(index, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in] args The arguments to construct the value from
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            template <typename... Args>
+            void emplace(size_t index, Args &&... args)
+            {
+                if(index <= size_)
+                {
+                    uint32_t node = create_node(std::forward<Args>(args)...);
+                    link_before(index == size_ ? npos : node_at(index), node);
+                }
+            }
+            /*!
+             * \brief Remove the element at the given index.
+             * \param[in] index The position of the element to remove
+             *
+             * \note Does nothing if the index is out-of-range or if the container is empty.
+             */
+            void remove(size_t index)
+            {
+                if(index < size_)
+                    erase_node(node_at(index));
+            }
+
+            // Operators
+            /*!
+             * \brief Copy assign new contents to the container (replacing the current contents).
+             * \param other A CompactDoublyLinkedList of the same type (to copy)
+             * \return A reference to `*this`
+             *
+             * \note The buffer is reused if it is large enough.
+             */
+            CompactDoublyLinkedList<T, Allocator> & operator=(const CompactDoublyLinkedList<T, Allocator> & other)
+            {
+                if(this != &other)
+                {
+                    clear();
+                    copy_allocator(other, typename SlotAllocatorTraits::propagate_on_container_copy_assignment());
+                    reserve(other.size_);
+                    for(uint32_t current = other.head_; current != npos; current = other.slots_[current].next)
+                        emplace_back(*other.slots_[current].value());
+                }
+                return *this;
+            }
+            /*!
+             * \brief Move assign new contents to the container (replacing the current contents).
+             * \param[in,out] other A CompactDoublyLinkedList of the same type (to move from)
+             * \return A reference to `*this`
+             *
+             * \note The moved CompactDoublyLinkedList will be left empty but still valid.
+             * \note If the allocator does not follow the moved content and both allocators are not equal, the values are moved one by one.
+             */
+            CompactDoublyLinkedList<T, Allocator> & operator=(CompactDoublyLinkedList<T, Allocator> && other) noexcept(SlotAllocatorTraits::propagate_on_container_move_assignment::value)
+            {
+                if(this != &other)
+                    move_from(other, typename SlotAllocatorTraits::propagate_on_container_move_assignment());
+                return *this;
+            }
+
+            // Iterator
+            /*!
+             * \class Iterator
+             * \brief An iterator implementation.
+             */
+            class Iterator final
+            {
+                friend class CompactDoublyLinkedList;
+
+                private:
+                    uint32_t node;
+                    const CompactDoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another Iterator.
+                     * \param[in] last The Iterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const Iterator & last) const
+                    {
+                        if(list && node == list->head_ && last.node == npos)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(uint32_t current = node; current != last.node; current = list->slots_[current].next)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                       /*!< The pointer to a pointed value */
+                    typedef T & reference;                                     /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    Iterator() : node(npos), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] it The Iterator to copy
+                     */
+                    Iterator(const Iterator & it) : node(it.node), list(it.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The Iterator to copy
+                     * \return A reference to `*this`
+                     */
+                    Iterator & operator=(const Iterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T & operator*() const
+                    {
+                        return *list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T * operator->() const
+                    {
+                        return list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator & operator++() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].next;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment Iterator
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator operator++(int) //postfix
+                    {
+                        Iterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the Iterator `rhs` times.
+                     */
+                    Iterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend Iterator operator+(Iterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend Iterator operator+(size_t lhs, Iterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ Iterator of a container refers to its last element.
+                     */
+                    Iterator & operator--() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].previous;
+                        else if(list)
+                            node = list->tail_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement Iterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    Iterator operator--(int) //postfix
+                    {
+                        Iterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the Iterator `rhs` times.
+                     */
+                    Iterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend Iterator operator-(Iterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend Iterator operator-(size_t lhs, Iterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first Iterator
+                     * \param[in] last The Iterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const Iterator & first, const Iterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+            /*!
+             * \class ConstIterator
+             * \brief A `const` iterator implementation.
+             */
+            class ConstIterator final
+            {
+                friend class CompactDoublyLinkedList;
+
+                private:
+                    uint32_t node;
+                    const CompactDoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ConstIterator.
+                     * \param[in] last The ConstIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ConstIterator & last) const
+                    {
+                        if(list && node == list->head_ && last.node == npos)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(uint32_t current = node; current != last.node; current = list->slots_[current].next)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef const T & reference;                               /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstIterator() : node(npos), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] cit The ConstIterator to copy
+                     */
+                    ConstIterator(const ConstIterator & cit) : node(cit.node), list(cit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ConstIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ConstIterator & operator=(const ConstIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The reight-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return *list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value as `const`
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator & operator++() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].next;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator operator++(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ConstIterator `rhs` times.
+                     */
+                    ConstIterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ConstIterator operator+(ConstIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ConstIterator operator+(size_t lhs, ConstIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ ConstIterator of a container refers to its last element.
+                     */
+                    ConstIterator & operator--() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].previous;
+                        else if(list)
+                            node = list->tail_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ConstIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstIterator operator--(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ConstIterator `rhs` times.
+                     */
+                    ConstIterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ConstIterator operator-(ConstIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ConstIterator operator-(size_t lhs, ConstIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ConstIterator
+                     * \param[in] last The ConstIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ConstIterator & first, const ConstIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+            /*!
+             * \class ReverseIterator
+             * \brief A reverse iterator implementation.
+             */
+            class ReverseIterator final
+            {
+                friend class CompactDoublyLinkedList;
+
+                private:
+                    uint32_t node;
+                    const CompactDoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ReverseIterator.
+                     * \param[in] last The ReverseIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ReverseIterator & last) const
+                    {
+                        if(list && node == list->tail_ && last.node == npos)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(uint32_t current = node; current != last.node; current = list->slots_[current].previous)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                       /*!< The pointer to a pointed value */
+                    typedef T & reference;                                     /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ReverseIterator() : node(npos), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] rit The ReverseIterator to copy
+                     */
+                    ReverseIterator(const ReverseIterator & rit) : node(rit.node), list(rit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ReverseIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ReverseIterator & operator=(const ReverseIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ReverseIterator & lhs, const ReverseIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ReverseIterator & lhs, const ReverseIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
+                     */
+                    T & operator*() const
+                    {
+                        return *list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value
+                     *
+                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
+                     */
+                    T * operator->() const
+                    {
+                        return list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the previous element.
+                     */
+                    ReverseIterator & operator++() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].previous;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ReverseIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ReverseIterator operator++(int) //postfix
+                    {
+                        ReverseIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ReverseIterator `rhs` times.
+                     */
+                    ReverseIterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ReverseIterator operator+(ReverseIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ReverseIterator operator+(size_t lhs, ReverseIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the next element.
+                     *
+                     * \note Decrementing the _past-the-end_ ReverseIterator of a container refers to its last element.
+                     */
+                    ReverseIterator & operator--() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].next;
+                        else if(list)
+                            node = list->head_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ReverseIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ReverseIterator operator--(int) //postfix
+                    {
+                        ReverseIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ReverseIterator `rhs` times.
+                     */
+                    ReverseIterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ReverseIterator operator-(ReverseIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ReverseIterator operator-(size_t lhs, ReverseIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ReverseIterator
+                     * \param[in] last The ReverseIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ReverseIterator & first, const ReverseIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+            /*!
+             * \class ConstReverseIterator
+             * \brief A `const` reverse iterator implementation.
+             */
+            class ConstReverseIterator final
+            {
+                friend class CompactDoublyLinkedList;
+
+                private:
+                    uint32_t node;
+                    const CompactDoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ConstReverseIterator.
+                     * \param[in] last The ConstReverseIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ConstReverseIterator & last) const
+                    {
+                        if(list && node == list->tail_ && last.node == npos)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(uint32_t current = node; current != last.node; current = list->slots_[current].previous)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef const T & reference;                               /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstReverseIterator() : node(npos), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] crit The ConstReverseIterator to copy
+                     */
+                    ConstReverseIterator(const ConstReverseIterator & crit) : node(crit.node), list(crit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ConstReverseIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ConstReverseIterator & operator=(const ConstReverseIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstReverseIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return *list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value as `const`
+                     *
+                     * \note Dereference an out-of-range ConstReverseIterator is undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return list->slots_[node].value();
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstReverseIterator & operator++() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].previous;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstReverseIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstReverseIterator operator++(int) //postfix
+                    {
+                        ConstReverseIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ConstReverseIterator `rhs` times.
+                     */
+                    ConstReverseIterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ConstReverseIterator operator+(ConstReverseIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ConstReverseIterator operator+(size_t lhs, ConstReverseIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the next element.
+                     *
+                     * \note Decrementing the _past-the-end_ ConstReverseIterator of a container refers to its last element.
+                     */
+                    ConstReverseIterator & operator--() //prefix
+                    {
+                        if(node != npos)
+                            node = list->slots_[node].next;
+                        else if(list)
+                            node = list->head_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ConstReverseIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstReverseIterator operator--(int) //postfix
+                    {
+                        ConstReverseIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ConstReverseIterator `rhs` times.
+                     */
+                    ConstReverseIterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ConstReverseIterator operator-(ConstReverseIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ConstReverseIterator operator-(size_t lhs, ConstReverseIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ConstReverseIterator
+                     * \param[in] last The ConstReverseIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ConstReverseIterator & first, const ConstReverseIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+
+            // Standard container types
+            typedef T value_type;                                /*!< The type of the elements */
+            typedef T & reference;                               /*!< The reference to an element */
+            typedef const T & const_reference;                   /*!< The `const` reference to an element */
+            typedef size_t size_type;                            /*!< The type of the sizes and indexes */
+            typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+            typedef Iterator iterator;                           /*!< The iterator type */
+            typedef ConstIterator const_iterator;                /*!< The `const` iterator type */
+            typedef ReverseIterator reverse_iterator;            /*!< The reverse iterator type */
+            typedef ConstReverseIterator const_reverse_iterator; /*!< The `const` reverse iterator type */
+            typedef Allocator allocator_type;                    /*!< The allocator type */
+
+            /*!
+             * \brief Get an iterator referring to the first element.
+             * \return An iterator
+             */
+            Iterator begin()
+            {
+                Iterator it;
+                it.node = head_;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get an iterator referring to the _past-the-end_ element.
+             * \return An iterator
+             */
+            Iterator end()
+            {
+                Iterator it;
+                it.node = npos;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator cbegin() const
+            {
+                ConstIterator cit;
+                cit.node = head_;
+                cit.list = this;
+                return cit;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator cend() const
+            {
+                ConstIterator cit;
+                cit.node = npos;
+                cit.list = this;
+                return cit;
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the last element.
+             * \return A reverse iterator
+             */
+            ReverseIterator rbegin()
+            {
+                ReverseIterator rit;
+                rit.node = tail_;
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A reverse iterator
+             */
+            ReverseIterator rend()
+            {
+                ReverseIterator rit;
+                rit.node = npos;
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the last element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator crbegin() const
+            {
+                ConstReverseIterator crit;
+                crit.node = tail_;
+                crit.list = this;
+                return crit;
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator crend() const
+            {
+                ConstReverseIterator crit;
+                crit.node = npos;
+                crit.list = this;
+                return crit;
+            }
+            //extras
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator begin() const
+            {
+                return cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator end() const
+            {
+                return cend();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the last element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator rbegin() const
+            {
+                return crbegin();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator rend() const
+            {
+                return crend();
+            }
+
+            // Iterator-based modifiers
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] val The element to be inserted
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(ConstIterator pos, const T & val)
+            {
+                return emplace(pos, val);
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(ConstIterator pos, T && val)
+            {
+                return emplace(pos, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            Iterator emplace(ConstIterator pos, Args &&... args)
+            {
+                Iterator it;
+                it.node = link_before(pos.node, create_node(std::forward<Args>(args)...));
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return An iterator referring to the element following the removed one
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator erase(ConstIterator pos)
+            {
+                Iterator it;
+                it.node = erase_node(pos.node);
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Remove the elements in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove (can be end())
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase(ConstIterator first, ConstIterator last)
+            {
+                while(first != last)
+                    first.node = erase_node(first.node);
+
+                Iterator it;
+                it.node = last.node;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] val The element to be inserted
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(Iterator pos, const T & val)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), val);
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(Iterator pos, T && val)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            Iterator emplace(Iterator pos, Args &&... args)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return An iterator referring to the element following the removed one
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator erase(Iterator pos)
+            {
+                return erase(iterator_cast<ConstIterator>(pos));
+            }
+            /*!
+             * \brief Remove the elements in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove (can be end())
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase(Iterator first, Iterator last)
+            {
+                return erase(iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Insert the values of a range before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] range The values to insert (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             * \return An iterator referring to the first inserted element (\p pos if the range is empty)
+             *
+             * \warning The range must not be part of the container (Undefined Behaviour).
+             * \note The buffer grows at most once when the size of the range is known (forward iterators).
+             * The contents are unchanged if an exception is thrown (except for the capacity).
+             */
+            template <typename Range>
+            Iterator insert_range(ConstIterator pos, Range && range)
+            {
+                using std::begin;
+                using std::end;
+                auto first = begin(range);
+                auto last = end(range);
+                reserve_range(first, last, std::is_convertible<typename std::iterator_traits<decltype(first)>::iterator_category, std::forward_iterator_tag>());
+
+                Iterator res;
+                res.node = pos.node;
+                res.list = this;
+                if(first == last)
+                    return res;
+
+                res = emplace(pos, *first);
+                try
+                {
+                    for(++first; first != last; ++first)
+                        emplace(pos, *first);
+                }
+                catch(...)
+                {
+                    erase(iterator_cast<ConstIterator>(res), pos);
+                    throw;
+                }
+                return res;
+            }
+            /*!
+             * \brief Insert the values of a range before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] range The values to insert (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             * \return An iterator referring to the first inserted element (\p pos if the range is empty)
+             *
+             * \warning The range must not be part of the container (Undefined Behaviour).
+             * \note The contents are unchanged if an exception is thrown (except for the capacity).
+             */
+            template <typename Range>
+            Iterator insert_range(Iterator pos, Range && range)
+            {
+                return insert_range(iterator_cast<ConstIterator>(pos), std::forward<Range>(range));
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] val The element to be inserted
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ConstReverseIterator pos, const T & val)
+            {
+                return emplace(pos, val);
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ConstReverseIterator pos, T && val)
+            {
+                return emplace(pos, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] args The arguments to construct the value from
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            ReverseIterator emplace(ConstReverseIterator pos, Args &&... args)
+            {
+                ReverseIterator rit;
+                rit.node = link_before(pos.node != npos ? slots_[pos.node].next : head_, create_node(std::forward<Args>(args)...));
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return A reverse iterator referring to the element following the removed one in reverse order
+             *
+             * \warning \p pos must be a valid reverse iterator of this container other than rend() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator erase(ConstReverseIterator pos)
+            {
+                ReverseIterator rit;
+                rit.node = slots_[pos.node].previous;
+                rit.list = this;
+                erase_node(pos.node);
+                return rit;
+            }
+            /*!
+             * \brief Remove the elements in the reverse range [first, last).
+             * \param[in] first The first element to remove (in reverse order)
+             * \param[in] last The element following the last one to remove in reverse order (can be rend())
+             * \return A reverse iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            ReverseIterator erase(ConstReverseIterator first, ConstReverseIterator last)
+            {
+                while(first != last)
+                {
+                    uint32_t tmp = first.node;
+                    ++first;
+                    erase_node(tmp);
+                }
+
+                ReverseIterator rit;
+                rit.node = last.node;
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] val The element to be inserted
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ReverseIterator pos, const T & val)
+            {
+                return emplace(iterator_cast<ConstReverseIterator>(pos), val);
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ReverseIterator pos, T && val)
+            {
+                return emplace(iterator_cast<ConstReverseIterator>(pos), std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] args The arguments to construct the value from
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            ReverseIterator emplace(ReverseIterator pos, Args &&... args)
+            {
+                return emplace(iterator_cast<ConstReverseIterator>(pos), std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return A reverse iterator referring to the element following the removed one in reverse order
+             *
+             * \warning \p pos must be a valid reverse iterator of this container other than rend() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator erase(ReverseIterator pos)
+            {
+                return erase(iterator_cast<ConstReverseIterator>(pos));
+            }
+            /*!
+             * \brief Remove the elements in the reverse range [first, last).
+             * \param[in] first The first element to remove (in reverse order)
+             * \param[in] last The element following the last one to remove in reverse order (can be rend())
+             * \return A reverse iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            ReverseIterator erase(ReverseIterator first, ReverseIterator last)
+            {
+                return erase(iterator_cast<ConstReverseIterator>(first), iterator_cast<ConstReverseIterator>(last));
+            }
+
+            // Lookup
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return An iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time.
+             */
+            Iterator find(const T & val)
+            {
+                return find_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return A `const` iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time.
+             */
+            ConstIterator find(const T & val) const
+            {
+                return find_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return An iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            Iterator find_if(UnaryPredicate pred)
+            {
+                Iterator it;
+                it.node = head_;
+                it.list = this;
+                while(it.node != npos && !pred(*slots_[it.node].value()))
+                    it.node = slots_[it.node].next;
+                return it;
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return A `const` iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            ConstIterator find_if(UnaryPredicate pred) const
+            {
+                ConstIterator cit;
+                cit.node = head_;
+                cit.list = this;
+                while(cit.node != npos && !pred(static_cast<const T &>(*slots_[cit.node].value())))
+                    cit.node = slots_[cit.node].next;
+                return cit;
+            }
+            /*!
+             * \brief Check if an element is equal to a value.
+             * \param[in] val The value to look for
+             * \return `true` if an element is equal to \p val, `false` otherwise
+             *
+             * \note Linear time.
+             */
+            bool contains(const T & val) const
+            {
+                return find(val).node != npos;
+            }
+            /*!
+             * \brief Count the elements equal to a value.
+             * \param[in] val The value to look for
+             * \return The number of elements equal to \p val
+             *
+             * \note Linear time.
+             */
+            size_t count(const T & val) const
+            {
+                return count_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Count the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of elements satisfying \p pred
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            size_t count_if(UnaryPredicate pred) const
+            {
+                size_t res = 0;
+                for(uint32_t current = head_; current != npos; current = slots_[current].next)
+                {
+                    if(pred(static_cast<const T &>(*slots_[current].value())))
+                        ++res;
+                }
+                return res;
+            }
+
+            // Operations
+            /*!
+             * \brief Sort the elements.
+             * \param[in] comp The "less than" comparison function object
+             *
+             * \note The sort is stable and only relinks the nodes: the iterators and references remain valid.
+             * The nodes are ordered through a temporary array of their indexes (`O(n log n)`, `4 * size()` bytes).
+             */
+            template <typename Compare>
+            void sort(Compare comp)
+            {
+                if(size_ < 2)
+                    return;
+
+                std::vector<uint32_t> order;
+                order.reserve(size_);
+                for(uint32_t current = head_; current != npos; current = slots_[current].next)
+                    order.push_back(current);
+                std::stable_sort(order.begin(), order.end(), [this, &comp](uint32_t lhs, uint32_t rhs){ return comp(*slots_[lhs].value(), *slots_[rhs].value()); });
+
+                uint32_t previous = npos;
+                for(uint32_t index : order)
+                {
+                    slots_[index].previous = previous;
+                    if(previous != npos)
+                        slots_[previous].next = index;
+                    previous = index;
+                }
+                slots_[previous].next = npos;
+                head_ = order.front();
+                tail_ = previous;
+            }
+            /*!
+             * \brief Sort the elements in ascending order (using `operator<`).
+             *
+             * \note The sort is stable and only relinks the nodes: the iterators and references remain valid.
+             */
+            void sort()
+            {
+                sort([](const T & lhs, const T & rhs){ return lhs < rhs; });
+            }
+            /*!
+             * \brief Remove the consecutive duplicate elements.
+             * \param[in] pred The binary predicate telling whether two elements are equal
+             * \return The number of removed elements
+             *
+             * \note Only the first element of each group of consecutive equal elements is kept (single pass).
+             */
+            template <typename BinaryPredicate>
+            size_t unique(BinaryPredicate pred)
+            {
+                size_t removed = 0;
+                if(size_)
+                {
+                    uint32_t current = head_;
+                    uint32_t next = slots_[current].next;
+                    while(next != npos)
+                    {
+                        if(pred(*slots_[current].value(), *slots_[next].value()))
+                        {
+                            next = erase_node(next);
+                            ++removed;
+                        }
+                        else
+                        {
+                            current = next;
+                            next = slots_[next].next;
+                        }
+                    }
+                }
+                return removed;
+            }
+            /*!
+             * \brief Remove the consecutive duplicate elements (using `operator==`).
+             * \return The number of removed elements
+             */
+            size_t unique()
+            {
+                return unique([](const T & lhs, const T & rhs){ return lhs == rhs; });
+            }
+            /*!
+             * \brief Remove the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass: each node is unlinked and its slot freed as soon as it is found.
+             * If \p pred throws, the elements already removed stay removed.
+             */
+            template <typename UnaryPredicate>
+            size_t remove_if(UnaryPredicate pred)
+            {
+                size_t removed = 0;
+                for(uint32_t current = head_; current != npos;)
+                {
+                    if(pred(*slots_[current].value()))
+                    {
+                        current = erase_node(current);
+                        ++removed;
+                    }
+                    else
+                        current = slots_[current].next;
+                }
+                return removed;
+            }
+            /*!
+             * \brief Remove the elements equal to a value.
+             * \param[in] val The value to remove (can be an element of the container)
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass.
+             */
+            size_t remove_value(const T & val)
+            {
+                uint32_t self = npos; // the node of val (removed last) if val is an element
+                size_t removed = 0;
+                for(uint32_t current = head_; current != npos;)
+                {
+                    if(slots_[current].value() == std::addressof(val))
+                    {
+                        self = current;
+                        current = slots_[current].next;
+                    }
+                    else if(*slots_[current].value() == val)
+                    {
+                        current = erase_node(current);
+                        ++removed;
+                    }
+                    else
+                        current = slots_[current].next;
+                }
+                if(self != npos)
+                {
+                    erase_node(self);
+                    ++removed;
+                }
+                return removed;
+            }
+            /*!
+             * \brief Reverse the order of the elements.
+             *
+             * \note Linear time, the links of each node are swapped and the iterators remain valid.
+             */
+            void reverse() noexcept
+            {
+                for(uint32_t current = head_; current != npos; current = slots_[current].previous)
+                    std::swap(slots_[current].next, slots_[current].previous);
+                std::swap(head_, tail_);
+            }
+
+            // Iterator conversions
+            /*!
+             * \brief Iterator conversion.
+             * \param[in] it An Iterator to convert
+             * \return The converted iterator
+             *
+             * \note An Iterator can only be casted into an Iterator, a ConstIterator, a ReverseIterator or a ConstReverseIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const Iterator & it)
+            {
+                static_assert((std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value || std::is_same<IT_type, ReverseIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value), "manual::CompactDoublyLinkedList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = it.node;
+                res.list = it.list;
+                return res;
+            }
+            /*!
+             * \brief ReverseIterator conversion.
+             * \param[in] rit A ReverseIterator to convert
+             * \return The converted iterator
+             *
+             * \note A ReverseIterator can only be casted into a ReverseIterator, a ConstReverseIterator, an Iterator or a ConstIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const ReverseIterator & rit)
+            {
+                static_assert((std::is_same<IT_type, ReverseIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value || std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::CompactDoublyLinkedList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = rit.node;
+                res.list = rit.list;
+                return res;
+            }
+            /*!
+             * \brief ConstIterator conversion.
+             * \param[in] cit A ConstIterator to convert
+             * \return The converted iterator
+             *
+             * \note A ConstIterator can only be casted into a ConstIterator or a ConstReverseIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const ConstIterator & cit)
+            {
+                static_assert((std::is_same<IT_type, ConstIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value), "manual::CompactDoublyLinkedList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = cit.node;
+                res.list = cit.list;
+                return res;
+            }
+            /*!
+             * \brief ConstReverseIterator conversion.
+             * \param[in] crit A ConstReverseIterator to convert
+             * \return The converted iterator
+             *
+             * \note A ConstReverseIterator can only be casted into a ConstReverseIterator or a ConstIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const ConstReverseIterator & crit)
+            {
+                static_assert((std::is_same<IT_type, ConstReverseIterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::CompactDoublyLinkedList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = crit.node;
+                res.list = crit.list;
+                return res;
+            }
+    };
+
+    template <typename T, typename Allocator>
+    constexpr uint32_t CompactDoublyLinkedList<T, Allocator>::npos;
+
+#ifdef MANUAL_HAS_PMR
+    namespace pmr
+    {
+        template <typename T> using CompactDoublyLinkedList = manual::CompactDoublyLinkedList<T, std::pmr::polymorphic_allocator<T>>; /*!< CompactDoublyLinkedList using a `std::pmr::memory_resource` */
+    }
+#endif
+
+#ifdef __cpp_lib_ranges
+    // The container models the standard range concepts (C++20)
+    static_assert(std::ranges::bidirectional_range<CompactDoublyLinkedList<int>> && std::ranges::sized_range<CompactDoublyLinkedList<int>>, "manual::CompactDoublyLinkedList - Not a bidirectional_range.");
+    static_assert(std::ranges::bidirectional_range<const CompactDoublyLinkedList<int>>, "manual::CompactDoublyLinkedList - Not a `const` bidirectional_range.");
+#endif
+}
+
+#endif // MANUAL_COMPACTDOUBLYLINKEDLIST_H
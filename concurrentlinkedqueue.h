@@ -0,0 +1,626 @@
+#ifndef MANUAL_CONCURRENTLINKEDQUEUE_H
+#define MANUAL_CONCURRENTLINKEDQUEUE_H
+
+/*!
+ * \file concurrentlinkedqueue.h
+ * \brief Concurrent queues: a lock-free linked queue and a bounded single-producer single-consumer ring (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace manual
+{
+    /*!
+     * \brief The size assumed for a cache line, used to keep the data written by different threads apart.
+     */
+    constexpr size_t cache_line_size = 64;
+
+    /*!
+     * \class ConcurrentLinkedQueue
+     * \brief A lock-free multi-producer multi-consumer FIFO queue (Michael & Scott).
+     *
+     * The queue is a singly linked list of nodes `{value, next}` starting with a dummy node: the producers link their node after the tail
+     * with a compare-and-swap and the consumers move the head forward the same way, so that pushes and pops never take a lock
+     * and producers only contend with each other on the tail.<br/>
+     * The unlinked nodes are reclaimed with hazard pointers: a node is freed only once no thread has published it as in use.
+     *
+     * \note The nodes are obtained from \p Allocator (rebound to the node type) from several threads at once: it must be thread-safe
+     * (the `std::allocator` is, manual::PoolAllocator is not).
+     * \note Each thread using the queue holds a hazard record of the queue during an operation; the records are kept until the queue is destroyed.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class ConcurrentLinkedQueue
+    {
+        protected:
+            /*!
+             * \struct Node
+             * \brief Internal representation of a node.
+             *
+             * The value is only alive between the push of the node and its pop (a popped node becomes the dummy head).
+             */
+            struct Node final
+            {
+                std::atomic<Node*> next{nullptr};            /*!< Link to the next node */
+                alignas(T) unsigned char storage[sizeof(T)]; /*!< The storage of the value */
+
+                /*!
+                 * \brief Get the value of the node.
+                 * \return The address of the value
+                 */
+                T * value()
+                {
+                    return reinterpret_cast<T*>(storage);
+                }
+            };
+            /*!
+             * \struct HazardRecord
+             * \brief The hazard pointers (and the nodes retired) of one thread at a time.
+             */
+            struct HazardRecord final
+            {
+                std::atomic<Node*> hazards[2];     /*!< The nodes in use by the owning thread */
+                std::atomic<bool> active{true};    /*!< Whether a thread owns the record */
+                HazardRecord * next = nullptr;     /*!< Link to the next record */
+                std::vector<Node*> retired;        /*!< The unlinked nodes waiting to be freed */
+                char padding[cache_line_size];     /*!< Keep the records of different threads on different cache lines */
+
+                /*!
+                 * \brief Default constructor.
+                 */
+                HazardRecord() : retired(), padding()
+                {
+                    hazards[0].store(nullptr, std::memory_order_relaxed);
+                    hazards[1].store(nullptr, std::memory_order_relaxed);
+                }
+            };
+
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator; /*!< The allocator rebound to the node type */
+            typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;                             /*!< The node allocator traits */
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<T> ValueAllocator;   /*!< The allocator rebound to the value type */
+            typedef std::allocator_traits<ValueAllocator> ValueAllocatorTraits;                           /*!< The value allocator traits */
+
+            // data members
+            std::atomic<Node*> head_;                    /*!< Pointer to the dummy node preceding the front */
+            char head_padding_[cache_line_size];         /*!< Keep the head and the tail on different cache lines */
+            std::atomic<Node*> tail_;                    /*!< Pointer to the last node */
+            char tail_padding_[cache_line_size];         /*!< Keep the tail and the records on different cache lines */
+            mutable std::atomic<HazardRecord*> records_; /*!< The hazard records (never removed before the destruction) */
+            mutable std::atomic<size_t> record_count_;   /*!< The number of hazard records */
+            uint64_t id_;                                /*!< The identifier of the queue (never reused) */
+            NodeAllocator allocator_;                    /*!< The node allocator */
+
+            // Node management
+            /*!
+             * \brief Allocate a node and construct its value.
+             * \param[in] args The arguments to construct the value from
+             * \return The new node (not linked)
+             */
+            template <typename... Args>
+            Node * create_node(Args &&... args)
+            {
+                Node * node = create_dummy();
+                try
+                {
+                    ValueAllocator alloc(allocator_);
+                    ValueAllocatorTraits::construct(alloc, node->value(), std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    destroy_node(node);
+                    throw;
+                }
+                return node;
+            }
+            /*!
+             * \brief Allocate a node without value.
+             * \return The new node (not linked)
+             */
+            Node * create_dummy()
+            {
+                Node * node = NodeAllocatorTraits::allocate(allocator_, 1);
+                NodeAllocatorTraits::construct(allocator_, node);
+                return node;
+            }
+            /*!
+             * \brief Destroy the value of a node (the node is kept).
+             * \param[in,out] node The node holding a value
+             */
+            void destroy_value(Node * node)
+            {
+                ValueAllocator alloc(allocator_);
+                ValueAllocatorTraits::destroy(alloc, node->value());
+            }
+            /*!
+             * \brief Deallocate a node (its value must have been destroyed).
+             * \param[in] node The node to destroy (unlinked)
+             */
+            void destroy_node(Node * node)
+            {
+                NodeAllocatorTraits::destroy(allocator_, node);
+                NodeAllocatorTraits::deallocate(allocator_, node, 1);
+            }
+
+            // Hazard pointers
+            /*!
+             * \brief Get a new identifier of queue.
+             * \return The identifier
+             */
+            static uint64_t next_id()
+            {
+                static std::atomic<uint64_t> counter{0};
+                return ++counter;
+            }
+            /*!
+             * \brief Take the ownership of a hazard record.
+             * \return A record owned by the calling thread until release_record()
+             *
+             * The last record used by the thread is tried first, then the free records, and a new record is added if all are in use.
+             */
+            HazardRecord * acquire_record() const
+            {
+                struct Cache
+                {
+                    uint64_t id;
+                    HazardRecord * record;
+                };
+                static thread_local Cache cache{0, nullptr};
+
+                bool expected = false;
+                if(cache.id == id_ && cache.record->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                    return cache.record;
+
+                HazardRecord * record = records_.load(std::memory_order_acquire);
+                for(; record; record = record->next)
+                {
+                    expected = false;
+                    if(!record->active.load(std::memory_order_relaxed) && record->active.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                        break;
+                }
+                if(!record)
+                {
+                    record = new HazardRecord();
+                    record->next = records_.load(std::memory_order_relaxed);
+                    while(!records_.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+                    {}
+                    record_count_.fetch_add(1, std::memory_order_relaxed);
+                }
+                cache.id = id_;
+                cache.record = record;
+                return record;
+            }
+            /*!
+             * \brief Give back a hazard record.
+             * \param[in,out] record The record owned by the calling thread
+             */
+            static void release_record(HazardRecord * record)
+            {
+                record->hazards[0].store(nullptr, std::memory_order_release);
+                record->hazards[1].store(nullptr, std::memory_order_release);
+                record->active.store(false, std::memory_order_release);
+            }
+            /*!
+             * \brief Read a shared pointer and publish it as in use.
+             * \param[out] hazard The hazard pointer to publish to
+             * \param[in] src The shared pointer to read
+             * \return The read pointer, safe to dereference until \p hazard is cleared
+             */
+            static Node * protect(std::atomic<Node*> & hazard, const std::atomic<Node*> & src)
+            {
+                Node * node = src.load(std::memory_order_relaxed);
+                for(;;)
+                {
+                    hazard.store(node, std::memory_order_seq_cst);
+                    Node * check = src.load(std::memory_order_seq_cst);
+                    if(check == node)
+                        return node;
+                    node = check;
+                }
+            }
+            /*!
+             * \brief Defer the deallocation of an unlinked node.
+             * \param[in,out] record The record owned by the calling thread
+             * \param[in] node The unlinked node (without value)
+             *
+             * \note The retired nodes are scanned once they outnumber twice the hazard pointers, so that the cost is amortized.
+             */
+            void retire(HazardRecord * record, Node * node)
+            {
+                record->retired.push_back(node);
+                if(record->retired.size() >= std::max<size_t>(64, 4 * record_count_.load(std::memory_order_relaxed)))
+                    scan(record);
+            }
+            /*!
+             * \brief Free the retired nodes of a record which are not in use by any thread.
+             * \param[in,out] record The record owned by the calling thread
+             */
+            void scan(HazardRecord * record)
+            {
+                std::vector<Node*> hazards;
+                for(HazardRecord * current = records_.load(std::memory_order_acquire); current; current = current->next)
+                {
+                    for(const std::atomic<Node*> & hazard : current->hazards)
+                    {
+                        Node * node = hazard.load(std::memory_order_seq_cst);
+                        if(node)
+                            hazards.push_back(node);
+                    }
+                }
+                std::sort(hazards.begin(), hazards.end());
+
+                size_t kept = 0;
+                for(Node * node : record->retired)
+                {
+                    if(std::binary_search(hazards.begin(), hazards.end(), node))
+                        record->retired[kept++] = node;
+                    else
+                        destroy_node(node);
+                }
+                record->retired.resize(kept);
+            }
+            /*!
+             * \brief Complete a pop once the value has been moved out.
+             * \param[in,out] record The record owned by the calling thread (released)
+             * \param[in] head The unlinked dummy node (retired)
+             * \param[in,out] next The new dummy node (its value is destroyed)
+             */
+            void finish_pop(HazardRecord * record, Node * head, Node * next)
+            {
+                destroy_value(next);
+                record->hazards[0].store(nullptr, std::memory_order_release);
+                record->hazards[1].store(nullptr, std::memory_order_release);
+                retire(record, head);
+                release_record(record);
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty queue.
+             */
+            ConcurrentLinkedQueue() : ConcurrentLinkedQueue(Allocator())
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the nodes from (must be thread-safe)
+             *
+             * Creates an empty queue.
+             */
+            explicit ConcurrentLinkedQueue(const Allocator & alloc) : head_(nullptr), head_padding_(), tail_(nullptr), tail_padding_(), records_(nullptr), record_count_(0), id_(next_id()), allocator_(alloc)
+            {
+                Node * dummy = create_dummy();
+                head_.store(dummy, std::memory_order_relaxed);
+                tail_.store(dummy, std::memory_order_relaxed);
+            }
+            /*!
+             * \brief Copy constructor (deleted).
+             *
+             * A concurrent queue cannot be copied.
+             */
+            ConcurrentLinkedQueue(const ConcurrentLinkedQueue<T, Allocator> &) = delete;
+            /*!
+             * \brief Destructor.
+             *
+             * \warning No thread must be using the queue.
+             */
+            ~ConcurrentLinkedQueue()
+            {
+                Node * node = head_.load(std::memory_order_relaxed);
+                Node * next = node->next.load(std::memory_order_relaxed);
+                destroy_node(node);
+                for(node = next; node; node = next)
+                {
+                    next = node->next.load(std::memory_order_relaxed);
+                    destroy_value(node);
+                    destroy_node(node);
+                }
+
+                HazardRecord * record = records_.load(std::memory_order_relaxed);
+                while(record)
+                {
+                    HazardRecord * tmp = record;
+                    record = record->next;
+                    for(Node * retired : tmp->retired)
+                        destroy_node(retired);
+                    delete tmp;
+                }
+            }
+
+            // Capacity
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the queue was empty at the time of the call, `false` otherwise
+             *
+             * \note The result may be outdated as soon as it is returned if other threads use the queue.
+             */
+            bool empty() const
+            {
+                HazardRecord * record = acquire_record();
+                Node * head = protect(record->hazards[0], head_);
+                bool res = !head->next.load(std::memory_order_acquire);
+                release_record(record);
+                return res;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Add a value at the back of the container.
+             * \param[in] val The value to push
+             */
+            void push(const T & val)
+            {
+                emplace(val);
+            }
+            /*!
+             * \brief Add a value at the back of the container.
+             * \param[in,out] val The value to push (moved)
+             */
+            void push(T && val)
+            {
+                emplace(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the back of the container.
+             * \param[in] args The arguments to construct the value from
+             *
+             * \note Lock-free: the node is linked after the tail with a compare-and-swap, a lagging tail is moved forward by whoever sees it.
+             */
+            template <typename... Args>
+            void emplace(Args &&... args)
+            {
+                Node * node = create_node(std::forward<Args>(args)...);
+                HazardRecord * record = acquire_record();
+                for(;;)
+                {
+                    Node * tail = protect(record->hazards[0], tail_);
+                    Node * next = tail->next.load(std::memory_order_acquire);
+                    if(tail != tail_.load(std::memory_order_acquire))
+                        continue;
+
+                    if(next)
+                    {
+                        tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if(tail->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+                    {
+                        tail_.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+                        break;
+                    }
+                }
+                release_record(record);
+            }
+            /*!
+             * \brief Remove the front value of the container (if any).
+             * \param[out] out The popped value (move-assigned)
+             * \return `true` if a value was popped, `false` if the queue was empty
+             *
+             * \note Lock-free: the head is moved forward with a compare-and-swap and the previous dummy node is retired.
+             * \warning If the move assignment throws, the value is lost (it is already unlinked), the queue remains valid.
+             */
+            bool try_pop(T & out)
+            {
+                HazardRecord * record = acquire_record();
+                for(;;)
+                {
+                    Node * head = protect(record->hazards[0], head_);
+                    Node * tail = tail_.load(std::memory_order_acquire);
+                    Node * next = head->next.load(std::memory_order_acquire);
+                    record->hazards[1].store(next, std::memory_order_seq_cst);
+                    if(head != head_.load(std::memory_order_seq_cst))
+                        continue;
+
+                    if(!next)
+                    {
+                        release_record(record);
+                        return false;
+                    }
+
+                    if(head == tail)
+                    {
+                        tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if(head_.compare_exchange_strong(head, next, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    {
+                        // next is the new dummy: only this thread may touch its value
+                        try
+                        {
+                            out = std::move(*next->value());
+                        }
+                        catch(...)
+                        {
+                            finish_pop(record, head, next);
+                            throw;
+                        }
+                        finish_pop(record, head, next);
+                        return true;
+                    }
+                }
+            }
+
+            // Operators
+            /*!
+             * \brief Copy assignment operator (deleted).
+             *
+             * A concurrent queue cannot be copied.
+             */
+            ConcurrentLinkedQueue<T, Allocator> & operator=(const ConcurrentLinkedQueue<T, Allocator> &) = delete;
+    };
+
+    /*!
+     * \class SpscQueue
+     * \brief A bounded lock-free FIFO queue for exactly one producer thread and one consumer thread.
+     *
+     * The values live in a ring buffer allocated once: a push and a pop are a couple of loads and one store, with no compare-and-swap and no allocation.
+     * Each side keeps a cached copy of the index of the other side and only reads the shared one when the cached copy says the ring is full (or empty).
+     *
+     * \warning Concurrent calls to `try_push()` (or to `try_pop()`) from several threads are Undefined Behaviour.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class SpscQueue
+    {
+        protected:
+            typedef std::allocator_traits<Allocator> AllocatorTraits; /*!< The allocator traits */
+
+            // data members
+            T * buffer_;                            /*!< The ring buffer */
+            size_t capacity_;                       /*!< The number of slots (a power of two) */
+            Allocator allocator_;                   /*!< The allocator of the ring buffer */
+            char padding_[cache_line_size];         /*!< Keep the consumer data on its own cache line */
+            std::atomic<size_t> head_;              /*!< The number of popped values (written by the consumer) */
+            size_t cached_tail_;                    /*!< The last tail seen by the consumer */
+            char head_padding_[cache_line_size];    /*!< Keep the producer data on its own cache line */
+            std::atomic<size_t> tail_;              /*!< The number of pushed values (written by the producer) */
+            size_t cached_head_;                    /*!< The last head seen by the producer */
+            char tail_padding_[cache_line_size];    /*!< Keep the producer data on its own cache line */
+
+        public:
+            // Constructors
+            /*!
+             * \brief Capacity constructor.
+             * \param[in] capacity The minimal number of values the queue can hold (rounded up to a power of two)
+             * \param[in] alloc The allocator to get the ring buffer from
+             *
+             * Creates an empty queue.
+             */
+            explicit SpscQueue(size_t capacity, const Allocator & alloc = Allocator()) : buffer_(nullptr), capacity_(1), allocator_(alloc), padding_(),
+                                                                                        head_(0), cached_tail_(0), head_padding_(),
+                                                                                        tail_(0), cached_head_(0), tail_padding_()
+            {
+                while(capacity_ < capacity)
+                    capacity_ *= 2;
+                buffer_ = AllocatorTraits::allocate(allocator_, capacity_);
+            }
+            /*!
+             * \brief Copy constructor (deleted).
+             *
+             * A concurrent queue cannot be copied.
+             */
+            SpscQueue(const SpscQueue<T, Allocator> &) = delete;
+            /*!
+             * \brief Destructor.
+             *
+             * \warning No thread must be using the queue.
+             */
+            ~SpscQueue()
+            {
+                size_t head = head_.load(std::memory_order_relaxed);
+                size_t tail = tail_.load(std::memory_order_relaxed);
+                for(; head != tail; ++head)
+                    AllocatorTraits::destroy(allocator_, buffer_ + (head & (capacity_ - 1)));
+                AllocatorTraits::deallocate(allocator_, buffer_, capacity_);
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the number of values the container can hold.
+             * \return The capacity
+             */
+            size_t capacity() const
+            {
+                return capacity_;
+            }
+            /*!
+             * \brief Get the size of the container.
+             * \return The size at the time of the call
+             *
+             * \note The result may be outdated as soon as it is returned.
+             */
+            size_t size() const
+            {
+                size_t head = head_.load(std::memory_order_acquire);
+                return tail_.load(std::memory_order_acquire) - head;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the queue was empty at the time of the call, `false` otherwise
+             *
+             * \note The result may be outdated as soon as it is returned.
+             */
+            bool empty() const
+            {
+                return size() == 0;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Add a value at the back of the container (producer thread only).
+             * \param[in] val The value to push
+             * \return `true` if the value was pushed, `false` if the queue was full
+             */
+            bool try_push(const T & val)
+            {
+                return try_emplace(val);
+            }
+            /*!
+             * \brief Add a value at the back of the container (producer thread only).
+             * \param[in,out] val The value to push (moved only if pushed)
+             * \return `true` if the value was pushed, `false` if the queue was full
+             */
+            bool try_push(T && val)
+            {
+                return try_emplace(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the back of the container (producer thread only).
+             * \param[in] args The arguments to construct the value from
+             * \return `true` if the value was pushed, `false` if the queue was full
+             */
+            template <typename... Args>
+            bool try_emplace(Args &&... args)
+            {
+                size_t tail = tail_.load(std::memory_order_relaxed);
+                if(tail - cached_head_ == capacity_)
+                {
+                    cached_head_ = head_.load(std::memory_order_acquire);
+                    if(tail - cached_head_ == capacity_)
+                        return false;
+                }
+                AllocatorTraits::construct(allocator_, buffer_ + (tail & (capacity_ - 1)), std::forward<Args>(args)...);
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+            /*!
+             * \brief Remove the front value of the container (consumer thread only).
+             * \param[out] out The popped value (move-assigned)
+             * \return `true` if a value was popped, `false` if the queue was empty
+             */
+            bool try_pop(T & out)
+            {
+                size_t head = head_.load(std::memory_order_relaxed);
+                if(head == cached_tail_)
+                {
+                    cached_tail_ = tail_.load(std::memory_order_acquire);
+                    if(head == cached_tail_)
+                        return false;
+                }
+                T * slot = buffer_ + (head & (capacity_ - 1));
+                out = std::move(*slot);
+                AllocatorTraits::destroy(allocator_, slot);
+                head_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            // Operators
+            /*!
+             * \brief Copy assignment operator (deleted).
+             *
+             * A concurrent queue cannot be copied.
+             */
+            SpscQueue<T, Allocator> & operator=(const SpscQueue<T, Allocator> &) = delete;
+    };
+}
+
+#endif // MANUAL_CONCURRENTLINKEDQUEUE_H
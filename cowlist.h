@@ -0,0 +1,497 @@
+#ifndef MANUAL_COWLIST_H
+#define MANUAL_COWLIST_H
+
+/*!
+ * \file cowlist.h
+ * \brief A copy-on-write wrapper of the doubly linked list (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "doublylinkedlist.h"
+
+namespace manual
+{
+    /*!
+     * \class CopyOnWriteList
+     * \brief A DoublyLinkedList shared between the copies until one of them is modified.
+     * \tparam T The type of the elements
+     * \tparam Allocator The allocator of the nodes
+     *
+     * The copies and snapshot() are constant time: they only share the list.
+     * The first modification of a shared list clones it (linear time), the following ones are performed in place
+     * until the list is shared again.<br/>
+     * A reader keeps a snapshot (the list as it was) as long as it wants while the writer keeps modifying its own clone.
+     *
+     * The list itself (and its reference count) is put on the heap by `std::make_shared`, a clone gets its nodes from the same allocator.<br/>
+     * A moved CopyOnWriteList keeps no list: it reads as empty, and its next modification creates a new list.
+     *
+     * \note The sharing is reference-counted (std::shared_ptr): the snapshots can be read and dropped by other threads
+     * without synchronization. A same CopyOnWriteList used by two threads has to be synchronized (e.g. taking a snapshot
+     * while the writer modifies the list).
+     * \warning The references returned by read(), write() and the iterators are invalidated by the next modification
+     * (which may clone the list): keep a snapshot() to read the content across modifications.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class CopyOnWriteList
+    {
+        public:
+            typedef DoublyLinkedList<T, Allocator> List; /*!< The shared list */
+
+        protected:
+            typedef std::allocator_traits<Allocator> AllocatorTraits; /*!< The allocator traits */
+
+            // data members
+            std::shared_ptr<List> list_;                  /*!< The list (shared with the copies and the snapshots, `nullptr` once moved) */
+            MANUAL_NO_UNIQUE_ADDRESS Allocator allocator_; /*!< The allocator of the nodes (given to the clones) */
+
+            /*!
+             * \brief Check if the list is shared with a copy or a snapshot.
+             * \return `true` if another owner refers to the list, `false` otherwise
+             *
+             * \note When the list is not shared, the acquire fence orders the modifications after the reads of the
+             * last snapshot dropped by another thread.
+             */
+            bool is_shared() const noexcept
+            {
+                if(list_.use_count() > 1)
+                    return true;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return false;
+            }
+            /*!
+             * \brief Get an empty list, read in place of the list of a moved CopyOnWriteList.
+             * \return A `const` reference to an empty list (one for all the CopyOnWriteList of the type)
+             */
+            static const List & empty_list() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+            {
+                static const List list;
+                return list;
+            }
+            /*!
+             * \brief Get the list for reading, the empty one if the CopyOnWriteList was moved.
+             * \return A `const` reference to the current list
+             */
+            const List & content() const noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+            {
+                return list_ ? *list_ : empty_list();
+            }
+            /*!
+             * \brief Share the list of \p other, and its allocator (the allocator follows the copied content).
+             * \param[in] other The CopyOnWriteList to copy
+             */
+            void copy_from(const CopyOnWriteList<T, Allocator> & other, std::true_type) noexcept
+            {
+                list_ = other.list_;
+                allocator_ = other.allocator_;
+            }
+            /*!
+             * \brief Share the list of \p other if both allocators are equal, clone it with the current allocator otherwise (the allocator stays).
+             * \param[in] other The CopyOnWriteList to copy
+             */
+            void copy_from(const CopyOnWriteList<T, Allocator> & other, std::false_type)
+            {
+                if(AllocatorTraits::is_always_equal::value || allocator_ == other.allocator_)
+                    list_ = other.list_;
+                else
+                    list_ = std::make_shared<List>(other.content().cbegin(), other.content().cend(), allocator_);
+            }
+            /*!
+             * \brief Exchange the lists, and the allocators (the allocator follows the moved content).
+             * \param[in,out] other The CopyOnWriteList to move (gets the former content of `*this`)
+             */
+            void move_from(CopyOnWriteList<T, Allocator> & other, std::true_type) noexcept
+            {
+                list_.swap(other.list_);
+                using std::swap;
+                swap(allocator_, other.allocator_);
+            }
+            /*!
+             * \brief Exchange the lists if both allocators are equal, clone the list of \p other with the current allocator otherwise (the allocator stays).
+             * \param[in,out] other The CopyOnWriteList to move (gets the former content of `*this`, or keeps its own)
+             */
+            void move_from(CopyOnWriteList<T, Allocator> & other, std::false_type)
+            {
+                if(AllocatorTraits::is_always_equal::value || allocator_ == other.allocator_)
+                    list_.swap(other.list_);
+                else
+                    copy_from(other, std::false_type());
+            }
+            /*!
+             * \brief Swap the allocators (they follow the swapped content).
+             * \param[in,out] other The CopyOnWriteList to swap with
+             */
+            void swap_allocator(CopyOnWriteList<T, Allocator> & other, std::true_type) noexcept
+            {
+                using std::swap;
+                swap(allocator_, other.allocator_);
+            }
+            /*!
+             * \brief Keep the allocators (they do not follow the swapped content).
+             */
+            void swap_allocator(CopyOnWriteList<T, Allocator> &, std::false_type) noexcept
+            {}
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates an empty list.
+             */
+            explicit CopyOnWriteList(const Allocator & alloc = Allocator()) : list_(std::make_shared<List>(alloc)), allocator_(alloc)
+            {}
+            /*!
+             * \brief Initializer list constructor.
+             * \param[in] init The initializer list
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates a list holding a copy of the initializer list.
+             */
+            CopyOnWriteList(std::initializer_list<T> init, const Allocator & alloc = Allocator()) : list_(std::make_shared<List>(init, alloc)), allocator_(alloc)
+            {}
+            /*!
+             * \brief List constructor.
+             * \param[in,out] list The list to share (moved)
+             */
+            explicit CopyOnWriteList(List && list) : list_(std::make_shared<List>(std::move(list))), allocator_(list_->get_allocator())
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The CopyOnWriteList to copy
+             *
+             * \note Constant time: the list is shared until one of them is modified.
+             */
+            CopyOnWriteList(const CopyOnWriteList<T, Allocator> & other) noexcept : list_(other.list_), allocator_(other.allocator_)
+            {}
+            /*!
+             * \brief Move constructor.
+             * \param[in] other The CopyOnWriteList to move
+             *
+             * \note Constant time and no allocation: the list is stolen, \p other is left empty (its next modification creates its new list).
+             */
+            CopyOnWriteList(CopyOnWriteList<T, Allocator> && other) noexcept : list_(std::move(other.list_)), allocator_(other.allocator_)
+            {}
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const noexcept
+            {
+                return list_ ? list_->size() : 0;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the list is empty, `false` otherwise
+             */
+            bool empty() const noexcept
+            {
+                return !list_ || list_->empty();
+            }
+            /*!
+             * \brief Check if the list is shared with a copy or a snapshot.
+             * \return `true` if the next modification clones the list, `false` otherwise
+             */
+            bool shared() const noexcept
+            {
+                return list_.use_count() > 1;
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the first element.
+             * \return A direct `const` reference to the first value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return content().front();
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct `const` reference to the last value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & back() const
+            {
+                return content().back();
+            }
+            /*!
+             * \brief Get the list for reading.
+             * \return A `const` reference to the current list
+             *
+             * \note The reference is invalidated by the next modification.
+             */
+            const List & read() const noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+            {
+                return content();
+            }
+            /*!
+             * \brief Take a snapshot of the list.
+             * \return The current list, shared (it is never modified: the next modification clones it)
+             *
+             * \note Constant time. The snapshot of a moved CopyOnWriteList is the empty list shared by the type (it owns nothing).
+             */
+            std::shared_ptr<const List> snapshot() const noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+            {
+                if(!list_)
+                    return std::shared_ptr<const List>(std::shared_ptr<const List>(), &empty_list());
+                return list_;
+            }
+            /*!
+             * \brief Get the list for writing.
+             * \return A reference to the list, cloned first if it is shared
+             *
+             * \note The reference is invalidated by the next copy or snapshot() followed by a modification.
+             */
+            List & write()
+            {
+                if(!list_)
+                    list_ = std::make_shared<List>(allocator_);
+                else if(is_shared())
+                    list_ = std::make_shared<List>(list_->cbegin(), list_->cend(), allocator_);
+                return *list_;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Add a value at the end of the list.
+             * \param[in] val The value to add
+             */
+            void push_back(const T & val)
+            {
+                write().push_back(val);
+            }
+            /*!
+             * \brief Add a value at the end of the list.
+             * \param[in,out] val The value to add (moved)
+             */
+            void push_back(T && val)
+            {
+                write().push_back(std::move(val));
+            }
+            /*!
+             * \brief Add a value at the beginning of the list.
+             * \param[in] val The value to add
+             */
+            void push_front(const T & val)
+            {
+                write().push_front(val);
+            }
+            /*!
+             * \brief Add a value at the beginning of the list.
+             * \param[in,out] val The value to add (moved)
+             */
+            void push_front(T && val)
+            {
+                write().push_front(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the end of the list.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_back(Args &&... args)
+            {
+                return write().emplace_back(std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Construct a value in place at the beginning of the list.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_front(Args &&... args)
+            {
+                return write().emplace_front(std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the last value of the list (if any).
+             */
+            void pop_back()
+            {
+                if(!empty())
+                    write().pop_back();
+            }
+            /*!
+             * \brief Remove the first value of the list (if any).
+             */
+            void pop_front()
+            {
+                if(!empty())
+                    write().pop_front();
+            }
+            /*!
+             * \brief Clear the container.
+             *
+             * \note A shared list is not cloned: a new empty list replaces it.
+             */
+            void clear()
+            {
+                if(!list_)
+                    return;
+                if(is_shared())
+                    list_ = std::make_shared<List>(allocator_);
+                else
+                    list_->clear();
+            }
+            /*!
+             * \brief Swap the content of two CopyOnWriteList.
+             * \param[in,out] other The CopyOnWriteList to swap with
+             *
+             * \warning If the allocators do not follow the swapped content, both allocators must compare equal (Undefined Behaviour).
+             */
+            void swap(CopyOnWriteList<T, Allocator> & other) noexcept
+            {
+                list_.swap(other.list_);
+                swap_allocator(other, typename AllocatorTraits::propagate_on_container_swap());
+            }
+
+            // Operators
+            /*!
+             * \brief Assignment operator.
+             * \param[in] other The CopyOnWriteList to copy
+             * \return A reference to `*this`
+             *
+             * \note Constant time: the list is shared until one of them is modified. If the allocator does not follow the copied content,
+             * the list is only shared if both allocators are equal, it is cloned with the current allocator if they are not.
+             */
+            CopyOnWriteList<T, Allocator> & operator=(const CopyOnWriteList<T, Allocator> & other) noexcept(AllocatorTraits::propagate_on_container_copy_assignment::value || AllocatorTraits::is_always_equal::value)
+            {
+                if(this != &other)
+                    copy_from(other, typename AllocatorTraits::propagate_on_container_copy_assignment());
+                return *this;
+            }
+            /*!
+             * \brief Move assignment operator.
+             * \param[in,out] other The CopyOnWriteList to move (gets the former content of `*this`)
+             * \return A reference to `*this`
+             *
+             * \note If the allocator does not follow the moved content and both allocators are not equal, the list of \p other is cloned (\p other keeps it).
+             */
+            CopyOnWriteList<T, Allocator> & operator=(CopyOnWriteList<T, Allocator> && other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value)
+            {
+                if(this != &other)
+                    move_from(other, typename AllocatorTraits::propagate_on_container_move_assignment());
+                return *this;
+            }
+            /*!
+             * \brief Equality operator.
+             * \param[in] lhs The left-hand side
+             * \param[in] rhs The right-hand side
+             * \return `true` if both lists hold equal elements in the same order, `false` otherwise
+             *
+             * \note Constant time when the list is shared.
+             */
+            friend bool operator==(const CopyOnWriteList<T, Allocator> & lhs, const CopyOnWriteList<T, Allocator> & rhs)
+            {
+                return lhs.list_ == rhs.list_ || (lhs.size() == rhs.size() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin()));
+            }
+            /*!
+             * \brief Inequality operator.
+             * \param[in] lhs The left-hand side
+             * \param[in] rhs The right-hand side
+             * \return `true` if the lists differ, `false` otherwise
+             */
+            friend bool operator!=(const CopyOnWriteList<T, Allocator> & lhs, const CopyOnWriteList<T, Allocator> & rhs)
+            {
+                return !(lhs == rhs);
+            }
+
+            // Standard container types
+            typedef T value_type;                                                    /*!< The type of the elements */
+            typedef Allocator allocator_type;                                        /*!< The type of the allocator */
+            typedef size_t size_type;                                                /*!< The type of the size */
+            typedef std::ptrdiff_t difference_type;                                  /*!< The type of the distance between two iterators */
+            typedef const T & reference;                                             /*!< The reference to an element (use write() to modify) */
+            typedef const T & const_reference;                                       /*!< The `const` reference to an element */
+            typedef typename List::const_iterator iterator;                          /*!< The iterator type (read only) */
+            typedef typename List::const_iterator const_iterator;                    /*!< The `const` iterator type */
+            typedef typename List::const_reverse_iterator reverse_iterator;          /*!< The reverse iterator type (read only) */
+            typedef typename List::const_reverse_iterator const_reverse_iterator;    /*!< The `const` reverse iterator type */
+
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            const_iterator begin() const
+            {
+                return content().cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            const_iterator end() const
+            {
+                return content().cend();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            const_iterator cbegin() const
+            {
+                return content().cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            const_iterator cend() const
+            {
+                return content().cend();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the last element.
+             * \return A `const` reverse iterator
+             */
+            const_reverse_iterator crbegin() const
+            {
+                return content().crbegin();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A `const` reverse iterator
+             */
+            const_reverse_iterator crend() const
+            {
+                return content().crend();
+            }
+
+            /*!
+             * \brief Swap two CopyOnWriteList.
+             * \param[in,out] lhs The first list
+             * \param[in,out] rhs The second list
+             */
+            friend void swap(CopyOnWriteList<T, Allocator> & lhs, CopyOnWriteList<T, Allocator> & rhs) noexcept
+            {
+                lhs.swap(rhs);
+            }
+    };
+
+#ifdef MANUAL_HAS_PMR
+    namespace pmr
+    {
+        template <typename T> using CopyOnWriteList = manual::CopyOnWriteList<T, std::pmr::polymorphic_allocator<T>>; /*!< CopyOnWriteList using a `std::pmr::memory_resource` */
+    }
+#endif
+
+    // The copies and the moves do not throw: a snapshot never fails
+    static_assert(std::is_nothrow_copy_constructible<CopyOnWriteList<int>>::value && std::is_nothrow_move_constructible<CopyOnWriteList<int>>::value, "manual::CopyOnWriteList - The copies may throw.");
+}
+
+#endif // MANUAL_COWLIST_H
@@ -7,19 +7,58 @@
  * \author Raphaël Lefèvre
  */
 
-//#include <cstddef>
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 
+#include "listhardening.h"
+#include "listindex.h"
+#include "liststats.h"
+#include "poolallocator.h"
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#include <memory_resource>
+#define MANUAL_HAS_PMR
+#endif
+#endif
+
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(no_unique_address)
+#define MANUAL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+#endif
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#define MANUAL_NO_UNIQUE_ADDRESS
+#endif
+#endif
+
+#ifndef MANUAL_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define MANUAL_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define MANUAL_PREFETCH(address) ((void)(address))
+#endif
+#endif
+
 namespace manual
 {
     /*!
      * \class DoublyLinkedList
      * \brief A doubly linked list implementation.
+     *
+     * The nodes are obtained from \p Allocator (rebound to the node type), which can be any `std::allocator` compatible allocator
+     * (e.g. `std::pmr::polymorphic_allocator` or manual::PoolAllocator).<br/>
+     * The positional access walks the list from the closest end, unless \p IndexPolicy keeps an index of the nodes (e.g. manual::CheckpointIndex).<br/>
+     * The allocations and the walks of the positional access are counted if \p StatsPolicy does (e.g. manual::CountingStats, see stats()).
      */
-    template <typename T>
+    template <typename T, typename Allocator = std::allocator<T>, typename IndexPolicy = NoIndex, typename StatsPolicy = NoStats>
     class DoublyLinkedList
     {
         protected:
@@ -29,733 +68,1270 @@ namespace manual
              */
             struct Node final
             {
+                /*!
+                 * \brief Constructor.
+                 * \param[in] args The arguments to construct the value from
+                 */
+                template <typename... Args>
+                explicit Node(Args &&... args) : value(std::forward<Args>(args)...), next(nullptr), previous(nullptr)
+                {}
+
                 T value;         /*!< The value */
                 Node * next;     /*!< Link the the next node */
                 Node * previous; /*!< Link to the previous node */
+#ifdef MANUAL_HARDENED
+                std::uint64_t stamp = 0; /*!< The stamp checked by the iterators (0 for the destroyed nodes) */
+#endif
             };
 
-            // data members
-            Node * head_; /*!< Pointer to the head */
-            Node * tail_; /*!< Pointer to the tail */
-            size_t size_; /*!< The size */
+            /*!
+             * \struct SpareNode
+             * \brief Internal representation of a spare node (the storage of a destroyed node, kept for the next insertions).
+             */
+            struct SpareNode final
+            {
+                SpareNode * next; /*!< Link to the next spare node */
+            };
+
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator; /*!< The allocator rebound to the node type */
+            typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;                             /*!< The node allocator traits */
+            typedef typename IndexPolicy::template Index<Node> NodeIndex;                                 /*!< The index of the nodes */
+            typedef IteratorPosition<DoublyLinkedList, !std::is_same<IndexPolicy, NoIndex>::value> Position; /*!< The position cached by the iterators (empty with NoIndex) */
 
-        public:
-            // Constructors
             /*!
-             * \brief Default constructor.
-             *
-             * Creates an empty list.
+             * \brief Enable a function template only for the input iterators (so that it is not picked for two integers).
              */
-            DoublyLinkedList() : head_(nullptr), tail_(nullptr), size_(0)
-            {}
+            template <typename InputIt>
+            using RequireInputIterator = typename std::enable_if<std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type;
+
+            // data members
+            Node * head_;                                     /*!< Pointer to the head */
+            Node * tail_;                                     /*!< Pointer to the tail */
+            size_t size_;                                     /*!< The size */
+            MANUAL_NO_UNIQUE_ADDRESS NodeAllocator allocator_; /*!< The node allocator */
+            MANUAL_NO_UNIQUE_ADDRESS NodeIndex index_;         /*!< The index of the nodes (empty with NoIndex) */
+            MANUAL_NO_UNIQUE_ADDRESS mutable StatsPolicy stats_; /*!< The counters (empty with NoStats, `mutable` to count the `const` walks) */
+            SpareNode * spare_;                               /*!< The spare nodes (allocated, not constructed) */
+            size_t spare_count_;                              /*!< The number of spare nodes */
+            size_t spare_limit_;                              /*!< The maximal number of spare nodes to keep (set by reserve()) */
+#ifdef MANUAL_HARDENED
+            std::uint64_t next_stamp_ = hardened_stamp_base(); /*!< The stamp of the next created node */
+#endif
+
+            // Node management
             /*!
-             * \brief Copy constructor.
-             * \param[in] other The DoublyLinkedList to copy
+             * \brief Allocate and construct a node.
+             * \param[in] args The arguments to construct the value from
+             * \return The new node (not linked)
+             *
+             * \note A spare node is used if there is one. The node is given back if the value constructor throws.
+             * In hardened mode, the node gets a new stamp.
              */
-            DoublyLinkedList(const DoublyLinkedList<T> & other) : head_(nullptr), tail_(nullptr), size_(other.size_)
+            template <typename... Args>
+            Node * create_node(Args &&... args)
             {
-                if(size_)
+                if(!spare_)
                 {
-                    head_ = new Node;
-                    head_->value = other.head_->value;
-                    head_->previous = nullptr;
-                    head_->next = nullptr;
-
-                    Node * current = head_;
-                    Node * other_current = other.head_;
-                    while(other_current->next)
+                    Node * node = NodeAllocatorTraits::allocate(allocator_, 1);
+                    stats_.on_allocate();
+                    try
                     {
-                        current->next = new Node;
-                        current->next->value = other_current->next->value;
-                        current->next->previous = current;
-                        current->next->next = nullptr;
-
-                        current = current->next;
-                        other_current = other_current->next;
+                        NodeAllocatorTraits::construct(allocator_, node, std::forward<Args>(args)...);
                     }
-                    tail_ = current;
+                    catch(...)
+                    {
+                        NodeAllocatorTraits::deallocate(allocator_, node, 1);
+                        stats_.on_deallocate();
+                        throw;
+                    }
+                    MANUAL_HARDENED_ONLY(node->stamp = next_stamp_++;)
+                    return node;
+                }
+
+                SpareNode * next = spare_->next;
+                Node * node = reinterpret_cast<Node*>(spare_);
+                try
+                {
+                    NodeAllocatorTraits::construct(allocator_, node, std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    spare_ = ::new(static_cast<void*>(node)) SpareNode{next};
+                    throw;
                 }
+                spare_ = next;
+                --spare_count_;
+                MANUAL_HARDENED_ONLY(node->stamp = next_stamp_++;)
+                return node;
             }
             /*!
-             * \brief Move constructor.
-             * \param[in,out] other The DoublyLinkedList to move from
+             * \brief Destroy a node, and keep it as a spare node or deallocate it.
+             * \param[in] node The node to destroy (already unlinked)
              *
-             * \note The moved DoublyLinkedList will be left empty but still valid.
-             */
-            DoublyLinkedList(DoublyLinkedList<T> && other) noexcept : head_{std::exchange(other.head_, nullptr)},
-                                                                      tail_{std::exchange(other.tail_, nullptr)},
-                                                                      size_{std::exchange(other.size_, 0)}
-            {}
-            /*!
-             * \brief Initialization constructor.
-             * \param[in] init_list An initializer list to copy
+             * \note The node is kept while there are less than `spare_limit_` spare nodes.
+             * In hardened mode, its stamp is cleared first (the iterators to the node become invalid).
              */
-            DoublyLinkedList(const std::initializer_list<T> & init_list) : head_(nullptr), tail_(nullptr), size_(init_list.size())
+            void destroy_node(Node * node) noexcept
             {
-                if(size_)
+                MANUAL_HARDENED_ONLY(node->stamp = 0;)
+                NodeAllocatorTraits::destroy(allocator_, node);
+                if(spare_count_ < spare_limit_)
                 {
-                    typename std::initializer_list<T>::iterator it = init_list.begin();
-
-                    head_ = new Node;
-                    head_->value = *it;
-                    head_->previous = nullptr;
-                    head_->next = nullptr;
-
-                    Node * current = head_;
-
-                    for(++it; it != init_list.end(); ++it)
-                    {
-                        current->next = new Node;
-                        current->next->value = *it;
-                        current->next->previous = current;
-                        current->next->next = nullptr;
-
-                        current = current->next;
-                    }
-                    tail_ = current;
+                    spare_ = ::new(static_cast<void*>(node)) SpareNode{spare_};
+                    ++spare_count_;
+                }
+                else
+                {
+                    NodeAllocatorTraits::deallocate(allocator_, node, 1);
+                    stats_.on_deallocate();
                 }
             }
-            ~DoublyLinkedList()
+            /*!
+             * \brief Deallocate all the spare nodes.
+             */
+            void release_spare_nodes() noexcept
             {
-                if(size_)
+                deallocate_nodes(spare_);
+                spare_ = nullptr;
+                spare_count_ = 0;
+            }
+            /*!
+             * \brief Destroy all the nodes (the links and the size are left as is).
+             *
+             * \note When the nodes are trivially destructible and the allocator can take all its blocks back at once (see PoolAllocator::recycle_if_unique()),
+             * the nodes are not visited (the spare ones are dropped as well), except in hardened mode (their stamps are cleared).
+             * Otherwise each node is destroyed while the next one is prefetched.
+             */
+            void destroy_nodes() noexcept
+            {
+                if(release_nodes(std::integral_constant<bool, std::is_trivially_destructible<Node>::value && allocator_has_recycle<NodeAllocator>::value && !hardened_mode>()))
+                    return;
+                Node * current = head_;
+                Node * tmp = nullptr;
+                for(size_t i = 0; i < size_; ++i)
                 {
-                    Node * current = head_;
-                    Node * tmp = nullptr;
-                    for(size_t i = 0; i < size_; ++i)
-                    {
-                        tmp = current->next;
-                        delete current;
-                        current = tmp;
-                    }
+                    tmp = current->next;
+                    MANUAL_PREFETCH(tmp);
+                    destroy_node(current);
+                    current = tmp;
                 }
             }
-
-            // Capacity
             /*!
-             * \brief Get the size of the container.
-             * \return The size
+             * \brief Give all the nodes back to the allocator at once, if it is the only user of its memory.
+             * \return `true` if the nodes (including the spare ones) were released, `false` otherwise
              */
-            size_t size() const
+            bool release_nodes(std::true_type) noexcept
             {
-                return size_;
+                if(!allocator_.recycle_if_unique())
+                    return false;
+                stats_.on_deallocate(size_ + spare_count_);
+                spare_ = nullptr;
+                spare_count_ = 0;
+                return true;
             }
             /*!
-             * \brief Check if the container is empty.
-             * \return `true` if the list is empty, `false` otherwise
+             * \brief Do nothing (the nodes have to be destroyed one by one).
+             * \return `false`
              */
-            bool empty() const
+            bool release_nodes(std::false_type) noexcept
             {
-                return !head_;
+                return false;
             }
-
-            // Element Access
             /*!
-             * \brief Get the first element.
-             * \return A direct reference to the head value
-             *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \brief Deallocate a chain of storage of destroyed nodes.
+             * \param[in] nodes The first storage of the chain (can be `nullptr`)
              */
-            T & front()
+            void deallocate_nodes(SpareNode * nodes) noexcept
             {
-                return head_->value;
+                while(nodes)
+                {
+                    SpareNode * next = nodes->next;
+                    NodeAllocatorTraits::deallocate(allocator_, reinterpret_cast<Node*>(nodes), 1);
+                    stats_.on_deallocate();
+                    nodes = next;
+                }
             }
             /*!
-             * \brief Get the first element.
-             * \return A direct `const` reference to the head value
+             * \brief Prepare the allocator for the creation of a given number of nodes.
+             * \param[in] count The number of nodes about to be created
              *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \note Only has an effect if the allocator provides `reserve()` (e.g. manual::PoolAllocator: the nodes then come from one slab).
              */
-            const T & front() const
+            void reserve_nodes(size_t count)
             {
-                return head_->value;
+                reserve_nodes(count, allocator_has_reserve<NodeAllocator>());
             }
             /*!
-             * \brief Get the last element.
-             * \return A direct reference to the tail value
-             *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \brief Reserve the nodes in the allocator.
+             * \param[in] count The number of nodes about to be created
              */
-            T & back()
+            void reserve_nodes(size_t count, std::true_type)
             {
-                return tail_->value;
+                allocator_.reserve(count);
             }
             /*!
-             * \brief Get the last element.
-             * \return A direct `const` reference to the tail value
-             *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \brief Do nothing (the allocator cannot reserve).
              */
-            const T & back() const
+            void reserve_nodes(size_t, std::false_type)
+            {}
+            /*!
+             * \brief Prepare the allocator for the nodes of a range (the size of the range is known and the allocator can reserve).
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the last one of the range
+             */
+            template <typename ForwardIt>
+            void reserve_nodes(ForwardIt first, ForwardIt last, std::true_type)
             {
-                return tail_->value;
+                reserve_nodes(static_cast<size_t>(std::distance(first, last)));
             }
             /*!
-             * \brief Access to an element by index.
-             * \param[in] index The position of the element to access
-             * \return A `const` reference to the element value at the given index
+             * \brief Do nothing (the size of the range is unknown or the allocator cannot reserve).
+             */
+            template <typename InputIt>
+            void reserve_nodes(InputIt, InputIt, std::false_type)
+            {}
+            /*!
+             * \brief Append the values of a range.
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the last one of the range
              *
-             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
-             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             * \note The nodes are created in one go from the allocator when the size of the range is known (forward iterators).
              */
-            const T & operator[](size_t index) const
+            template <typename InputIt>
+            void append_values(InputIt first, InputIt last)
             {
-                if((size_-1 - index) < index) // closer to the end
-                {
-                    Node * current = tail_;
-                    for(size_t i = size_-1; i > index; --i)
-                    {
-                        current = current->previous;
-                    }
-                    return current->value;
-                }
-                else // closer to the beginning
-                {
-                    Node * current = head_;
-                    for(size_t i = 0; i < index; ++i)
-                    {
-                        current = current->next;
-                    }
-                    return current->value;
-                }
+                reserve_nodes(first, last, std::integral_constant<bool, allocator_has_reserve<NodeAllocator>::value
+                                                                        && std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::forward_iterator_tag>::value>());
+                for(; first != last; ++first)
+                    emplace_back(*first);
             }
             /*!
-             * \brief Access to an element by index.
-             * \param[in] index The position of the element to access
-             * \return A reference to the element value at the given index
+             * \brief Check the consistency of the size and of the ends (hardened mode, no-op otherwise).
              *
-             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
-             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             * \note Constant time: called after the modifications.
              */
-            T & operator[](size_t index)
+            void check_ends() const noexcept
             {
-                return const_cast<T&>(const_cast<const DoublyLinkedList<T> &>(*this)[index]);
+                MANUAL_HARDENED_CHECK(!size_ == !head_ && !size_ == !tail_, "manual::DoublyLinkedList - The size and the ends are desynchronized.");
+                MANUAL_HARDENED_CHECK(!head_ || !head_->previous, "manual::DoublyLinkedList - The head has a previous node.");
+                MANUAL_HARDENED_CHECK(!tail_ || !tail_->next, "manual::DoublyLinkedList - The tail has a next node.");
+                MANUAL_HARDENED_CHECK(size_ != 1 || head_ == tail_, "manual::DoublyLinkedList - The single node is not both the head and the tail.");
             }
             /*!
-             * \brief Safely access to an element by index.
-             * \param[in] index The position of the element to access
-             * \return A `const` reference to the element value at the given index
+             * \brief Check that the neighbours of a node link back to it (hardened mode, no-op otherwise).
+             * \param[in] node The node (can be `nullptr`)
              *
-             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
-             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             * \note Constant time: called after the modifications and by the increments and decrements of the iterators.
              */
-            const T & at(size_t index) const
+            static void check_links(const Node * node) noexcept
             {
-                if(index >= size_)
-                    throw std::out_of_range(std::string("[Out of range error] - manual::DoublyLinkedList::at() - (index: ") + std::to_string(index) + ", size: " + std::to_string(size_) + ").");
-
-                return (*this)[index];
+                static_cast<void>(node); // unused without MANUAL_HARDENED
+                MANUAL_HARDENED_CHECK(!node || !node->next || node->next->previous == node, "manual::DoublyLinkedList - Corrupted links (the next node does not link back).");
+                MANUAL_HARDENED_CHECK(!node || !node->previous || node->previous->next == node, "manual::DoublyLinkedList - Corrupted links (the previous node does not link back).");
             }
             /*!
-             * \brief Safely access to an element by index.
-             * \param[in] index The position of the element to access
-             * \return A reference to the element value at the given index
-             *
-             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
-             * \note Iterates over the container (from the closest end) until the index is reached. No direct access.
+             * \brief Link a node before a given node.
+             * \param[in,out] pos The node preceding which to insert (`nullptr` to append)
+             * \param[in,out] node The node to insert (not linked)
+             * \return The inserted node
              */
-            T & at(size_t index)
+            Node * link_before(Node * pos, Node * node) noexcept
             {
-                return const_cast<T&>(const_cast<const DoublyLinkedList<T> &>(*this).at(index));
+                index_.invalidate();
+                node->next = pos;
+                node->previous = pos ? pos->previous : tail_;
+                if(node->previous)
+                    node->previous->next = node;
+                else
+                    head_ = node;
+                if(pos)
+                    pos->previous = node;
+                else
+                    tail_ = node;
+                ++size_;
+                check_links(node);
+                check_ends();
+                return node;
             }
-
-            // Modifiers
             /*!
-             * \brief Clear the container.
+             * \brief Unlink and destroy a node.
+             * \param[in,out] node The node to remove
+             * \return The node following the removed one
              */
-            void clear()
+            Node * erase_node(Node * node) noexcept
             {
-                if(size_)
-                {
-                    Node * current = head_;
-                    Node * tmp = nullptr;
-                    for(size_t i = 0; i < size_; ++i)
-                    {
-                        tmp = current->next;
-                        delete current;
-                        current = tmp;
-                    }
-                    head_ = nullptr;
-                    tail_ = nullptr;
-                    size_ = 0;
-                }
+                index_.invalidate();
+                Node * next = node->next;
+                if(node->previous)
+                    node->previous->next = next;
+                else
+                    head_ = next;
+                if(next)
+                    next->previous = node->previous;
+                else
+                    tail_ = node->previous;
+                check_links(next);
+                check_links(node->previous);
+                destroy_node(node);
+                --size_;
+                check_ends();
+                return next;
             }
             /*!
-             * \brief Add a value at the end of the container.
-             * \param[in] val The value to append
+             * \brief Move a chain of nodes of \p other before a given node.
+             * \param[in,out] pos The node preceding which to link the chain (`nullptr` to append)
+             * \param[in,out] other The DoublyLinkedList owning the chain (can be `*this`)
+             * \param[in,out] first The first node of the chain
+             * \param[in,out] last The last node of the chain
+             * \param[in] count The number of nodes in the chain
+             *
+             * \warning \p pos must not be part of the chain.
              */
-            void push_back(const T & val)
+            void transfer(Node * pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Node * first, Node * last, size_t count) noexcept
             {
-                Node * tmp = new Node;
-                tmp->value = val;
-                tmp->next = nullptr;
-                tmp->previous = tail_;
-                if(size_)
-                    tail_->next = tmp;
+                index_.invalidate();
+                other.index_.invalidate();
+                if(first->previous)
+                    first->previous->next = last->next;
                 else
-                    head_ = tmp;
+                    other.head_ = last->next;
+                if(last->next)
+                    last->next->previous = first->previous;
+                else
+                    other.tail_ = first->previous;
+                other.size_ -= count;
 
-                tail_ = tmp;
-                ++size_;
+                first->previous = pos ? pos->previous : tail_;
+                last->next = pos;
+                if(first->previous)
+                    first->previous->next = first;
+                else
+                    head_ = first;
+                if(pos)
+                    pos->previous = last;
+                else
+                    tail_ = last;
+                size_ += count;
+                check_links(first);
+                check_links(last);
+                check_ends();
+                other.check_ends();
             }
             /*!
-             * \brief Add a value at the beginning of the container.
-             * \param[in] val The value to prepend
+             * \brief Cut a null-terminated chain after a given number of nodes.
+             * \param[in,out] first The first node of the chain (can be `nullptr`)
+             * \param[in] count The number of nodes to keep in the chain starting at \p first (at least 1)
+             * \return The first node of the remainder (`nullptr` if none)
+             *
+             * \note Only the `next` links are updated.
              */
-            void push_front(const T & val)
+            static Node * cut_chain(Node * first, size_t count) noexcept
             {
-                Node * tmp = new Node;
-                tmp->value = val;
-                tmp->previous = nullptr;
-                tmp->next = head_;
-                if(size_)
-                    head_->previous = tmp;
-                else
-                    tail_ = tmp;
-
-                head_ = tmp;
-                ++size_;
+                if(!first)
+                    return nullptr;
+                while(--count && first->next)
+                    first = first->next;
+                Node * rest = first->next;
+                first->next = nullptr;
+                return rest;
             }
             /*!
-             * \brief Remove the last value of the container (if any).
+             * \brief Merge two sorted null-terminated chains and link the result after a given node.
+             * \param[in,out] pos The node after which to link the merged chain (`nullptr` to make it the head)
+             * \param[in,out] left The first chain (not empty)
+             * \param[in,out] right The second chain (can be `nullptr`)
+             * \param[in] comp The "less than" comparison function object
+             * \return The last node of the merged chain
+             *
+             * \note The merge is stable: for equivalent elements, the ones of \p left come first.
+             * Both the `next` and `previous` links of the merged chain are updated.
+             * If \p comp throws, the rest of \p left then the rest of \p right are linked after the merged nodes (`next` links only).
              */
-            void pop_back()
+            template <typename Compare>
+            Node * merge_chains(Node * pos, Node * left, Node * right, Compare & comp)
             {
-                if(size_)
+                try
                 {
-                    if(size_ == 1)
+                    while(left || right)
                     {
-                        delete tail_;
-                        tail_ = nullptr;
-                        head_ = nullptr;
+                        Node * node;
+                        if(!left || (right && comp(right->value, left->value)))
+                        {
+                            node = right;
+                            right = right->next;
+                        }
+                        else
+                        {
+                            node = left;
+                            left = left->next;
+                        }
+                        if(pos)
+                            pos->next = node;
+                        else
+                            head_ = node;
+                        node->previous = pos;
+                        pos = node;
                     }
+                }
+                catch(...) // comp is only called when both chains are not empty
+                {
+                    if(pos)
+                        pos->next = left;
                     else
-                    {
-                        Node * tmp = tail_->previous;
-                        tmp->next = nullptr;
-                        delete tail_;
-                        tail_ = tmp;
-                    }
-                    --size_;
+                        head_ = left;
+                    while(left->next)
+                        left = left->next;
+                    left->next = right;
+                    throw;
                 }
+                pos->next = nullptr;
+                return pos;
             }
             /*!
-             * \brief Remove the first value of the container (if any).
+             * \brief Find the node at the given index.
+             * \param[in] index The position of the node (lower than the size)
+             * \return The node
+             *
+             * \note Walks from the closest end, or from the closest checkpoint of the index. The walk is counted by the statistics policy.
              */
-            void pop_front()
+            Node * node_at(size_t index) const noexcept
             {
-                if(size_)
+                Node * current = head_;
+                size_t position = 0;
+                if(!index_.nearest(index, head_, size_, current, position))
                 {
-                    if(size_ == 1)
-                    {
-                        delete head_;
-                        head_ = nullptr;
-                        tail_ = nullptr;
-                    }
-                    else
-                    {
-                        Node * tmp = head_->next;
-                        tmp->previous = nullptr;
-                        delete head_;
-                        head_ = tmp;
-                    }
-                    --size_;
+                    current = head_;
+                    position = 0;
+                }
+
+                if((size_-1 - index) < (index - position)) // closer to the end
+                {
+                    stats_.on_walk(size_-1 - index);
+                    current = tail_;
+                    for(size_t i = size_-1; i > index; --i)
+                        current = current->previous;
+                }
+                else // closer to the beginning (or to a checkpoint)
+                {
+                    stats_.on_walk(index - position);
+                    for(; position < index; ++position)
+                        current = current->next;
                 }
+                return current;
             }
             /*!
-             * \brief Insert a value at the specified index.
-             * \param[in] index The position where to insert the element
-             * \param[in] val The element to be inserted
+             * \brief Move the node of an iterator to a given position with the index (fast jump of an iterator).
+             * \param[in,out] node The node of the iterator (`nullptr` past either end)
+             * \param[in,out] position The cached position of \p node (the size or `size_t(-1)` past either end)
+             * \param[in] target The position to reach (from `size_t(-1)` up to the size)
+             * \return `true` if \p node was moved, `false` if it is not at \p position anymore (nothing is changed)
+             */
+            bool jump(Node *& node, size_t & position, size_t target) const noexcept
+            {
+                if(!node ? (position != size_ && position != static_cast<size_t>(-1)) : (position >= size_ || node_at(position) != node))
+                    return false;
+                position = target;
+                node = (target < size_) ? node_at(target) : nullptr;
+                return true;
+            }
+            /*!
+             * \brief Move the values of consecutive nodes into new nodes, allocated in traversal order (compaction).
+             * \param[in,out] first The first node to relocate
+             * \param[in] count The maximal number of nodes to relocate
+             * \return The node following the last relocated one (`nullptr` if none)
              *
-             * \note Does nothing if the index exceeds the size value.
+             * The new nodes are requested from the allocator before the old ones are given back, so that they are not served the old storage.<br/>
+             * If an exception is thrown, the nodes relocated so far stay relocated and the others are untouched (the values are only moved if
+             * their move constructor does not throw, copied otherwise).
+             * \note In hardened mode, the new nodes get new stamps and the old ones lose theirs (the iterators to the relocated elements become invalid).
              */
-            void insert(size_t index, const T & val)
+            Node * relocate_nodes(Node * first, size_t count)
             {
-                if(index <= size_)
+                index_.invalidate();
+                SpareNode * old_nodes = nullptr; // the storage of the relocated nodes, deallocated at the end
+                try
                 {
-                    if(index == 0)
-                    {
-                        push_front(val);
-                    }
-                    else if(index == size_)
+                    for(; first && count; --count)
                     {
-                        push_back(val);
-                    }
-                    else
-                    {
-                        Node * tmp = new Node;
-                        tmp->value = val;
-
-                        Node * current = nullptr;
-                        if((size_-1 - index) < index) // closer to the end
+                        Node * node = NodeAllocatorTraits::allocate(allocator_, 1);
+                        stats_.on_allocate();
+                        try
                         {
-                            current = tail_;
-                            for(size_t i = size_-1; i > index; --i)
-                                current = current->previous;
+                            NodeAllocatorTraits::construct(allocator_, node, std::move_if_noexcept(first->value));
                         }
-                        else // closer to the beginning
+                        catch(...)
                         {
-                            current = head_;
-                            for(size_t i = 0; i < index; ++i)
-                                current = current->next;
+                            NodeAllocatorTraits::deallocate(allocator_, node, 1);
+                            stats_.on_deallocate();
+                            throw;
                         }
+                        MANUAL_HARDENED_ONLY(node->stamp = next_stamp_++;)
+                        node->previous = first->previous;
+                        node->next = first->next;
+                        (node->previous ? node->previous->next : head_) = node;
+                        (node->next ? node->next->previous : tail_) = node;
 
-                        current->previous->next = tmp;
-                        tmp->previous = current->previous;
-                        tmp->next = current;
-                        current->previous = tmp;
-                        ++size_;
+                        Node * next = first->next;
+                        MANUAL_HARDENED_ONLY(first->stamp = 0;)
+                        NodeAllocatorTraits::destroy(allocator_, first);
+                        old_nodes = ::new(static_cast<void*>(first)) SpareNode{old_nodes};
+                        first = next;
                     }
                 }
+                catch(...)
+                {
+                    deallocate_nodes(old_nodes);
+                    throw;
+                }
+                deallocate_nodes(old_nodes);
+                return first;
             }
             /*!
-             * \brief Remove the element at the given index.
-             * \param[in] index The position of the element to remove
+             * \brief Copy the allocator of \p other (it follows the copied content).
+             * \param[in] other The DoublyLinkedList being copied
              *
-             * \note Does nothing if the index is out-of-range or if the container is empty.
+             * \note If the allocators are not equal, the nodes obtained from the current one (including the spare ones) are destroyed first.
              */
-            void remove(size_t index)
+            void copy_allocator(const DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, std::true_type)
             {
-                if(index < size_)
+                if(allocator_ != other.allocator_)
                 {
-                    if(index == 0)
-                    {
-                        pop_front();
-                    }
-                    else if(index == size_-1)
-                    {
-                        pop_back();
-                    }
-                    else
-                    {
-                        Node * current = nullptr;
-                        if((size_-1 - index) < index) // closer to the end
-                        {
-                            current = tail_;
-                            for(size_t i = size_-1; i > index; --i)
-                                current = current->previous;
-                        }
-                        else // closer to the beginning
-                        {
-                            current = head_;
-                            for(size_t i = 0; i < index; ++i)
-                                current = current->next;
-                        }
-                        current->previous->next = current->next;
-                        current->next->previous = current->previous;
-                        delete current;
-                        --size_;
-                    }
+                    clear();
+                    release_spare_nodes();
+                }
+                allocator_ = other.allocator_;
+            }
+            /*!
+             * \brief Keep the current allocator (it does not follow the copied content).
+             */
+            void copy_allocator(const DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> &, std::false_type)
+            {}
+            /*!
+             * \brief Steal the content of \p other and its spare nodes (the allocator follows the moved content).
+             * \param[in,out] other The DoublyLinkedList to move from
+             *
+             * \warning The container must be empty.
+             */
+            void move_from(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, std::true_type) noexcept
+            {
+                release_spare_nodes();
+                allocator_ = std::move(other.allocator_);
+                spare_ = std::exchange(other.spare_, nullptr);
+                spare_count_ = std::exchange(other.spare_count_, 0);
+                index_ = std::move(other.index_);
+                head_ = std::exchange(other.head_, nullptr);
+                tail_ = std::exchange(other.tail_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            /*!
+             * \brief Steal the content of \p other if the allocators are equal, move the values one by one otherwise.
+             * \param[in,out] other The DoublyLinkedList to move from
+             *
+             * \warning The container must be empty.
+             */
+            void move_from(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, std::false_type)
+            {
+                if(allocator_ == other.allocator_)
+                {
+                    index_ = std::move(other.index_);
+                    head_ = std::exchange(other.head_, nullptr);
+                    tail_ = std::exchange(other.tail_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                }
+                else
+                {
+                    for(Node * current = other.head_; current; current = current->next)
+                        push_back(std::move(current->value));
+                    other.clear();
                 }
             }
 
-            // Operators
+        public:
+            // Constructors
             /*!
-             * \brief Copy assign new contents to the container (replacing the current contents).
-             * \param other A DoublyLinkedList of the same type (to copy)
-             * \return A reference to `*this`
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            DoublyLinkedList() noexcept(std::is_nothrow_default_constructible<NodeAllocator>::value) : head_(nullptr), tail_(nullptr), size_(0), allocator_(), index_(), stats_(), spare_(nullptr), spare_count_(0), spare_limit_(0)
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates an empty list.
+             */
+            explicit DoublyLinkedList(const Allocator & alloc) noexcept(std::is_nothrow_constructible<NodeAllocator, const Allocator &>::value) : head_(nullptr), tail_(nullptr), size_(0), allocator_(alloc), index_(), stats_(), spare_(nullptr), spare_count_(0), spare_limit_(0)
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The DoublyLinkedList to copy
+             */
+            DoublyLinkedList(const DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other) : DoublyLinkedList(other.cbegin(), other.cend(), Allocator(NodeAllocatorTraits::select_on_container_copy_construction(other.allocator_)))
+            {}
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The DoublyLinkedList to move from
+             *
+             * \note The moved DoublyLinkedList will be left empty but still valid.
+             */
+            DoublyLinkedList(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept : head_{std::exchange(other.head_, nullptr)},
+                                                                                 tail_{std::exchange(other.tail_, nullptr)},
+                                                                                 size_{std::exchange(other.size_, 0)},
+                                                                                 allocator_{std::move(other.allocator_)},
+                                                                                 index_{std::move(other.index_)},
+                                                                                 stats_(),
+                                                                                 spare_{std::exchange(other.spare_, nullptr)},
+                                                                                 spare_count_{std::exchange(other.spare_count_, 0)},
+                                                                                 spare_limit_{other.spare_limit_}
+            {}
+            /*!
+             * \brief Initialization constructor.
+             * \param[in] init_list An initializer list to copy
+             * \param[in] alloc The allocator to get the nodes from
              */
-            DoublyLinkedList<T> & operator=(const DoublyLinkedList<T> & other)
+            DoublyLinkedList(const std::initializer_list<T> & init_list, const Allocator & alloc = Allocator()) : DoublyLinkedList(init_list.begin(), init_list.end(), alloc)
+            {}
+            /*!
+             * \brief Range constructor.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * \note When the size of the range is known (forward iterators) and the allocator provides `reserve()` (e.g. manual::PoolAllocator),
+             * all the nodes are reserved at once.
+             */
+            template <typename InputIt, typename = RequireInputIterator<InputIt>>
+            DoublyLinkedList(InputIt first, InputIt last, const Allocator & alloc = Allocator()) : head_(nullptr), tail_(nullptr), size_(0), allocator_(alloc), index_(), stats_(), spare_(nullptr), spare_count_(0), spare_limit_(0)
             {
-                if(this != &other)
+                try
+                {
+                    append_values(first, last);
+                }
+                catch(...)
                 {
                     clear();
-                    size_ = other.size_;
-                    if(size_)
-                    {
-                        head_ = new Node;
-                        head_->value = other.head_->value;
-                        head_->previous = nullptr;
-                        head_->next = nullptr;
+                    throw;
+                }
+            }
+            ~DoublyLinkedList()
+            {
+                if(size_)
+                    destroy_nodes();
+                release_spare_nodes();
+            }
 
-                        Node * current = head_;
-                        Node * other_current = other.head_;
-                        while(other_current->next)
-                        {
-                            current->next = new Node;
-                            current->next->value = other_current->next->value;
-                            current->next->previous = current;
-                            current->next->next = nullptr;
+            /*!
+             * \brief Get the allocator.
+             * \return A copy of the allocator the nodes are obtained from
+             */
+            Allocator get_allocator() const
+            {
+                return Allocator(allocator_);
+            }
 
-                            current = current->next;
-                            other_current = other_current->next;
-                        }
-                        tail_ = current;
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const
+            {
+                return size_;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the list is empty, `false` otherwise
+             */
+            bool empty() const
+            {
+                return !head_;
+            }
+            /*!
+             * \brief Get the number of nodes owned by the container.
+             * \return The size plus the number of spare nodes
+             */
+            size_t capacity() const
+            {
+                return size_ + spare_count_;
+            }
+            /*!
+             * \brief Make room for a given number of elements, and keep the nodes of the removed elements from then on.
+             * \param[in] count The number of elements to make room for
+             *
+             * Spare nodes are allocated until capacity() reaches \p count. Then up to \p count spare nodes are kept:
+             * the nodes of the removed elements (pop, erase, clear, copy assignment...) are reused by the next insertions instead of being deallocated.
+             * \note Use shrink_to_fit() to deallocate the spare nodes (and stop keeping them).
+             */
+            void reserve(size_t count)
+            {
+                if(spare_limit_ < count)
+                    spare_limit_ = count;
+                if(size_ + spare_count_ < count)
+                {
+                    size_t missing = count - size_ - spare_count_;
+                    reserve_nodes(missing);
+                    SpareNode ** last = &spare_; // keep the allocation order, for the traversal of the next insertions
+                    while(*last)
+                        last = &(*last)->next;
+                    for(; missing; --missing)
+                    {
+                        *last = ::new(static_cast<void*>(NodeAllocatorTraits::allocate(allocator_, 1))) SpareNode{nullptr};
+                        last = &(*last)->next;
+                        ++spare_count_;
+                        stats_.on_allocate();
                     }
                 }
-                return *this;
             }
             /*!
-             * \brief Move assign new contents to the container (replacing the current contents).
-             * \param[in,out] other A DoublyLinkedList of the same type (to move from)
-             * \return A reference to `*this`
+             * \brief Deallocate the spare nodes.
              *
-             * \note The moved DoublyLinkedList will be left empty but still valid.
+             * \note The nodes of the removed elements are deallocated again, until the next call to reserve().
              */
-            DoublyLinkedList<T> & operator=(DoublyLinkedList<T> && other) noexcept
+            void shrink_to_fit() noexcept
             {
-                if(this != &other)
+                release_spare_nodes();
+                spare_limit_ = 0;
+            }
+
+            // Statistics
+            /*!
+             * \brief Get the counters of the container.
+             * \return The node allocations and deallocations, and the walks of the positional access (all zero with NoStats)
+             *
+             * A walk is counted each time an index-based operation (`operator[]`, `at()`, `insert()`, `remove()`, `pop_back()`...) follows links
+             * to reach a position; its length is the number of links followed from the head, the tail or a checkpoint of the index.
+             * \note The counters belong to the container object: they start from zero on construction (copy and move included) and are kept by the assignments.
+             */
+            ListStats stats() const noexcept
+            {
+                return stats_.get();
+            }
+            /*!
+             * \brief Reset the counters of the container to zero.
+             */
+            void reset_stats() noexcept
+            {
+                stats_.reset();
+            }
+            /*!
+             * \brief Check the whole chain against the size, the tail and the `previous` links.
+             * \return `true` if the chain holds `size()` nodes, each one linked back to its predecessor, and ends with the tail, `false` if the container is corrupted
+             *
+             * \note Linear time (at most `size()` links are followed), available in every mode: the hardened mode only runs the constant time checks.
+             */
+            bool validate() const noexcept
+            {
+                const Node * current = head_;
+                const Node * last = nullptr;
+                for(size_t i = 0; i < size_; ++i)
                 {
-                    clear();
-                    head_ = std::exchange(other.head_, nullptr);
-                    tail_ = std::exchange(other.tail_, nullptr);
-                    size_ = std::exchange(other.size_, 0);
+                    if(!current || current->previous != last)
+                        return false;
+                    last = current;
+                    current = current->next;
                 }
-                return *this;
+                return !current && last == tail_;
             }
 
-            // Iterator
+            // Element Access
             /*!
-             * \class Iterator
-             * \brief An iterator implementation.
+             * \brief Get the first element.
+             * \return A direct reference to the head value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
              */
-            class Iterator final
+            T & front()
             {
-                friend class DoublyLinkedList;
+                MANUAL_HARDENED_CHECK(size_, "manual::DoublyLinkedList::front() - The container is empty.");
+                return head_->value;
+            }
+            /*!
+             * \brief Get the first element.
+             * \return A direct `const` reference to the head value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
+             */
+            const T & front() const
+            {
+                MANUAL_HARDENED_CHECK(size_, "manual::DoublyLinkedList::front() - The container is empty.");
+                return head_->value;
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct reference to the tail value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
+             */
+            T & back()
+            {
+                MANUAL_HARDENED_CHECK(size_, "manual::DoublyLinkedList::back() - The container is empty.");
+                return tail_->value;
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct `const` reference to the tail value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
+             */
+            const T & back() const
+            {
+                MANUAL_HARDENED_CHECK(size_, "manual::DoublyLinkedList::back() - The container is empty.");
+                return tail_->value;
+            }
+            /*!
+             * \brief Access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A `const` reference to the element value at the given index
+             *
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour, checked in hardened mode).
+             * \note Iterates over the container (from the closest end or checkpoint of the index) until the index is reached. No direct access.
+             */
+            const T & operator[](size_t index) const
+            {
+                MANUAL_HARDENED_CHECK(index < size_, "manual::DoublyLinkedList::operator[]() - Index out of range.");
+                return node_at(index)->value;
+            }
+            /*!
+             * \brief Access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A reference to the element value at the given index
+             *
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour, checked in hardened mode).
+             * \note Iterates over the container (from the closest end or checkpoint of the index) until the index is reached. No direct access.
+             */
+            T & operator[](size_t index)
+            {
+                return const_cast<T&>(const_cast<const DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> &>(*this)[index]);
+            }
+            /*!
+             * \brief Safely access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A `const` reference to the element value at the given index
+             *
+             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
+             * \note Iterates over the container (from the closest end or checkpoint of the index) until the index is reached. No direct access.
+             */
+            const T & at(size_t index) const
+            {
+                if(index >= size_)
+                    throw std::out_of_range(std::string("[Out of range error] - manual::DoublyLinkedList::at() - (index: ") + std::to_string(index) + ", size: " + std::to_string(size_) + ").");
 
-                private:
-                    Node * node;
+                return (*this)[index];
+            }
+            /*!
+             * \brief Safely access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A reference to the element value at the given index
+             *
+             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
+             * \note Iterates over the container (from the closest end or checkpoint of the index) until the index is reached. No direct access.
+             */
+            T & at(size_t index)
+            {
+                return const_cast<T&>(const_cast<const DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> &>(*this).at(index));
+            }
 
-                public:
-                    /*!
-                     * \brief Default constructor.
-                     *
-                     * \warning Should not be dereferenced (Undefined Behaviour).
-                     */
-                    Iterator() : node(nullptr)
-                    {}
-                    /*!
-                     * \brief Copy constructor.
-                     * \param[in] it The Iterator to copy
-                     */
-                    Iterator(const Iterator & it) : node(it.node)
-                    {}
-                    /*!
-                     * \brief Assignment operator.
-                     * \param[in] other The Iterator to copy
-                     * \return A reference to `*this`
-                     */
-                    Iterator & operator=(const Iterator & other)
-                    {
-                        if(this != &other)
-                        {
-                            node = other.node;
-                        }
-                        return *this;
-                    }
-                    /*!
-                     * \brief Equality operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return `true` if equality, `false` otherwise
-                     */
-                    friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+            // Modifiers
+            /*!
+             * \brief Clear the container.
+             *
+             * \note The nodes are kept as spare nodes up to the count given to reserve() (deallocated otherwise).
+             */
+            void clear() noexcept
+            {
+                if(size_)
+                {
+                    destroy_nodes();
+                    head_ = nullptr;
+                    tail_ = nullptr;
+                    size_ = 0;
+                    index_.on_clear();
+                }
+            }
+            /*!
+             * \brief Replace the contents with the values of a range.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             *
+             * \note The new nodes are created before the old ones are destroyed: the contents are unchanged if an exception is thrown
+             * (and the range can be part of the container).
+             */
+            template <typename InputIt, typename = RequireInputIterator<InputIt>>
+            void assign(InputIt first, InputIt last)
+            {
+                DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> tmp(first, last, get_allocator());
+                clear();
+                splice(cend(), tmp);
+            }
+            /*!
+             * \brief Replace the contents with copies of a value.
+             * \param[in] count The new size
+             * \param[in] val The value to copy (can be an element of the container)
+             *
+             * \note The contents are unchanged if an exception is thrown.
+             */
+            void assign(size_t count, const T & val)
+            {
+                DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> tmp(get_allocator());
+                tmp.reserve_nodes(count);
+                for(size_t i = 0; i < count; ++i)
+                    tmp.emplace_back(val);
+                clear();
+                splice(cend(), tmp);
+            }
+            /*!
+             * \brief Replace the contents with the values of an initializer list.
+             * \param[in] init_list The initializer list to copy
+             */
+            void assign(const std::initializer_list<T> & init_list)
+            {
+                assign(init_list.begin(), init_list.end());
+            }
+            /*!
+             * \brief Add a value at the end of the container.
+             * \param[in] val The value to append
+             */
+            void push_back(const T & val)
+            {
+                emplace_back(val);
+            }
+            /*!
+             * \brief Add a value at the end of the container.
+             * \param[in,out] val The value to append (moved)
+             */
+            void push_back(T && val)
+            {
+                emplace_back(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the end of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_back(Args &&... args)
+            {
+                Node * tmp = create_node(std::forward<Args>(args)...);
+                tmp->next = nullptr;
+                tmp->previous = tail_;
+                if(size_)
+                    tail_->next = tmp;
+                else
+                    head_ = tmp;
+
+                tail_ = tmp;
+                ++size_;
+                index_.on_insert(size_-1, size_);
+                check_links(tmp);
+                check_ends();
+                return tmp->value;
+            }
+            /*!
+             * \brief Add the values of a range at the end of the container.
+             * \param[in] range The values to append (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             *
+             * \note The contents are unchanged if an exception is thrown.
+             */
+            template <typename Range>
+            void append_range(Range && range)
+            {
+                insert_range(cend(), std::forward<Range>(range));
+            }
+            /*!
+             * \brief Add a value at the beginning of the container.
+             * \param[in] val The value to prepend
+             */
+            void push_front(const T & val)
+            {
+                emplace_front(val);
+            }
+            /*!
+             * \brief Add a value at the beginning of the container.
+             * \param[in,out] val The value to prepend (moved)
+             */
+            void push_front(T && val)
+            {
+                emplace_front(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the beginning of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_front(Args &&... args)
+            {
+                Node * tmp = create_node(std::forward<Args>(args)...);
+                tmp->previous = nullptr;
+                tmp->next = head_;
+                if(size_)
+                    head_->previous = tmp;
+                else
+                    tail_ = tmp;
+
+                head_ = tmp;
+                ++size_;
+                index_.on_insert(0, size_);
+                check_links(tmp);
+                check_ends();
+                return tmp->value;
+            }
+            /*!
+             * \brief Remove the last value of the container (if any).
+             */
+            void pop_back() noexcept
+            {
+                if(size_)
+                {
+                    index_.on_erase(size_-1, nullptr);
+                    if(size_ == 1)
                     {
-                        return lhs.node == rhs.node;
+                        destroy_node(tail_);
+                        tail_ = nullptr;
+                        head_ = nullptr;
                     }
-                    /*!
-                     * \brief Inequality operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return `true` if inequality, `false` otherwise
-                     */
-                    friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                    else
                     {
-                        return !(lhs == rhs);
+                        Node * tmp = tail_->previous;
+                        tmp->next = nullptr;
+                        destroy_node(tail_);
+                        tail_ = tmp;
                     }
-                    /*!
-                     * \brief Indirection (dereference) operator.
-                     * \return A reference to the pointed value
-                     *
-                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
-                     */
-                    T & operator*() const
+                    --size_;
+                    check_ends();
+                }
+            }
+            /*!
+             * \brief Remove the first value of the container (if any).
+             */
+            void pop_front() noexcept
+            {
+                if(size_)
+                {
+                    index_.on_erase(0, head_->next);
+                    if(size_ == 1)
                     {
-                        return node->value;
+                        destroy_node(head_);
+                        head_ = nullptr;
+                        tail_ = nullptr;
                     }
-                    /*!
-                     * \brief Member of pointer (dereference) operator.
-                     * \return The address of the pointed value
-                     *
-                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
-                     */
-                    T * operator->() const
+                    else
                     {
-                        return &(node->value);
+                        Node * tmp = head_->next;
+                        tmp->previous = nullptr;
+                        destroy_node(head_);
+                        head_ = tmp;
                     }
-                    /*!
-                     * \brief Prefix increment operator.
-                     * \return A reference to the incremented `*this`
-                     *
-                     * Shift to the next element.
-                     */
-                    Iterator & operator++() //prefix
+                    --size_;
+                    check_ends();
+                }
+            }
+            /*!
+             * \brief Insert a value at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in] val The element to be inserted
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            void insert(size_t index, const T & val)
+            {
+                emplace(index, val);
+            }
+            /*!
+             * \brief Insert a value at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in,out] val The element to be inserted (moved)
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            void insert(size_t index, T && val)
+            {
+                emplace(index, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in] args The arguments to construct the value from
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            template <typename... Args>
+            void emplace(size_t index, Args &&... args)
+            {
+                if(index <= size_)
+                {
+                    if(index == 0)
                     {
-                        if(node)
-                            node = node->next;
-                        return *this;
+                        emplace_front(std::forward<Args>(args)...);
                     }
-                    /*!
-                     * \brief Postfix increment operator.
-                     * \return The before-increment Iterator
-                     *
-                     * Shift to the next element.
-                     */
-                    Iterator operator++(int) //postfix
+                    else if(index == size_)
                     {
-                        Iterator tmp(*this);
-                        ++(*this);
-                        return tmp;
+                        emplace_back(std::forward<Args>(args)...);
                     }
-                    /*!
-                     * \brief Addition assignment operator.
-                     * \param[in] rhs The right-hand side
-                     * \return A reference to `*this`
-                     *
-                     * Increment the Iterator `rhs` times.
-                     */
-                    Iterator & operator+=(size_t rhs)
+                    else
                     {
-                        for(size_t i = 0; i < rhs; ++i)
-                        {
-                            ++(*this);
-                        }
-                        return *this;
+                        Node * tmp = create_node(std::forward<Args>(args)...);
+
+                        Node * current = node_at(index);
+                        current->previous->next = tmp;
+                        tmp->previous = current->previous;
+                        tmp->next = current;
+                        current->previous = tmp;
+                        ++size_;
+                        index_.on_insert(index, size_);
+                        check_links(tmp);
+                        check_ends();
                     }
-                    /*!
-                     * \brief Addition operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return The resulting Iterator
-                     *
-                     * Increment `lhs` by `rhs`.
-                     */
-                    friend Iterator operator+(Iterator lhs, size_t rhs)
+                }
+            }
+            /*!
+             * \brief Remove the element at the given index.
+             * \param[in] index The position of the element to remove
+             *
+             * \note Does nothing if the index is out-of-range or if the container is empty.
+             */
+            void remove(size_t index) noexcept
+            {
+                if(index < size_)
+                {
+                    if(index == 0)
                     {
-                        lhs += rhs;
-                        return lhs;
+                        pop_front();
                     }
-                    /*!
-                     * \brief Addition operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return The resulting Iterator
-                     *
-                     * Increment `rhs` by `lhs`.
-                     */
-                    friend Iterator operator+(size_t lhs, Iterator rhs)
+                    else if(index == size_-1)
                     {
-                        return rhs + lhs;
+                        pop_back();
                     }
-                    /*!
-                     * \brief Prefix decrement operator.
-                     * \return A reference to the decremented `*this`
-                     *
-                     * Shift to the previous element.
-                     */
-                    Iterator & operator--() //prefix
+                    else
                     {
-                        if(node)
-                            node = node->previous;
-                        return *this;
-                    }
-                    /*!
-                     * \brief Postfix decrement operator.
-                     * \return The before-decrement Iterator
-                     *
-                     * Shift to the previous element.
-                     */
-                    Iterator operator--(int) //postfix
-                    {
-                        Iterator tmp(*this);
-                        --(*this);
-                        return tmp;
-                    }
-                    /*!
-                     * \brief Subtraction assignment operator.
-                     * \param[in] rhs The right-hand side
-                     * \return A reference to `*this`
-                     *
-                     * Decrement the Iterator `rhs` times.
-                     */
-                    Iterator & operator-=(size_t rhs)
-                    {
-                        for(size_t i = 0; i < rhs; ++i)
-                        {
-                            --(*this);
-                        }
-                        return *this;
-                    }
-                    /*!
-                     * \brief Subtraction operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return The resulting Iterator
-                     *
-                     * Decrement `lhs` by `rhs`.
-                     */
-                    friend Iterator operator-(Iterator lhs, size_t rhs)
-                    {
-                        lhs -= rhs;
-                        return lhs;
-                    }
-                    /*!
-                     * \brief Subtraction operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return The resulting Iterator
-                     *
-                     * Decrement `rhs` by `lhs`.
-                     */
-                    friend Iterator operator-(size_t lhs, Iterator rhs)
-                    {
-                        return rhs - lhs;
+                        Node * current = node_at(index);
+                        index_.on_erase(index, current->next);
+                        current->previous->next = current->next;
+                        current->next->previous = current->previous;
+                        check_links(current->previous);
+                        destroy_node(current);
+                        --size_;
+                        check_ends();
                     }
-            };
+                }
+            }
+
+            // Operators
             /*!
-             * \class ConstIterator
-             * \brief A `const` iterator implementation.
+             * \brief Copy assign new contents to the container (replacing the current contents).
+             * \param other A DoublyLinkedList of the same type (to copy)
+             * \return A reference to `*this`
+             *
+             * \note The existing nodes are reused: the values are copy-assigned in place, and only the size difference is allocated or destroyed.
+             * \warning If a copy throws, the container holds a part of the copied values.
              */
-            class ConstIterator final
+            DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & operator=(const DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other)
+            {
+                if(this != &other)
+                {
+                    copy_allocator(other, typename NodeAllocatorTraits::propagate_on_container_copy_assignment());
+
+                    Node * current = head_;
+                    const Node * other_current = other.head_;
+                    for(; current && other_current; current = current->next, other_current = other_current->next)
+                        current->value = other_current->value;
+                    while(current)
+                        current = erase_node(current);
+                    for(; other_current; other_current = other_current->next)
+                        emplace_back(other_current->value);
+                }
+                return *this;
+            }
+            /*!
+             * \brief Move assign new contents to the container (replacing the current contents).
+             * \param[in,out] other A DoublyLinkedList of the same type (to move from)
+             * \return A reference to `*this`
+             *
+             * \note The moved DoublyLinkedList will be left empty but still valid.
+             * \note If the allocator does not follow the moved content and both allocators are not equal, the values are moved one by one.
+             */
+            DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & operator=(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept(NodeAllocatorTraits::propagate_on_container_move_assignment::value)
+            {
+                if(this != &other)
+                {
+                    clear();
+                    move_from(other, typename NodeAllocatorTraits::propagate_on_container_move_assignment());
+                }
+                return *this;
+            }
+
+            // Iterator
+            /*!
+             * \class Iterator
+             * \brief An iterator implementation.
+             */
+            class Iterator final : private Position
             {
                 friend class DoublyLinkedList;
 
                 private:
-                    Node * node;
+                    iterator_link_t<Node> node;
+                    const DoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another Iterator.
+                     * \param[in] last The Iterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const Iterator & last) const
+                    {
+                        if(list && node == list->head_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = current->next)
+                            ++res;
+                        return res;
+                    }
 
                 public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                       /*!< The pointer to a pointed value */
+                    typedef T & reference;                                     /*!< The reference to a pointed value */
+
                     /*!
                      * \brief Default constructor.
                      *
                      * \warning Should not be dereferenced (Undefined Behaviour).
                      */
-                    ConstIterator() : node(nullptr)
+                    Iterator() : node(nullptr), list(nullptr)
                     {}
                     /*!
                      * \brief Copy constructor.
-                     * \param[in] cit The ConstIterator to copy
+                     * \param[in] it The Iterator to copy
                      */
-                    ConstIterator(const ConstIterator & cit) : node(cit.node)
+                    Iterator(const Iterator & it) : Position(it), node(it.node), list(it.list)
                     {}
                     /*!
                      * \brief Assignment operator.
-                     * \param[in] other The ConstIterator to copy
+                     * \param[in] other The Iterator to copy
                      * \return A reference to `*this`
                      */
-                    ConstIterator & operator=(const ConstIterator & other)
+                    Iterator & operator=(const Iterator & other)
                     {
                         if(this != &other)
                         {
+                            Position::operator=(other);
                             node = other.node;
+                            list = other.list;
                         }
                         return *this;
                     }
                     /*!
                      * \brief Equality operator.
                      * \param[in] lhs The left-hand side
-                     * \param[in] rhs The reight-hand side
+                     * \param[in] rhs The right-hand side
                      * \return `true` if equality, `false` otherwise
                      */
-                    friend bool operator==(const ConstIterator & lhs, const ConstIterator & rhs)
+                    friend bool operator==(const Iterator & lhs, const Iterator & rhs)
                     {
                         return lhs.node == rhs.node;
                     }
@@ -765,27 +1341,27 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return `true` if inequality, `false` otherwise
                      */
-                    friend bool operator!=(const ConstIterator & lhs, const ConstIterator & rhs)
+                    friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
                     {
                         return !(lhs == rhs);
                     }
                     /*!
                      * \brief Indirection (dereference) operator.
-                     * \return A `const` reference to the pointed value
+                     * \return A reference to the pointed value
                      *
-                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
                      */
-                    const T & operator*() const
+                    T & operator*() const
                     {
                         return node->value;
                     }
                     /*!
                      * \brief Member of pointer (dereference) operator.
-                     * \return The address of the pointed value as `const`
+                     * \return The address of the pointed value
                      *
-                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
                      */
-                    const T * operator->() const
+                    T * operator->() const
                     {
                         return &(node->value);
                     }
@@ -795,21 +1371,25 @@ namespace manual
                      *
                      * Shift to the next element.
                      */
-                    ConstIterator & operator++() //prefix
+                    Iterator & operator++() //prefix
                     {
                         if(node)
+                        {
+                            DoublyLinkedList::check_links(node);
                             node = node->next;
+                            this->step_forward();
+                        }
                         return *this;
                     }
                     /*!
                      * \brief Postfix increment operator.
-                     * \return The before-increment ConstIterator
+                     * \return The before-increment Iterator
                      *
                      * Shift to the next element.
                      */
-                    ConstIterator operator++(int) //postfix
+                    Iterator operator++(int) //postfix
                     {
-                        ConstIterator tmp(*this);
+                        Iterator tmp(*this);
                         ++(*this);
                         return tmp;
                     }
@@ -818,10 +1398,24 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return A reference to `*this`
                      *
-                     * Increment the ConstIterator `rhs` times.
+                     * Increment the Iterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
                      */
-                    ConstIterator & operator+=(size_t rhs)
+                    Iterator & operator+=(size_t rhs)
                     {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && node && rhs >= indexed->index_.jump_distance())
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, (rhs < indexed->size_ - position) ? position + rhs : indexed->size_))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
                         for(size_t i = 0; i < rhs; ++i)
                         {
                             ++(*this);
@@ -832,11 +1426,11 @@ namespace manual
                      * \brief Addition operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ConstIterator
+                     * \return The resulting Iterator
                      *
                      * Increment `lhs` by `rhs`.
                      */
-                    friend ConstIterator operator+(ConstIterator lhs, size_t rhs)
+                    friend Iterator operator+(Iterator lhs, size_t rhs)
                     {
                         lhs += rhs;
                         return lhs;
@@ -845,11 +1439,11 @@ namespace manual
                      * \brief Addition operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ConstIterator
+                     * \return The resulting Iterator
                      *
                      * Increment `rhs` by `lhs`.
                      */
-                    friend ConstIterator operator+(size_t lhs, ConstIterator rhs)
+                    friend Iterator operator+(size_t lhs, Iterator rhs)
                     {
                         return rhs + lhs;
                     }
@@ -858,22 +1452,33 @@ namespace manual
                      * \return A reference to the decremented `*this`
                      *
                      * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ Iterator of a container refers to its last element.
                      */
-                    ConstIterator & operator--() //prefix
+                    Iterator & operator--() //prefix
                     {
                         if(node)
+                        {
+                            DoublyLinkedList::check_links(node);
                             node = node->previous;
+                            this->step_backward();
+                        }
+                        else if(list)
+                        {
+                            node = list->tail_;
+                            this->step_backward();
+                        }
                         return *this;
                     }
                     /*!
                      * \brief Postfix decrement operator.
-                     * \return The before-decrement ConstIterator
+                     * \return The before-decrement Iterator
                      *
                      * Shift to the previous element.
                      */
-                    ConstIterator operator--(int) //postfix
+                    Iterator operator--(int) //postfix
                     {
-                        ConstIterator tmp(*this);
+                        Iterator tmp(*this);
                         --(*this);
                         return tmp;
                     }
@@ -882,10 +1487,24 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return A reference to `*this`
                      *
-                     * Decrement the ConstIterator `rhs` times.
+                     * Decrement the Iterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
                      */
-                    ConstIterator & operator-=(size_t rhs)
+                    Iterator & operator-=(size_t rhs)
                     {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && rhs >= indexed->index_.jump_distance() && rhs <= this->cached_position() && this->cached_position() <= indexed->size_)
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, position - rhs))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
                         for(size_t i = 0; i < rhs; ++i)
                         {
                             --(*this);
@@ -896,11 +1515,11 @@ namespace manual
                      * \brief Subtraction operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ConstIterator
+                     * \return The resulting Iterator
                      *
                      * Decrement `lhs` by `rhs`.
                      */
-                    friend ConstIterator operator-(ConstIterator lhs, size_t rhs)
+                    friend Iterator operator-(Iterator lhs, size_t rhs)
                     {
                         lhs -= rhs;
                         return lhs;
@@ -909,60 +1528,131 @@ namespace manual
                      * \brief Subtraction operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ConstIterator
+                     * \return The resulting Iterator
                      *
                      * Decrement `rhs` by `lhs`.
                      */
-                    friend ConstIterator operator-(size_t lhs, ConstIterator rhs)
+                    friend Iterator operator-(size_t lhs, Iterator rhs)
                     {
                         return rhs - lhs;
                     }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first Iterator
+                     * \param[in] last The Iterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const Iterator & first, const Iterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+                    /*!
+                     * \brief Get the Iterator following another one by a given number of elements.
+                     * \param[in] it The Iterator to start from
+                     * \param[in] n The number of increments (decrements if negative)
+                     * \return The resulting Iterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::next; next(it, n);`) jumps with the index of an indexed list, like `it + n`.
+                     * `std::next()` always walks.
+                     */
+                    friend Iterator next(Iterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it -= static_cast<size_t>(-n);
+                        else
+                            it += static_cast<size_t>(n);
+                        return it;
+                    }
+                    /*!
+                     * \brief Get the Iterator preceding another one by a given number of elements.
+                     * \param[in] it The Iterator to start from
+                     * \param[in] n The number of decrements (increments if negative)
+                     * \return The resulting Iterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::prev; prev(it, n);`) jumps with the index of an indexed list, like `it - n`.
+                     * `std::prev()` always walks.
+                     */
+                    friend Iterator prev(Iterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it += static_cast<size_t>(-n);
+                        else
+                            it -= static_cast<size_t>(n);
+                        return it;
+                    }
             };
             /*!
-             * \class ReverseIterator
-             * \brief A reverse iterator implementation.
+             * \class ConstIterator
+             * \brief A `const` iterator implementation.
              */
-            class ReverseIterator final
+            class ConstIterator final : private Position
             {
                 friend class DoublyLinkedList;
 
                 private:
-                    Node * node;
+                    iterator_link_t<Node> node;
+                    const DoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ConstIterator.
+                     * \param[in] last The ConstIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ConstIterator & last) const
+                    {
+                        if(list && node == list->head_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = current->next)
+                            ++res;
+                        return res;
+                    }
 
                 public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef const T & reference;                               /*!< The reference to a pointed value */
+
                     /*!
-                     * \brief default constructor.
+                     * \brief Default constructor.
                      *
                      * \warning Should not be dereferenced (Undefined Behaviour).
                      */
-                    ReverseIterator() : node(nullptr)
+                    ConstIterator() : node(nullptr), list(nullptr)
                     {}
                     /*!
                      * \brief Copy constructor.
-                     * \param[in] rit The ReverseIterator to copy
+                     * \param[in] cit The ConstIterator to copy
                      */
-                    ReverseIterator(const ReverseIterator & rit) : node(rit.node)
+                    ConstIterator(const ConstIterator & cit) : Position(cit), node(cit.node), list(cit.list)
                     {}
                     /*!
                      * \brief Assignment operator.
-                     * \param[in] other The ReverseIterator to copy
+                     * \param[in] other The ConstIterator to copy
                      * \return A reference to `*this`
                      */
-                    ReverseIterator & operator=(const ReverseIterator & other)
+                    ConstIterator & operator=(const ConstIterator & other)
                     {
                         if(this != &other)
                         {
+                            Position::operator=(other);
                             node = other.node;
+                            list = other.list;
                         }
                         return *this;
                     }
                     /*!
                      * \brief Equality operator.
                      * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
+                     * \param[in] rhs The reight-hand side
                      * \return `true` if equality, `false` otherwise
                      */
-                    friend bool operator==(const ReverseIterator & lhs, const ReverseIterator & rhs)
+                    friend bool operator==(const ConstIterator & lhs, const ConstIterator & rhs)
                     {
                         return lhs.node == rhs.node;
                     }
@@ -972,27 +1662,27 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return `true` if inequality, `false` otherwise
                      */
-                    friend bool operator!=(const ReverseIterator & lhs, const ReverseIterator & rhs)
+                    friend bool operator!=(const ConstIterator & lhs, const ConstIterator & rhs)
                     {
                         return !(lhs == rhs);
                     }
                     /*!
                      * \brief Indirection (dereference) operator.
-                     * \return A reference to the pointed value
+                     * \return A `const` reference to the pointed value
                      *
-                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
                      */
-                    T & operator*() const
+                    const T & operator*() const
                     {
                         return node->value;
                     }
                     /*!
                      * \brief Member of pointer (dereference) operator.
-                     * \return The address of the pointed value
+                     * \return The address of the pointed value as `const`
                      *
-                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
                      */
-                    T * operator->() const
+                    const T * operator->() const
                     {
                         return &(node->value);
                     }
@@ -1000,23 +1690,27 @@ namespace manual
                      * \brief Prefix increment operator.
                      * \return A reference to the incremented `*this`
                      *
-                     * Shift to the previous element.
+                     * Shift to the next element.
                      */
-                    ReverseIterator & operator++() //prefix
+                    ConstIterator & operator++() //prefix
                     {
                         if(node)
-                            node = node->previous;
+                        {
+                            DoublyLinkedList::check_links(node);
+                            node = node->next;
+                            this->step_forward();
+                        }
                         return *this;
                     }
                     /*!
                      * \brief Postfix increment operator.
-                     * \return The before-increment ReverseIterator
+                     * \return The before-increment ConstIterator
                      *
-                     * Shift to the previous element.
+                     * Shift to the next element.
                      */
-                    ReverseIterator operator++(int) //postfix
+                    ConstIterator operator++(int) //postfix
                     {
-                        ReverseIterator tmp(*this);
+                        ConstIterator tmp(*this);
                         ++(*this);
                         return tmp;
                     }
@@ -1025,10 +1719,24 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return A reference to `*this`
                      *
-                     * Increment the ReverseIterator `rhs` times.
+                     * Increment the ConstIterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
                      */
-                    ReverseIterator & operator+=(size_t rhs)
+                    ConstIterator & operator+=(size_t rhs)
                     {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && node && rhs >= indexed->index_.jump_distance())
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, (rhs < indexed->size_ - position) ? position + rhs : indexed->size_))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
                         for(size_t i = 0; i < rhs; ++i)
                         {
                             ++(*this);
@@ -1039,11 +1747,11 @@ namespace manual
                      * \brief Addition operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ReverseIterator
+                     * \return The resulting ConstIterator
                      *
                      * Increment `lhs` by `rhs`.
                      */
-                    friend ReverseIterator operator+(ReverseIterator lhs, size_t rhs)
+                    friend ConstIterator operator+(ConstIterator lhs, size_t rhs)
                     {
                         lhs += rhs;
                         return lhs;
@@ -1052,11 +1760,11 @@ namespace manual
                      * \brief Addition operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ReverseIterator
+                     * \return The resulting ConstIterator
                      *
                      * Increment `rhs` by `lhs`.
                      */
-                    friend ReverseIterator operator+(size_t lhs, ReverseIterator rhs)
+                    friend ConstIterator operator+(size_t lhs, ConstIterator rhs)
                     {
                         return rhs + lhs;
                     }
@@ -1064,23 +1772,34 @@ namespace manual
                      * \brief Prefix decrement operator.
                      * \return A reference to the decremented `*this`
                      *
-                     * Shift to the next element.
+                     * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ ConstIterator of a container refers to its last element.
                      */
-                    ReverseIterator & operator--() //prefix
+                    ConstIterator & operator--() //prefix
                     {
                         if(node)
-                            node = node->next;
+                        {
+                            DoublyLinkedList::check_links(node);
+                            node = node->previous;
+                            this->step_backward();
+                        }
+                        else if(list)
+                        {
+                            node = list->tail_;
+                            this->step_backward();
+                        }
                         return *this;
                     }
                     /*!
                      * \brief Postfix decrement operator.
-                     * \return The before-decrement ReverseIterator
+                     * \return The before-decrement ConstIterator
                      *
-                     * Shift to the next element.
+                     * Shift to the previous element.
                      */
-                    ReverseIterator operator--(int) //postfix
+                    ConstIterator operator--(int) //postfix
                     {
-                        ReverseIterator tmp(*this);
+                        ConstIterator tmp(*this);
                         --(*this);
                         return tmp;
                     }
@@ -1089,10 +1808,24 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return A reference to `*this`
                      *
-                     * Decrement the ReverseIterator `rhs` times.
+                     * Decrement the ConstIterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
                      */
-                    ReverseIterator & operator-=(size_t rhs)
+                    ConstIterator & operator-=(size_t rhs)
                     {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && rhs >= indexed->index_.jump_distance() && rhs <= this->cached_position() && this->cached_position() <= indexed->size_)
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, position - rhs))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
                         for(size_t i = 0; i < rhs; ++i)
                         {
                             --(*this);
@@ -1103,11 +1836,11 @@ namespace manual
                      * \brief Subtraction operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ReverseIterator
+                     * \return The resulting ConstIterator
                      *
                      * Decrement `lhs` by `rhs`.
                      */
-                    friend ReverseIterator operator-(ReverseIterator lhs, size_t rhs)
+                    friend ConstIterator operator-(ConstIterator lhs, size_t rhs)
                     {
                         lhs -= rhs;
                         return lhs;
@@ -1116,50 +1849,121 @@ namespace manual
                      * \brief Subtraction operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ReverseIterator
+                     * \return The resulting ConstIterator
                      *
                      * Decrement `rhs` by `lhs`.
                      */
-                    friend ReverseIterator operator-(size_t lhs, ReverseIterator rhs)
+                    friend ConstIterator operator-(size_t lhs, ConstIterator rhs)
                     {
                         return rhs - lhs;
                     }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ConstIterator
+                     * \param[in] last The ConstIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ConstIterator & first, const ConstIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+                    /*!
+                     * \brief Get the ConstIterator following another one by a given number of elements.
+                     * \param[in] it The ConstIterator to start from
+                     * \param[in] n The number of increments (decrements if negative)
+                     * \return The resulting ConstIterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::next; next(it, n);`) jumps with the index of an indexed list, like `it + n`.
+                     * `std::next()` always walks.
+                     */
+                    friend ConstIterator next(ConstIterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it -= static_cast<size_t>(-n);
+                        else
+                            it += static_cast<size_t>(n);
+                        return it;
+                    }
+                    /*!
+                     * \brief Get the ConstIterator preceding another one by a given number of elements.
+                     * \param[in] it The ConstIterator to start from
+                     * \param[in] n The number of decrements (increments if negative)
+                     * \return The resulting ConstIterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::prev; prev(it, n);`) jumps with the index of an indexed list, like `it - n`.
+                     * `std::prev()` always walks.
+                     */
+                    friend ConstIterator prev(ConstIterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it += static_cast<size_t>(-n);
+                        else
+                            it -= static_cast<size_t>(n);
+                        return it;
+                    }
             };
             /*!
-             * \class ConstReverseIterator
-             * \brief A `const` reverse iterator implementation.
+             * \class ReverseIterator
+             * \brief A reverse iterator implementation.
              */
-            class ConstReverseIterator final
+            class ReverseIterator final : private Position
             {
                 friend class DoublyLinkedList;
 
                 private:
-                    Node * node;
+                    iterator_link_t<Node> node;
+                    const DoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ReverseIterator.
+                     * \param[in] last The ReverseIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ReverseIterator & last) const
+                    {
+                        if(list && node == list->tail_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = current->previous)
+                            ++res;
+                        return res;
+                    }
 
                 public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                       /*!< The pointer to a pointed value */
+                    typedef T & reference;                                     /*!< The reference to a pointed value */
+
                     /*!
-                     * \brief Default constructor.
+                     * \brief default constructor.
                      *
                      * \warning Should not be dereferenced (Undefined Behaviour).
                      */
-                    ConstReverseIterator() : node(nullptr)
+                    ReverseIterator() : node(nullptr), list(nullptr)
                     {}
                     /*!
                      * \brief Copy constructor.
-                     * \param[in] crit The ConstReverseIterator to copy
+                     * \param[in] rit The ReverseIterator to copy
                      */
-                    ConstReverseIterator(const ConstReverseIterator & crit) : node(crit.node)
+                    ReverseIterator(const ReverseIterator & rit) : Position(rit), node(rit.node), list(rit.list)
                     {}
                     /*!
                      * \brief Assignment operator.
-                     * \param[in] other The ConstReverseIterator to copy
+                     * \param[in] other The ReverseIterator to copy
                      * \return A reference to `*this`
                      */
-                    ConstReverseIterator & operator=(const ConstReverseIterator & other)
+                    ReverseIterator & operator=(const ReverseIterator & other)
                     {
                         if(this != &other)
                         {
+                            Position::operator=(other);
                             node = other.node;
+                            list = other.list;
                         }
                         return *this;
                     }
@@ -1169,7 +1973,7 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return `true` if equality, `false` otherwise
                      */
-                    friend bool operator==(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    friend bool operator==(const ReverseIterator & lhs, const ReverseIterator & rhs)
                     {
                         return lhs.node == rhs.node;
                     }
@@ -1179,27 +1983,27 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return `true` if inequality, `false` otherwise
                      */
-                    friend bool operator!=(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    friend bool operator!=(const ReverseIterator & lhs, const ReverseIterator & rhs)
                     {
                         return !(lhs == rhs);
                     }
                     /*!
                      * \brief Indirection (dereference) operator.
-                     * \return A `const` reference to the pointed value
+                     * \return A reference to the pointed value
                      *
-                     * \note Dereference an out-of-range ConstReverseIterator is Undefined Behaviour.
+                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
                      */
-                    const T & operator*() const
+                    T & operator*() const
                     {
                         return node->value;
                     }
                     /*!
                      * \brief Member of pointer (dereference) operator.
-                     * \return The address of the pointed value as `const`
+                     * \return The address of the pointed value
                      *
-                     * \note Dereference an out-of-range ConstReverseIterator is undefined Behaviour.
+                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
                      */
-                    const T * operator->() const
+                    T * operator->() const
                     {
                         return &(node->value);
                     }
@@ -1209,21 +2013,25 @@ namespace manual
                      *
                      * Shift to the previous element.
                      */
-                    ConstReverseIterator & operator++() //prefix
+                    ReverseIterator & operator++() //prefix
                     {
                         if(node)
+                        {
+                            DoublyLinkedList::check_links(node);
                             node = node->previous;
+                            this->step_backward();
+                        }
                         return *this;
                     }
                     /*!
                      * \brief Postfix increment operator.
-                     * \return The before-increment ConstReverseIterator
+                     * \return The before-increment ReverseIterator
                      *
                      * Shift to the previous element.
                      */
-                    ConstReverseIterator operator++(int) //postfix
+                    ReverseIterator operator++(int) //postfix
                     {
-                        ConstReverseIterator tmp(*this);
+                        ReverseIterator tmp(*this);
                         ++(*this);
                         return tmp;
                     }
@@ -1232,10 +2040,24 @@ namespace manual
                      * \param[in] rhs The right-hand side
                      * \return A reference to `*this`
                      *
-                     * Increment the ConstReverseIterator `rhs` times.
+                     * Increment the ReverseIterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
                      */
-                    ConstReverseIterator & operator+=(size_t rhs)
+                    ReverseIterator & operator+=(size_t rhs)
                     {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && node && rhs >= indexed->index_.jump_distance())
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, (rhs <= position) ? position - rhs : static_cast<size_t>(-1)))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
                         for(size_t i = 0; i < rhs; ++i)
                         {
                             ++(*this);
@@ -1246,11 +2068,11 @@ namespace manual
                      * \brief Addition operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ConstReverseIterator
+                     * \return The resulting ReverseIterator
                      *
                      * Increment `lhs` by `rhs`.
                      */
-                    friend ConstReverseIterator operator+(ConstReverseIterator lhs, size_t rhs)
+                    friend ReverseIterator operator+(ReverseIterator lhs, size_t rhs)
                     {
                         lhs += rhs;
                         return lhs;
@@ -1259,11 +2081,11 @@ namespace manual
                      * \brief Addition operator.
                      * \param[in] lhs The left-hand side
                      * \param[in] rhs The right-hand side
-                     * \return The resulting ConstReverseIterator
+                     * \return The resulting ReverseIterator
                      *
                      * Increment `rhs` by `lhs`.
                      */
-                    friend ConstReverseIterator operator+(size_t lhs, ConstReverseIterator rhs)
+                    friend ReverseIterator operator+(size_t lhs, ReverseIterator rhs)
                     {
                         return rhs + lhs;
                     }
@@ -1272,182 +2094,1546 @@ namespace manual
                      * \return A reference to the decremented `*this`
                      *
                      * Shift to the next element.
+                     *
+                     * \note Decrementing the _past-the-end_ ReverseIterator of a container refers to its last element.
                      */
-                    ConstReverseIterator & operator--() //prefix
+                    ReverseIterator & operator--() //prefix
                     {
                         if(node)
+                        {
+                            DoublyLinkedList::check_links(node);
                             node = node->next;
+                            this->step_forward();
+                        }
+                        else if(list)
+                        {
+                            node = list->head_;
+                            this->step_forward();
+                        }
                         return *this;
                     }
                     /*!
                      * \brief Postfix decrement operator.
-                     * \return The before-decrement ConstReverseIterator
+                     * \return The before-decrement ReverseIterator
                      *
                      * Shift to the next element.
                      */
-                    ConstReverseIterator operator--(int) //postfix
+                    ReverseIterator operator--(int) //postfix
+                    {
+                        ReverseIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ReverseIterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
+                     */
+                    ReverseIterator & operator-=(size_t rhs)
+                    {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && rhs >= indexed->index_.jump_distance() && rhs <= indexed->size_ - this->cached_position())
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, position + rhs))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ReverseIterator operator-(ReverseIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ReverseIterator operator-(size_t lhs, ReverseIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ReverseIterator
+                     * \param[in] last The ReverseIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ReverseIterator & first, const ReverseIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+                    /*!
+                     * \brief Get the ReverseIterator following another one by a given number of elements.
+                     * \param[in] it The ReverseIterator to start from
+                     * \param[in] n The number of increments (decrements if negative)
+                     * \return The resulting ReverseIterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::next; next(it, n);`) jumps with the index of an indexed list, like `it + n`.
+                     * `std::next()` always walks.
+                     */
+                    friend ReverseIterator next(ReverseIterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it -= static_cast<size_t>(-n);
+                        else
+                            it += static_cast<size_t>(n);
+                        return it;
+                    }
+                    /*!
+                     * \brief Get the ReverseIterator preceding another one by a given number of elements.
+                     * \param[in] it The ReverseIterator to start from
+                     * \param[in] n The number of decrements (increments if negative)
+                     * \return The resulting ReverseIterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::prev; prev(it, n);`) jumps with the index of an indexed list, like `it - n`.
+                     * `std::prev()` always walks.
+                     */
+                    friend ReverseIterator prev(ReverseIterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it += static_cast<size_t>(-n);
+                        else
+                            it -= static_cast<size_t>(n);
+                        return it;
+                    }
+            };
+            /*!
+             * \class ConstReverseIterator
+             * \brief A `const` reverse iterator implementation.
+             */
+            class ConstReverseIterator final : private Position
+            {
+                friend class DoublyLinkedList;
+
+                private:
+                    iterator_link_t<Node> node;
+                    const DoublyLinkedList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ConstReverseIterator.
+                     * \param[in] last The ConstReverseIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ConstReverseIterator & last) const
+                    {
+                        if(list && node == list->tail_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = current->previous)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef const T & reference;                               /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstReverseIterator() : node(nullptr), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] crit The ConstReverseIterator to copy
+                     */
+                    ConstReverseIterator(const ConstReverseIterator & crit) : Position(crit), node(crit.node), list(crit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ConstReverseIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ConstReverseIterator & operator=(const ConstReverseIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            Position::operator=(other);
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstReverseIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return node->value;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value as `const`
+                     *
+                     * \note Dereference an out-of-range ConstReverseIterator is undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return &(node->value);
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstReverseIterator & operator++() //prefix
+                    {
+                        if(node)
+                        {
+                            DoublyLinkedList::check_links(node);
+                            node = node->previous;
+                            this->step_backward();
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstReverseIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstReverseIterator operator++(int) //postfix
+                    {
+                        ConstReverseIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ConstReverseIterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
+                     */
+                    ConstReverseIterator & operator+=(size_t rhs)
+                    {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && node && rhs >= indexed->index_.jump_distance())
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, (rhs <= position) ? position - rhs : static_cast<size_t>(-1)))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ConstReverseIterator operator+(ConstReverseIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ConstReverseIterator operator+(size_t lhs, ConstReverseIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the next element.
+                     *
+                     * \note Decrementing the _past-the-end_ ConstReverseIterator of a container refers to its last element.
+                     */
+                    ConstReverseIterator & operator--() //prefix
+                    {
+                        if(node)
+                        {
+                            DoublyLinkedList::check_links(node);
+                            node = node->next;
+                            this->step_forward();
+                        }
+                        else if(list)
+                        {
+                            node = list->head_;
+                            this->step_forward();
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ConstReverseIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstReverseIterator operator--(int) //postfix
+                    {
+                        ConstReverseIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ConstReverseIterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
+                     */
+                    ConstReverseIterator & operator-=(size_t rhs)
+                    {
+                        const DoublyLinkedList * indexed = this->indexed_list();
+                        if(indexed && rhs >= indexed->index_.jump_distance() && rhs <= indexed->size_ - this->cached_position())
+                        {
+                            size_t & position = this->cached_position();
+                            Node * target = node;
+                            if(indexed->jump(target, position, position + rhs))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ConstReverseIterator operator-(ConstReverseIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ConstReverseIterator operator-(size_t lhs, ConstReverseIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ConstReverseIterator
+                     * \param[in] last The ConstReverseIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ConstReverseIterator & first, const ConstReverseIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+                    /*!
+                     * \brief Get the ConstReverseIterator following another one by a given number of elements.
+                     * \param[in] it The ConstReverseIterator to start from
+                     * \param[in] n The number of increments (decrements if negative)
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::next; next(it, n);`) jumps with the index of an indexed list, like `it + n`.
+                     * `std::next()` always walks.
+                     */
+                    friend ConstReverseIterator next(ConstReverseIterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it -= static_cast<size_t>(-n);
+                        else
+                            it += static_cast<size_t>(n);
+                        return it;
+                    }
+                    /*!
+                     * \brief Get the ConstReverseIterator preceding another one by a given number of elements.
+                     * \param[in] it The ConstReverseIterator to start from
+                     * \param[in] n The number of decrements (increments if negative)
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::prev; prev(it, n);`) jumps with the index of an indexed list, like `it - n`.
+                     * `std::prev()` always walks.
+                     */
+                    friend ConstReverseIterator prev(ConstReverseIterator it, difference_type n = 1)
+                    {
+                        if(n < 0)
+                            it += static_cast<size_t>(-n);
+                        else
+                            it -= static_cast<size_t>(n);
+                        return it;
+                    }
+            };
+
+            // Standard container types
+            typedef T value_type;                                /*!< The type of the elements */
+            typedef T & reference;                               /*!< The reference to an element */
+            typedef const T & const_reference;                   /*!< The `const` reference to an element */
+            typedef size_t size_type;                            /*!< The type of the sizes and indexes */
+            typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+            typedef Iterator iterator;                           /*!< The iterator type */
+            typedef ConstIterator const_iterator;                /*!< The `const` iterator type */
+            typedef ReverseIterator reverse_iterator;            /*!< The reverse iterator type */
+            typedef ConstReverseIterator const_reverse_iterator; /*!< The `const` reverse iterator type */
+            typedef Allocator allocator_type;                    /*!< The allocator type */
+
+            /*!
+             * \brief Get an iterator referring to the first element.
+             * \return An iterator
+             */
+            Iterator begin()
+            {
+                Iterator it;
+                it.node = head_;
+                it.list = this;
+                it.remember(this, 0);
+                return it;
+            }
+            /*!
+             * \brief Get an iterator referring to the _past-the-end_ element.
+             * \return An iterator
+             */
+            Iterator end()
+            {
+                Iterator it;
+                it.node = nullptr;
+                it.list = this;
+                it.remember(this, size_);
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator cbegin() const
+            {
+                ConstIterator cit;
+                cit.node = head_;
+                cit.list = this;
+                cit.remember(this, 0);
+                return cit;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator cend() const
+            {
+                ConstIterator cit;
+                cit.node = nullptr;
+                cit.list = this;
+                cit.remember(this, size_);
+                return cit;
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the last element.
+             * \return A reverse iterator
+             */
+            ReverseIterator rbegin()
+            {
+                ReverseIterator rit;
+                rit.node = tail_;
+                rit.list = this;
+                rit.remember(this, size_-1);
+                return rit;
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A reverse iterator
+             */
+            ReverseIterator rend()
+            {
+                ReverseIterator rit;
+                rit.node = nullptr;
+                rit.list = this;
+                rit.remember(this, static_cast<size_t>(-1));
+                return rit;
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the last element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator crbegin() const
+            {
+                ConstReverseIterator crit;
+                crit.node = tail_;
+                crit.list = this;
+                crit.remember(this, size_-1);
+                return crit;
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator crend() const
+            {
+                ConstReverseIterator crit;
+                crit.node = nullptr;
+                crit.list = this;
+                crit.remember(this, static_cast<size_t>(-1));
+                return crit;
+            }
+            //extras
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator begin() const
+            {
+                return cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator end() const
+            {
+                return cend();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the last element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator rbegin() const
+            {
+                return crbegin();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator rend() const
+            {
+                return crend();
+            }
+
+            // Iterator-based modifiers
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] val The element to be inserted
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(ConstIterator pos, const T & val)
+            {
+                return emplace(pos, val);
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(ConstIterator pos, T && val)
+            {
+                return emplace(pos, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            Iterator emplace(ConstIterator pos, Args &&... args)
+            {
+                Iterator it;
+                it.node = link_before(pos.node, create_node(std::forward<Args>(args)...));
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return An iterator referring to the element following the removed one
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator erase(ConstIterator pos) noexcept
+            {
+                Iterator it;
+                it.node = erase_node(pos.node);
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Remove the elements in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove (can be end())
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase(ConstIterator first, ConstIterator last) noexcept
+            {
+                while(first != last)
+                    first.node = erase_node(first.node);
+
+                Iterator it;
+                it.node = last.node;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Insert the values of a range before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] range The values to insert (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             * \return An iterator referring to the first inserted element (\p pos if the range is empty)
+             *
+             * \note The values are copied into a temporary chain which is then linked in constant time:
+             * the contents are unchanged if an exception is thrown (and the range can be part of the container).
+             */
+            template <typename Range>
+            Iterator insert_range(ConstIterator pos, Range && range)
+            {
+                using std::begin;
+                using std::end;
+                DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> tmp(begin(range), end(range), get_allocator());
+
+                Iterator it;
+                it.node = tmp.head_ ? tmp.head_ : static_cast<Node*>(pos.node);
+                it.list = this;
+                splice(pos, tmp);
+                return it;
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] val The element to be inserted
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(Iterator pos, const T & val)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), val);
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(Iterator pos, T && val)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            Iterator emplace(Iterator pos, Args &&... args)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return An iterator referring to the element following the removed one
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator erase(Iterator pos) noexcept
+            {
+                return erase(iterator_cast<ConstIterator>(pos));
+            }
+            /*!
+             * \brief Remove the elements in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove (can be end())
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase(Iterator first, Iterator last) noexcept
+            {
+                return erase(iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Insert the values of a range before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in] range The values to insert (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             * \return An iterator referring to the first inserted element (\p pos if the range is empty)
+             *
+             * \note The contents are unchanged if an exception is thrown (and the range can be part of the container).
+             */
+            template <typename Range>
+            Iterator insert_range(Iterator pos, Range && range)
+            {
+                return insert_range(iterator_cast<ConstIterator>(pos), std::forward<Range>(range));
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] val The element to be inserted
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ConstReverseIterator pos, const T & val)
+            {
+                return emplace(pos, val);
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ConstReverseIterator pos, T && val)
+            {
+                return emplace(pos, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] args The arguments to construct the value from
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            ReverseIterator emplace(ConstReverseIterator pos, Args &&... args)
+            {
+                ReverseIterator rit;
+                rit.node = link_before(pos.node ? pos.node->next : head_, create_node(std::forward<Args>(args)...));
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return A reverse iterator referring to the element following the removed one in reverse order
+             *
+             * \warning \p pos must be a valid reverse iterator of this container other than rend() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator erase(ConstReverseIterator pos) noexcept
+            {
+                ReverseIterator rit;
+                rit.node = pos.node->previous;
+                rit.list = this;
+                erase_node(pos.node);
+                return rit;
+            }
+            /*!
+             * \brief Remove the elements in the reverse range [first, last).
+             * \param[in] first The first element to remove (in reverse order)
+             * \param[in] last The element following the last one to remove in reverse order (can be rend())
+             * \return A reverse iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            ReverseIterator erase(ConstReverseIterator first, ConstReverseIterator last) noexcept
+            {
+                while(first != last)
+                {
+                    Node * tmp = first.node;
+                    ++first;
+                    erase_node(tmp);
+                }
+
+                ReverseIterator rit;
+                rit.node = last.node;
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] val The element to be inserted
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ReverseIterator pos, const T & val)
+            {
+                return emplace(iterator_cast<ConstReverseIterator>(pos), val);
+            }
+            /*!
+             * \brief Insert a value before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator insert(ReverseIterator pos, T && val)
+            {
+                return emplace(iterator_cast<ConstReverseIterator>(pos), std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position (in reverse order).
+             * \param[in] pos The element before which to insert in reverse order, i.e. after which in forward order (can be rend())
+             * \param[in] args The arguments to construct the value from
+             * \return A reverse iterator referring to the inserted element
+             *
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            ReverseIterator emplace(ReverseIterator pos, Args &&... args)
+            {
+                return emplace(iterator_cast<ConstReverseIterator>(pos), std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove
+             * \return A reverse iterator referring to the element following the removed one in reverse order
+             *
+             * \warning \p pos must be a valid reverse iterator of this container other than rend() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            ReverseIterator erase(ReverseIterator pos) noexcept
+            {
+                return erase(iterator_cast<ConstReverseIterator>(pos));
+            }
+            /*!
+             * \brief Remove the elements in the reverse range [first, last).
+             * \param[in] first The first element to remove (in reverse order)
+             * \param[in] last The element following the last one to remove in reverse order (can be rend())
+             * \return A reverse iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            ReverseIterator erase(ReverseIterator first, ReverseIterator last) noexcept
+            {
+                return erase(iterator_cast<ConstReverseIterator>(first), iterator_cast<ConstReverseIterator>(last));
+            }
+
+            // Lookup
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return An iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time.
+             */
+            Iterator find(const T & val)
+            {
+                return find_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return A `const` iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time.
+             */
+            ConstIterator find(const T & val) const
+            {
+                return find_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return An iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            Iterator find_if(UnaryPredicate pred)
+            {
+                Iterator it;
+                size_t position = 0;
+                for(it.node = head_; it.node && !pred(it.node->value); it.node = it.node->next)
+                    ++position;
+                it.list = this;
+                it.remember(this, position);
+                return it;
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return A `const` iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            ConstIterator find_if(UnaryPredicate pred) const
+            {
+                ConstIterator cit;
+                size_t position = 0;
+                for(cit.node = head_; cit.node && !pred(static_cast<const T &>(cit.node->value)); cit.node = cit.node->next)
+                    ++position;
+                cit.list = this;
+                cit.remember(this, position);
+                return cit;
+            }
+            /*!
+             * \brief Check if an element is equal to a value.
+             * \param[in] val The value to look for
+             * \return `true` if an element is equal to \p val, `false` otherwise
+             *
+             * \note Linear time.
+             */
+            bool contains(const T & val) const
+            {
+                return find(val) != cend();
+            }
+            /*!
+             * \brief Count the elements equal to a value.
+             * \param[in] val The value to look for
+             * \return The number of elements equal to \p val
+             *
+             * \note Linear time.
+             */
+            size_t count(const T & val) const
+            {
+                return count_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Count the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of elements satisfying \p pred
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            size_t count_if(UnaryPredicate pred) const
+            {
+                size_t res = 0;
+                for(const Node * current = head_; current; current = current->next)
+                {
+                    if(pred(current->value))
+                        ++res;
+                }
+                return res;
+            }
+
+            // Operations
+            /*!
+             * \brief Relocate all the nodes in traversal order, so that the traversals walk forward in memory again after a long insert/remove churn.
+             *
+             * Each value is moved (copied if its move constructor may throw) into a new node, and the new node replaces the old one in the links.
+             * The spare nodes are deallocated first, as their storage is as scattered as the one of the nodes.
+             * - With an allocator providing `reserve()` (e.g. manual::PoolAllocator), all the new nodes come from one contiguous block.
+             * - Otherwise, the new nodes are requested in traversal order, before the old ones are given back.
+             *
+             * \note Linear time. The old nodes are given back to the allocator at the end: the list needs up to twice its memory meanwhile.
+             * If an exception is thrown, the list keeps all its elements, in order (partially compacted).
+             * \warning All the iterators, pointers and references to the elements are invalidated.
+             */
+            void compact()
+            {
+                release_spare_nodes();
+                reserve_nodes(size_);
+                relocate_nodes(head_, size_);
+            }
+            /*!
+             * \brief Relocate some consecutive nodes in traversal order (incremental compact()).
+             * \param[in] first The first element to relocate
+             * \param[in] count The maximal number of elements to relocate
+             * \return A `const` iterator to the element following the last relocated one (end() if none), to give to the next call
+             *
+             * Calling `it = list.compact(it, k)` from cbegin() until end() compacts the list by steps of \p k nodes (e.g. from a periodic task),
+             * each step allocating \p k nodes (contiguous with an allocator providing `reserve()`) and giving \p k nodes back.
+             * \note Linear time in \p count. If an exception is thrown, the list keeps all its elements, in order.
+             * \warning The iterators, pointers and references to the relocated elements are invalidated (not the ones to the other elements).
+             */
+            ConstIterator compact(ConstIterator first, size_t count)
+            {
+                reserve_nodes(count < size_ ? count : size_);
+                ConstIterator res;
+                res.node = relocate_nodes(first.node, count);
+                res.list = this;
+                return res;
+            }
+            /*!
+             * \brief Relocate some consecutive nodes in traversal order (incremental compact()).
+             * \param[in] first The first element to relocate
+             * \param[in] count The maximal number of elements to relocate
+             * \return An iterator to the element following the last relocated one (end() if none), to give to the next call
+             *
+             * \warning The iterators, pointers and references to the relocated elements are invalidated (not the ones to the other elements).
+             */
+            Iterator compact(Iterator first, size_t count)
+            {
+                Iterator it;
+                it.node = compact(iterator_cast<ConstIterator>(first), count).node;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Move all the elements of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice(ConstIterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other) noexcept
+            {
+                if(other.size_)
+                    transfer(pos.node, other, other.head_, other.tail_, other.size_);
+            }
+            /*!
+             * \brief Move all the elements of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice(ConstIterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept
+            {
+                splice(pos, other);
+            }
+            /*!
+             * \brief Move one element of another list before the given position.
+             * \param[in] pos The element before which to move the element (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the element from (can be `*this`)
+             * \param[in] it The element to move
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice(ConstIterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, ConstIterator it) noexcept
+            {
+                if(pos.node != it.node && pos.node != it.node->next)
+                    transfer(pos.node, other, it.node, it.node, 1);
+            }
+            /*!
+             * \brief Move one element of another list before the given position.
+             * \param[in] pos The element before which to move the element (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the element from (can be `*this`)
+             * \param[in] it The element to move
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice(ConstIterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, ConstIterator it) noexcept
+            {
+                splice(pos, other, it);
+            }
+            /*!
+             * \brief Move the elements [first, last) of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (can be `*this`)
+             * \param[in] first The first element to move
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in [first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to count its size, unless `other` is `*this`.
+             */
+            void splice(ConstIterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, ConstIterator first, ConstIterator last) noexcept
+            {
+                if(first != last)
+                {
+                    Node * tail = last.node ? last.node->previous : other.tail_;
+                    size_t count = 0;
+                    if(this != &other)
                     {
-                        ConstReverseIterator tmp(*this);
-                        --(*this);
-                        return tmp;
+                        for(Node * current = first.node; current != last.node; current = current->next)
+                            ++count;
                     }
-                    /*!
-                     * \brief Subtraction assignment operator.
-                     * \param[in] rhs The right-hand side
-                     * \return A reference to `*this`
-                     *
-                     * Decrement the ConstReverseIterator `rhs` times.
-                     */
-                    ConstReverseIterator & operator-=(size_t rhs)
+                    transfer(pos.node, other, first.node, tail, count);
+                }
+            }
+            /*!
+             * \brief Move the elements [first, last) of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (can be `*this`)
+             * \param[in] first The first element to move
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in [first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to count its size, unless `other` is `*this`.
+             */
+            void splice(ConstIterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, ConstIterator first, ConstIterator last) noexcept
+            {
+                splice(pos, other, first, last);
+            }
+            /*!
+             * \brief Move all the elements of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice(Iterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other) noexcept
+            {
+                splice(iterator_cast<ConstIterator>(pos), other);
+            }
+            /*!
+             * \brief Move all the elements of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice(Iterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept
+            {
+                splice(iterator_cast<ConstIterator>(pos), other);
+            }
+            /*!
+             * \brief Move one element of another list before the given position.
+             * \param[in] pos The element before which to move the element (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the element from (can be `*this`)
+             * \param[in] it The element to move
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice(Iterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Iterator it) noexcept
+            {
+                splice(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(it));
+            }
+            /*!
+             * \brief Move one element of another list before the given position.
+             * \param[in] pos The element before which to move the element (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the element from (can be `*this`)
+             * \param[in] it The element to move
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice(Iterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, Iterator it) noexcept
+            {
+                splice(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(it));
+            }
+            /*!
+             * \brief Move the elements [first, last) of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (can be `*this`)
+             * \param[in] first The first element to move
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in [first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to count its size, unless `other` is `*this`.
+             */
+            void splice(Iterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Iterator first, Iterator last) noexcept
+            {
+                splice(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Move the elements [first, last) of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The DoublyLinkedList to take the elements from (can be `*this`)
+             * \param[in] first The first element to move
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in [first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to count its size, unless `other` is `*this`.
+             */
+            void splice(Iterator pos, DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, Iterator first, Iterator last) noexcept
+            {
+                splice(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list.
+             * \param[in,out] other The DoublyLinkedList to merge (left empty)
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
+             */
+            template <typename Compare>
+            void merge(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Compare comp)
+            {
+                if(this == &other)
+                    return;
+
+                Node * current = head_;
+                while(current && other.head_)
+                {
+                    if(comp(other.head_->value, current->value))
                     {
-                        for(size_t i = 0; i < rhs; ++i)
+                        Node * last = other.head_;
+                        size_t count = 1;
+                        while(last->next && comp(last->next->value, current->value))
                         {
-                            --(*this);
+                            last = last->next;
+                            ++count;
                         }
-                        return *this;
-                    }
-                    /*!
-                     * \brief Subtraction operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return The resulting ConstReverseIterator
-                     *
-                     * Decrement `lhs` by `rhs`.
-                     */
-                    friend ConstReverseIterator operator-(ConstReverseIterator lhs, size_t rhs)
-                    {
-                        lhs -= rhs;
-                        return lhs;
-                    }
-                    /*!
-                     * \brief Subtraction operator.
-                     * \param[in] lhs The left-hand side
-                     * \param[in] rhs The right-hand side
-                     * \return The resulting ConstReverseIterator
-                     *
-                     * Decrement `rhs` by `lhs`.
-                     */
-                    friend ConstReverseIterator operator-(size_t lhs, ConstReverseIterator rhs)
-                    {
-                        return rhs - lhs;
+                        transfer(current, other, other.head_, last, count);
                     }
-            };
-
+                    current = current->next;
+                }
+                if(other.head_)
+                    transfer(nullptr, other, other.head_, other.tail_, other.size_);
+            }
             /*!
-             * \brief Get an iterator referring to the first element.
-             * \return An iterator
+             * \brief Merge another sorted list into this sorted list.
+             * \param[in,out] other The DoublyLinkedList to merge (left empty)
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
              */
-            Iterator begin()
+            template <typename Compare>
+            void merge(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, Compare comp)
             {
-                Iterator it;
-                it.node = head_;
-                return it;
+                merge(other, comp);
             }
             /*!
-             * \brief Get an iterator referring to the _past-the-end_ element.
-             * \return An iterator
+             * \brief Merge another sorted list into this sorted list (using `operator<`).
+             * \param[in,out] other The DoublyLinkedList to merge (left empty)
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
              */
-            Iterator end()
+            void merge(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other)
             {
-                Iterator it;
-                it.node = tail_->next; //nullptr
-                return it;
+                merge(other, [](const T & lhs, const T & rhs){ return lhs < rhs; });
             }
             /*!
-             * \brief Get a `const` iterator referring to the first element.
-             * \return A `const` iterator
+             * \brief Merge another sorted list into this sorted list (using `operator<`).
+             * \param[in,out] other The DoublyLinkedList to merge (left empty)
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
              */
-            ConstIterator cbegin() const
+            void merge(DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other)
             {
-                ConstIterator cit;
-                cit.node = head_;
-                return cit;
+                merge(other);
             }
             /*!
-             * \brief Get a `const` iterator referring to the _past-the-end_ element.
-             * \return A `const` iterator
+             * \brief Split the container in two at the given position.
+             * \param[in] pos The first element to move to the new list (can be end())
+             * \return A DoublyLinkedList holding the elements [pos, end())
+             *
+             * \note The nodes are relinked (no copy, no allocation). Both parts are walked at the same time to count the moved elements,
+             * which costs the size of the smaller part.
              */
-            ConstIterator cend() const
+            DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> split_at(ConstIterator pos)
             {
-                ConstIterator cit;
-                cit.node = tail_->next; //nullptr
-                return cit;
+                DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> res(get_allocator());
+                if(pos.node)
+                {
+                    Node * forward = pos.node;
+                    Node * backward = pos.node->previous;
+                    size_t steps = 0;
+                    while(forward && backward)
+                    {
+                        forward = forward->next;
+                        backward = backward->previous;
+                        ++steps;
+                    }
+                    size_t count = forward ? size_ - steps : steps; // steps is either the size of [begin(), pos) or the size of [pos, end())
+                    res.transfer(nullptr, *this, pos.node, tail_, count);
+                }
+                return res;
             }
             /*!
-             * \brief Get a reverse iterator referring to the last element.
-             * \return A reverse iterator
+             * \brief Split the container in two at the given position.
+             * \param[in] pos The first element to move to the new list (can be end())
+             * \return A DoublyLinkedList holding the elements [pos, end())
+             *
+             * \note The nodes are relinked (no copy, no allocation). Both parts are walked at the same time to count the moved elements,
+             * which costs the size of the smaller part.
              */
-            ReverseIterator rbegin()
+            DoublyLinkedList<T, Allocator, IndexPolicy, StatsPolicy> split_at(Iterator pos)
             {
-                ReverseIterator rit;
-                rit.node = tail_;
-                return rit;
+                return split_at(iterator_cast<ConstIterator>(pos));
             }
             /*!
-             * \brief Get a reverse iterator referring to the _preceding-the-beginning_ element.
-             * \return A reverse iterator
+             * \brief Sort the container.
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The sort is stable: equivalent elements keep their relative order.
+             *
+             * \note Bottom-up merge sort in O(n log(n)) time and constant extra memory.
+             * The nodes are relinked, the values are neither copied nor moved and the iterators remain valid.
+             * \note If \p comp throws, the container keeps all its elements, in an unspecified order.
              */
-            ReverseIterator rend()
+            template <typename Compare>
+            void sort(Compare comp)
             {
-                ReverseIterator rit;
-                rit.node = head_->previous; //nullptr
-                return rit;
+                if(size_ < 2)
+                    return;
+
+                index_.invalidate();
+                Node * last = nullptr;
+                Node * rest = nullptr;
+                try
+                {
+                    for(size_t width = 1; width < size_; width *= 2)
+                    {
+                        last = nullptr;
+                        rest = head_;
+                        while(rest)
+                        {
+                            Node * left = rest;
+                            Node * right = cut_chain(left, width);
+                            rest = cut_chain(right, width);
+                            last = merge_chains(last, left, right, comp);
+                        }
+                    }
+                }
+                catch(...) // put the chains not merged yet back at the end, and restore the previous links
+                {
+                    Node * previous = nullptr;
+                    for(Node * current = head_; current; current = current->next)
+                    {
+                        current->previous = previous;
+                        if(!current->next)
+                            current->next = std::exchange(rest, nullptr);
+                        previous = current;
+                    }
+                    tail_ = previous;
+                    throw;
+                }
+                tail_ = last;
+                check_ends();
             }
             /*!
-             * \brief Get a `const` reverse iterator referring to the last element.
-             * \return A `const` reverse iterator
+             * \brief Sort the container (using `operator<`).
+             *
+             * The sort is stable: equivalent elements keep their relative order.
+             *
+             * \note Bottom-up merge sort in O(n log(n)) time and constant extra memory.
+             * The nodes are relinked, the values are neither copied nor moved and the iterators remain valid.
              */
-            ConstReverseIterator crbegin() const
+            void sort()
             {
-                ConstReverseIterator crit;
-                crit.node = tail_;
-                return crit;
+                sort([](const T & lhs, const T & rhs){ return lhs < rhs; });
             }
             /*!
-             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
-             * \return A `const` reverse iterator
+             * \brief Remove the consecutive duplicates.
+             * \param[in] pred The equality predicate
+             * \return The number of removed elements
+             *
+             * Each element equal (according to \p pred) to the first element of its group is removed.
+             *
+             * \note Linear time, only the removed nodes are destroyed.
              */
-            ConstReverseIterator crend() const
+            template <typename BinaryPredicate>
+            size_t unique(BinaryPredicate pred)
             {
-                ConstReverseIterator crit;
-                crit.node = head_->previous; //nullptr
-                return crit;
+                size_t count = 0;
+                for(Node * current = head_; current && current->next;)
+                {
+                    if(pred(current->value, current->next->value))
+                    {
+                        erase_node(current->next);
+                        ++count;
+                    }
+                    else
+                        current = current->next;
+                }
+                return count;
             }
-            //extras
             /*!
-             * \brief Get a `const` iterator referring to the first element.
-             * \return A `const` iterator
+             * \brief Remove the consecutive duplicates (using `operator==`).
+             * \return The number of removed elements
+             *
+             * \note Linear time, only the removed nodes are destroyed.
              */
-            ConstIterator begin() const
+            size_t unique()
             {
-                return cbegin();
+                return unique([](const T & lhs, const T & rhs){ return lhs == rhs; });
             }
             /*!
-             * \brief Get a `const` iterator referring to the _past-the-end_ element.
-             * \return A `const` iterator
+             * \brief Remove the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass: each node is unlinked and destroyed as soon as it is found.
+             * If \p pred throws, the elements already removed stay removed.
              */
-            ConstIterator end() const
+            template <typename UnaryPredicate>
+            size_t remove_if(UnaryPredicate pred)
             {
-                return cend();
+                size_t removed = 0;
+                for(Node * current = head_; current;)
+                {
+                    if(pred(current->value))
+                    {
+                        current = erase_node(current);
+                        ++removed;
+                    }
+                    else
+                        current = current->next;
+                }
+                return removed;
             }
             /*!
-             * \brief Get a `const` reverse iterator referring to the last element.
-             * \return A `const` reverse iterator
+             * \brief Remove the elements equal to a value.
+             * \param[in] val The value to remove (can be an element of the container)
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass. (remove() removes by position.)
              */
-            ConstReverseIterator rbegin() const
+            size_t remove_value(const T & val)
             {
-                return crbegin();
+                Node * self = nullptr; // the node of val (removed last) if val is an element
+                size_t removed = 0;
+                for(Node * current = head_; current;)
+                {
+                    if(std::addressof(current->value) == std::addressof(val))
+                    {
+                        self = current;
+                        current = current->next;
+                    }
+                    else if(current->value == val)
+                    {
+                        current = erase_node(current);
+                        ++removed;
+                    }
+                    else
+                        current = current->next;
+                }
+                if(self)
+                {
+                    erase_node(self);
+                    ++removed;
+                }
+                return removed;
             }
             /*!
-             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
-             * \return A `const` reverse iterator
+             * \brief Reverse the order of the elements.
+             *
+             * \note Linear time, the links of each node are swapped and the iterators remain valid.
              */
-            ConstReverseIterator rend() const
+            void reverse() noexcept
             {
-                return crend();
+                index_.invalidate();
+                for(Node * current = head_; current; current = current->previous)
+                    std::swap(current->next, current->previous);
+                std::swap(head_, tail_);
+                check_ends();
             }
 
             // Iterator conversions
+            /*!
+             * \brief Get an iterator referring to an element from a reference to it.
+             * \param[in] value An element of the container
+             * \return An iterator referring to \p value
+             *
+             * \note Constant time: the value is the first member of its node.
+             * \warning \p value must be an element of the container (Undefined Behaviour).
+             */
+            Iterator iterator_to(T & value) noexcept
+            {
+                Iterator it;
+                it.node = reinterpret_cast<Node*>(std::addressof(value));
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to an element from a reference to it.
+             * \param[in] value An element of the container
+             * \return A `const` iterator referring to \p value
+             *
+             * \note Constant time: the value is the first member of its node.
+             * \warning \p value must be an element of the container (Undefined Behaviour).
+             */
+            ConstIterator iterator_to(const T & value) const noexcept
+            {
+                ConstIterator cit;
+                cit.node = reinterpret_cast<Node*>(const_cast<T*>(std::addressof(value)));
+                cit.list = this;
+                return cit;
+            }
             /*!
              * \brief Iterator conversion.
              * \param[in] it An Iterator to convert
@@ -1461,7 +3647,9 @@ namespace manual
                 static_assert((std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value || std::is_same<IT_type, ReverseIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value), "manual::DoublyLinkedList::iterator_cast - Forbidden template type provided.");
 
                 IT_type res;
+                static_cast<Position &>(res) = it;
                 res.node = it.node;
+                res.list = it.list;
                 return res;
             }
             /*!
@@ -1477,7 +3665,9 @@ namespace manual
                 static_assert((std::is_same<IT_type, ReverseIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value || std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::DoublyLinkedList::iterator_cast - Forbidden template type provided.");
 
                 IT_type res;
+                static_cast<Position &>(res) = rit;
                 res.node = rit.node;
+                res.list = rit.list;
                 return res;
             }
             /*!
@@ -1493,7 +3683,9 @@ namespace manual
                 static_assert((std::is_same<IT_type, ConstIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value), "manual::DoublyLinkedList::iterator_cast - Forbidden template type provided.");
 
                 IT_type res;
+                static_cast<Position &>(res) = cit;
                 res.node = cit.node;
+                res.list = cit.list;
                 return res;
             }
             /*!
@@ -1509,10 +3701,41 @@ namespace manual
                 static_assert((std::is_same<IT_type, ConstReverseIterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::DoublyLinkedList::iterator_cast - Forbidden template type provided.");
 
                 IT_type res;
+                static_cast<Position &>(res) = crit;
                 res.node = crit.node;
+                res.list = crit.list;
                 return res;
             }
+
+        protected:
+            /*!
+             * \brief Get the node an iterator refers to (for the containers built on a DoublyLinkedList).
+             * \param[in] cit The iterator
+             * \return The node of the element (`nullptr` for end())
+             */
+            static Node * node_of(const ConstIterator & cit) noexcept
+            {
+                return cit.node;
+            }
     };
+
+#ifdef MANUAL_HAS_PMR
+    namespace pmr
+    {
+        template <typename T> using DoublyLinkedList = manual::DoublyLinkedList<T, std::pmr::polymorphic_allocator<T>>; /*!< DoublyLinkedList using a `std::pmr::memory_resource` */
+    }
+#endif
+
+    // The moves do not throw: a std::vector of lists relocates them by move
+    static_assert(std::is_nothrow_move_constructible<DoublyLinkedList<int>>::value && std::is_nothrow_move_assignable<DoublyLinkedList<int>>::value, "manual::DoublyLinkedList - The moves may throw.");
+    static_assert(std::is_nothrow_move_constructible<DoublyLinkedList<int, std::allocator<int>, CheckpointIndex>>::value, "manual::DoublyLinkedList - The move constructor may throw (with an index).");
+    static_assert(std::is_nothrow_default_constructible<DoublyLinkedList<int>>::value, "manual::DoublyLinkedList - The default constructor may throw.");
+
+#ifdef __cpp_lib_ranges
+    // The container models the standard range concepts (C++20)
+    static_assert(std::ranges::bidirectional_range<DoublyLinkedList<int>> && std::ranges::sized_range<DoublyLinkedList<int>>, "manual::DoublyLinkedList - Not a bidirectional_range.");
+    static_assert(std::ranges::bidirectional_range<const DoublyLinkedList<int>>, "manual::DoublyLinkedList - Not a `const` bidirectional_range.");
+#endif
 }
 
 #endif // MANUAL_DOUBLYLINKEDLIST_H
@@ -0,0 +1,1640 @@
+#ifndef MANUAL_INTRUSIVEDLIST_H
+#define MANUAL_INTRUSIVEDLIST_H
+
+/*!
+ * \file intrusivedlist.h
+ * \brief An intrusive doubly linked list implementation (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace manual
+{
+    /*!
+     * \struct IntrusiveDListHook
+     * \brief The links to embed in the objects stored in an IntrusiveDList.
+     *
+     * An object can be part of several lists at once, as long as each of them uses its own hook.
+     *
+     * \note Copying an object does not copy its membership: a copied hook is always unlinked.
+     */
+    template <typename T>
+    struct IntrusiveDListHook
+    {
+        /*!
+         * \brief Default constructor.
+         *
+         * Creates an unlinked hook.
+         */
+        IntrusiveDListHook() : next(nullptr), previous(nullptr)
+        {}
+        /*!
+         * \brief Copy constructor.
+         *
+         * Creates an unlinked hook (the links are not copied).
+         */
+        IntrusiveDListHook(const IntrusiveDListHook<T> &) : next(nullptr), previous(nullptr)
+        {}
+        /*!
+         * \brief Assignment operator.
+         * \return A reference to `*this`
+         *
+         * \note The links are left untouched.
+         */
+        IntrusiveDListHook<T> & operator=(const IntrusiveDListHook<T> &)
+        {
+            return *this;
+        }
+
+        T * next;     /*!< Link to the next object */
+        T * previous; /*!< Link to the previous object */
+    };
+
+    /*!
+     * \class IntrusiveDList
+     * \brief An intrusive doubly linked list implementation.
+     *
+     * The links live inside the stored objects (in the member \p Hook), so the list never allocates: it only links objects owned by the user.<br/>
+     * Any linked object can be unlinked in constant time from a reference to it (see unlink()).
+     *
+     * \warning The objects must outlive their membership (destroying a linked object is Undefined Behaviour).
+     * An object must not be linked twice through the same hook.
+     * \note Usage: `IntrusiveDList<Task, &Task::hook>`.
+     */
+    template <typename T, IntrusiveDListHook<T> T::* Hook>
+    class IntrusiveDList
+    {
+        protected:
+            // data members
+            T * head_;    /*!< Pointer to the head */
+            T * tail_;    /*!< Pointer to the tail */
+            size_t size_; /*!< The size */
+
+            /*!
+             * \brief Link an object before a given object.
+             * \param[in,out] pos The object preceding which to insert (`nullptr` to append)
+             * \param[in,out] value The object to insert (not linked through \p Hook)
+             */
+            void link_before(T * pos, T * value)
+            {
+                IntrusiveDListHook<T> & hook = value->*Hook;
+                hook.next = pos;
+                hook.previous = pos ? (pos->*Hook).previous : tail_;
+                if(hook.previous)
+                    (hook.previous->*Hook).next = value;
+                else
+                    head_ = value;
+                if(pos)
+                    (pos->*Hook).previous = value;
+                else
+                    tail_ = value;
+                ++size_;
+            }
+            /*!
+             * \brief Unlink an object.
+             * \param[in,out] value The object to unlink
+             * \return The object following the unlinked one
+             */
+            T * unlink_node(T * value)
+            {
+                IntrusiveDListHook<T> & hook = value->*Hook;
+                T * next = hook.next;
+                if(hook.previous)
+                    (hook.previous->*Hook).next = next;
+                else
+                    head_ = next;
+                if(next)
+                    (next->*Hook).previous = hook.previous;
+                else
+                    tail_ = hook.previous;
+                hook.next = nullptr;
+                hook.previous = nullptr;
+                --size_;
+                return next;
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            IntrusiveDList() : head_(nullptr), tail_(nullptr), size_(0)
+            {}
+            IntrusiveDList(const IntrusiveDList<T, Hook> &) = delete;
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The IntrusiveDList to move from
+             *
+             * \note The moved IntrusiveDList will be left empty but still valid.
+             */
+            IntrusiveDList(IntrusiveDList<T, Hook> && other) noexcept : head_{std::exchange(other.head_, nullptr)},
+                                                                        tail_{std::exchange(other.tail_, nullptr)},
+                                                                        size_{std::exchange(other.size_, 0)}
+            {}
+            /*!
+             * \brief Destructor.
+             *
+             * Unlinks the objects (they are not destroyed).
+             */
+            ~IntrusiveDList()
+            {
+                clear();
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const
+            {
+                return size_;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the list is empty, `false` otherwise
+             */
+            bool empty() const
+            {
+                return !head_;
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the first element.
+             * \return A direct reference to the head object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & front()
+            {
+                return *head_;
+            }
+            /*!
+             * \brief Get the first element.
+             * \return A direct `const` reference to the head object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return *head_;
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct reference to the tail object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & back()
+            {
+                return *tail_;
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct `const` reference to the tail object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & back() const
+            {
+                return *tail_;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Clear the container.
+             *
+             * \note The objects are unlinked, not destroyed.
+             */
+            void clear()
+            {
+                T * current = head_;
+                while(current)
+                {
+                    IntrusiveDListHook<T> & hook = current->*Hook;
+                    current = hook.next;
+                    hook.next = nullptr;
+                    hook.previous = nullptr;
+                }
+                head_ = nullptr;
+                tail_ = nullptr;
+                size_ = 0;
+            }
+            /*!
+             * \brief Link an object at the end of the container.
+             * \param[in,out] value The object to append (not linked through \p Hook)
+             */
+            void push_back(T & value)
+            {
+                link_before(nullptr, &value);
+            }
+            /*!
+             * \brief Link an object at the beginning of the container.
+             * \param[in,out] value The object to prepend (not linked through \p Hook)
+             */
+            void push_front(T & value)
+            {
+                link_before(head_, &value);
+            }
+            /*!
+             * \brief Unlink the last object of the container (if any).
+             */
+            void pop_back()
+            {
+                if(tail_)
+                    unlink_node(tail_);
+            }
+            /*!
+             * \brief Unlink the first object of the container (if any).
+             */
+            void pop_front()
+            {
+                if(head_)
+                    unlink_node(head_);
+            }
+            /*!
+             * \brief Unlink an object from the container.
+             * \param[in,out] value An object linked in this container
+             *
+             * \note Constant time, no traversal.
+             */
+            void unlink(T & value)
+            {
+                unlink_node(&value);
+            }
+
+            // Operators
+            IntrusiveDList<T, Hook> & operator=(const IntrusiveDList<T, Hook> &) = delete;
+            /*!
+             * \brief Move assign new contents to the container (replacing the current contents).
+             * \param[in,out] other An IntrusiveDList of the same type (to move from)
+             * \return A reference to `*this`
+             *
+             * \note The current objects are unlinked and the moved IntrusiveDList will be left empty but still valid.
+             */
+            IntrusiveDList<T, Hook> & operator=(IntrusiveDList<T, Hook> && other) noexcept
+            {
+                if(this != &other)
+                {
+                    clear();
+                    head_ = std::exchange(other.head_, nullptr);
+                    tail_ = std::exchange(other.tail_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                }
+                return *this;
+            }
+
+            // Iterator
+            /*!
+             * \class Iterator
+             * \brief An iterator implementation.
+             */
+            class Iterator final
+            {
+                friend class IntrusiveDList;
+
+                private:
+                    T * node;
+                    const IntrusiveDList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another Iterator.
+                     * \param[in] last The Iterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const Iterator & last) const
+                    {
+                        if(list && node == list->head_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = (current->*Hook).next)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                       /*!< The pointer to a pointed value */
+                    typedef T & reference;                                     /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    Iterator() : node(nullptr), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] it The Iterator to copy
+                     */
+                    Iterator(const Iterator & it) : node(it.node), list(it.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The Iterator to copy
+                     * \return A reference to `*this`
+                     */
+                    Iterator & operator=(const Iterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T & operator*() const
+                    {
+                        return *node;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T * operator->() const
+                    {
+                        return node;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator & operator++() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).next;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment Iterator
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator operator++(int) //postfix
+                    {
+                        Iterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the Iterator `rhs` times.
+                     */
+                    Iterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend Iterator operator+(Iterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend Iterator operator+(size_t lhs, Iterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ Iterator of a container refers to its last element.
+                     */
+                    Iterator & operator--() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).previous;
+                        else if(list)
+                            node = list->tail_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement Iterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    Iterator operator--(int) //postfix
+                    {
+                        Iterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the Iterator `rhs` times.
+                     */
+                    Iterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend Iterator operator-(Iterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend Iterator operator-(size_t lhs, Iterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first Iterator
+                     * \param[in] last The Iterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const Iterator & first, const Iterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+            /*!
+             * \class ConstIterator
+             * \brief A `const` iterator implementation.
+             */
+            class ConstIterator final
+            {
+                friend class IntrusiveDList;
+
+                private:
+                    T * node;
+                    const IntrusiveDList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ConstIterator.
+                     * \param[in] last The ConstIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ConstIterator & last) const
+                    {
+                        if(list && node == list->head_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = (current->*Hook).next)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef const T & reference;                               /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstIterator() : node(nullptr), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] cit The ConstIterator to copy
+                     */
+                    ConstIterator(const ConstIterator & cit) : node(cit.node), list(cit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ConstIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ConstIterator & operator=(const ConstIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The reight-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return *node;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value as `const`
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return node;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator & operator++() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).next;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator operator++(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ConstIterator `rhs` times.
+                     */
+                    ConstIterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ConstIterator operator+(ConstIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ConstIterator operator+(size_t lhs, ConstIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ ConstIterator of a container refers to its last element.
+                     */
+                    ConstIterator & operator--() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).previous;
+                        else if(list)
+                            node = list->tail_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ConstIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstIterator operator--(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ConstIterator `rhs` times.
+                     */
+                    ConstIterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ConstIterator operator-(ConstIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ConstIterator operator-(size_t lhs, ConstIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ConstIterator
+                     * \param[in] last The ConstIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ConstIterator & first, const ConstIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+            /*!
+             * \class ReverseIterator
+             * \brief A reverse iterator implementation.
+             */
+            class ReverseIterator final
+            {
+                friend class IntrusiveDList;
+
+                private:
+                    T * node;
+                    const IntrusiveDList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ReverseIterator.
+                     * \param[in] last The ReverseIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ReverseIterator & last) const
+                    {
+                        if(list && node == list->tail_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = (current->*Hook).previous)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                       /*!< The pointer to a pointed value */
+                    typedef T & reference;                                     /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ReverseIterator() : node(nullptr), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] rit The ReverseIterator to copy
+                     */
+                    ReverseIterator(const ReverseIterator & rit) : node(rit.node), list(rit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ReverseIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ReverseIterator & operator=(const ReverseIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ReverseIterator & lhs, const ReverseIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ReverseIterator & lhs, const ReverseIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
+                     */
+                    T & operator*() const
+                    {
+                        return *node;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value
+                     *
+                     * \note Dereference an out-of-range ReverseIterator is Undefined Behaviour.
+                     */
+                    T * operator->() const
+                    {
+                        return node;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the previous element.
+                     */
+                    ReverseIterator & operator++() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).previous;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ReverseIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ReverseIterator operator++(int) //postfix
+                    {
+                        ReverseIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ReverseIterator `rhs` times.
+                     */
+                    ReverseIterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ReverseIterator operator+(ReverseIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ReverseIterator operator+(size_t lhs, ReverseIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the next element.
+                     *
+                     * \note Decrementing the _past-the-end_ ReverseIterator of a container refers to its last element.
+                     */
+                    ReverseIterator & operator--() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).next;
+                        else if(list)
+                            node = list->head_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ReverseIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ReverseIterator operator--(int) //postfix
+                    {
+                        ReverseIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ReverseIterator `rhs` times.
+                     */
+                    ReverseIterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ReverseIterator operator-(ReverseIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ReverseIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ReverseIterator operator-(size_t lhs, ReverseIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ReverseIterator
+                     * \param[in] last The ReverseIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ReverseIterator & first, const ReverseIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+            /*!
+             * \class ConstReverseIterator
+             * \brief A `const` reverse iterator implementation.
+             */
+            class ConstReverseIterator final
+            {
+                friend class IntrusiveDList;
+
+                private:
+                    T * node;
+                    const IntrusiveDList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ConstReverseIterator.
+                     * \param[in] last The ConstReverseIterator to reach
+                     * \return The distance
+                     */
+                    std::ptrdiff_t distance_to(const ConstReverseIterator & last) const
+                    {
+                        if(list && node == list->tail_ && !last.node)
+                            return static_cast<difference_type>(list->size_);
+
+                        difference_type res = 0;
+                        for(const auto * current = node; current != last.node; current = (current->*Hook).previous)
+                            ++res;
+                        return res;
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef const T & reference;                               /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstReverseIterator() : node(nullptr), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] crit The ConstReverseIterator to copy
+                     */
+                    ConstReverseIterator(const ConstReverseIterator & crit) : node(crit.node), list(crit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ConstReverseIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ConstReverseIterator & operator=(const ConstReverseIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstReverseIterator & lhs, const ConstReverseIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstReverseIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return *node;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value as `const`
+                     *
+                     * \note Dereference an out-of-range ConstReverseIterator is undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return node;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstReverseIterator & operator++() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).previous;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstReverseIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstReverseIterator operator++(int) //postfix
+                    {
+                        ConstReverseIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ConstReverseIterator `rhs` times.
+                     */
+                    ConstReverseIterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ConstReverseIterator operator+(ConstReverseIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ConstReverseIterator operator+(size_t lhs, ConstReverseIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the next element.
+                     *
+                     * \note Decrementing the _past-the-end_ ConstReverseIterator of a container refers to its last element.
+                     */
+                    ConstReverseIterator & operator--() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).next;
+                        else if(list)
+                            node = list->head_;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ConstReverseIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstReverseIterator operator--(int) //postfix
+                    {
+                        ConstReverseIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ConstReverseIterator `rhs` times.
+                     */
+                    ConstReverseIterator & operator-=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            --(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ConstReverseIterator operator-(ConstReverseIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstReverseIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ConstReverseIterator operator-(size_t lhs, ConstReverseIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ConstReverseIterator
+                     * \param[in] last The ConstReverseIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time. Linear time otherwise.
+                     */
+                    friend difference_type distance(const ConstReverseIterator & first, const ConstReverseIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+
+            // Standard container types
+            typedef T value_type;                                /*!< The type of the elements */
+            typedef T & reference;                               /*!< The reference to an element */
+            typedef const T & const_reference;                   /*!< The `const` reference to an element */
+            typedef size_t size_type;                            /*!< The type of the sizes and indexes */
+            typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+            typedef Iterator iterator;                           /*!< The iterator type */
+            typedef ConstIterator const_iterator;                /*!< The `const` iterator type */
+            typedef ReverseIterator reverse_iterator;            /*!< The reverse iterator type */
+            typedef ConstReverseIterator const_reverse_iterator; /*!< The `const` reverse iterator type */
+
+            /*!
+             * \brief Get an iterator referring to the first element.
+             * \return An iterator
+             */
+            Iterator begin()
+            {
+                Iterator it;
+                it.node = head_;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get an iterator referring to the _past-the-end_ element.
+             * \return An iterator
+             */
+            Iterator end()
+            {
+                Iterator it;
+                it.node = nullptr;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator cbegin() const
+            {
+                ConstIterator cit;
+                cit.node = head_;
+                cit.list = this;
+                return cit;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator cend() const
+            {
+                ConstIterator cit;
+                cit.node = nullptr;
+                cit.list = this;
+                return cit;
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the last element.
+             * \return A reverse iterator
+             */
+            ReverseIterator rbegin()
+            {
+                ReverseIterator rit;
+                rit.node = tail_;
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A reverse iterator
+             */
+            ReverseIterator rend()
+            {
+                ReverseIterator rit;
+                rit.node = nullptr;
+                rit.list = this;
+                return rit;
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the last element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator crbegin() const
+            {
+                ConstReverseIterator crit;
+                crit.node = tail_;
+                crit.list = this;
+                return crit;
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator crend() const
+            {
+                ConstReverseIterator crit;
+                crit.node = nullptr;
+                crit.list = this;
+                return crit;
+            }
+            //extras
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator begin() const
+            {
+                return cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator end() const
+            {
+                return cend();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the last element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator rbegin() const
+            {
+                return crbegin();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ element.
+             * \return A `const` reverse iterator
+             */
+            ConstReverseIterator rend() const
+            {
+                return crend();
+            }
+            /*!
+             * \brief Get an iterator referring to a linked object.
+             * \param[in] value An object linked in this container
+             * \return An iterator referring to \p value
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator iterator_to(T & value)
+            {
+                Iterator it;
+                it.node = &value;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to a linked object.
+             * \param[in] value An object linked in this container
+             * \return A `const` iterator referring to \p value
+             *
+             * \note Constant time, no traversal.
+             */
+            ConstIterator iterator_to(const T & value) const
+            {
+                ConstIterator cit;
+                cit.node = const_cast<T*>(&value);
+                cit.list = this;
+                return cit;
+            }
+
+            // Iterator-based modifiers
+            /*!
+             * \brief Link an object before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] value The object to insert (not linked through \p Hook)
+             * \return An iterator referring to the inserted object
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(ConstIterator pos, T & value)
+            {
+                link_before(pos.node, &value);
+                return iterator_to(value);
+            }
+            /*!
+             * \brief Unlink the object at the given position.
+             * \param[in] pos The element to remove (must be dereferenceable)
+             * \return An iterator referring to the element following the removed one
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator erase(ConstIterator pos)
+            {
+                Iterator it;
+                it.node = unlink_node(pos.node);
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Unlink the objects in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase(ConstIterator first, ConstIterator last)
+            {
+                while(first != last)
+                    first.node = unlink_node(first.node);
+
+                Iterator it;
+                it.node = last.node;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Link an object before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] value The object to insert (not linked through \p Hook)
+             * \return An iterator referring to the inserted object
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert(Iterator pos, T & value)
+            {
+                return insert(iterator_cast<ConstIterator>(pos), value);
+            }
+            /*!
+             * \brief Unlink the object at the given position.
+             * \param[in] pos The element to remove (must be dereferenceable)
+             * \return An iterator referring to the element following the removed one
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator erase(Iterator pos)
+            {
+                return erase(iterator_cast<ConstIterator>(pos));
+            }
+            /*!
+             * \brief Unlink the objects in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase(Iterator first, Iterator last)
+            {
+                return erase(iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+
+            // Operations
+            /*!
+             * \brief Move all the objects of another list before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] other The IntrusiveDList to take the objects from (left empty)
+             *
+             * \note Constant time, only the end links are updated.
+             */
+            void splice(ConstIterator pos, IntrusiveDList<T, Hook> & other)
+            {
+                if(this == &other || !other.head_)
+                    return;
+
+                T * previous = pos.node ? (pos.node->*Hook).previous : tail_;
+                (other.head_->*Hook).previous = previous;
+                (other.tail_->*Hook).next = pos.node;
+                if(previous)
+                    (previous->*Hook).next = other.head_;
+                else
+                    head_ = other.head_;
+                if(pos.node)
+                    (pos.node->*Hook).previous = other.tail_;
+                else
+                    tail_ = other.tail_;
+                size_ += other.size_;
+                other.head_ = nullptr;
+                other.tail_ = nullptr;
+                other.size_ = 0;
+            }
+            /*!
+             * \brief Move all the objects of another list before the given position.
+             * \param[in] pos The element before which to insert (can be end())
+             * \param[in,out] other The IntrusiveDList to take the objects from (left empty)
+             *
+             * \note Constant time, only the end links are updated.
+             */
+            void splice(Iterator pos, IntrusiveDList<T, Hook> & other)
+            {
+                splice(iterator_cast<ConstIterator>(pos), other);
+            }
+
+            // Iterator conversions
+            /*!
+             * \brief Iterator conversion.
+             * \param[in] it An Iterator to convert
+             * \return The converted iterator
+             *
+             * \note An Iterator can only be casted into an Iterator, a ConstIterator, a ReverseIterator or a ConstReverseIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const Iterator & it)
+            {
+                static_assert((std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value || std::is_same<IT_type, ReverseIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value), "manual::IntrusiveDList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = it.node;
+                res.list = it.list;
+                return res;
+            }
+            /*!
+             * \brief ReverseIterator conversion.
+             * \param[in] rit A ReverseIterator to convert
+             * \return The converted iterator
+             *
+             * \note A ReverseIterator can only be casted into a ReverseIterator, a ConstReverseIterator, an Iterator or a ConstIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const ReverseIterator & rit)
+            {
+                static_assert((std::is_same<IT_type, ReverseIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value || std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::IntrusiveDList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = rit.node;
+                res.list = rit.list;
+                return res;
+            }
+            /*!
+             * \brief ConstIterator conversion.
+             * \param[in] cit A ConstIterator to convert
+             * \return The converted iterator
+             *
+             * \note A ConstIterator can only be casted into a ConstIterator or a ConstReverseIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const ConstIterator & cit)
+            {
+                static_assert((std::is_same<IT_type, ConstIterator>::value || std::is_same<IT_type, ConstReverseIterator>::value), "manual::IntrusiveDList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = cit.node;
+                res.list = cit.list;
+                return res;
+            }
+            /*!
+             * \brief ConstReverseIterator conversion.
+             * \param[in] crit A ConstReverseIterator to convert
+             * \return The converted iterator
+             *
+             * \note A ConstReverseIterator can only be casted into a ConstReverseIterator or a ConstIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const ConstReverseIterator & crit)
+            {
+                static_assert((std::is_same<IT_type, ConstReverseIterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::IntrusiveDList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = crit.node;
+                res.list = crit.list;
+                return res;
+            }
+    };
+}
+
+#endif // MANUAL_INTRUSIVEDLIST_H
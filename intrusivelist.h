@@ -0,0 +1,755 @@
+#ifndef MANUAL_INTRUSIVELIST_H
+#define MANUAL_INTRUSIVELIST_H
+
+/*!
+ * \file intrusivelist.h
+ * \brief An intrusive singly linked list implementation (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace manual
+{
+    /*!
+     * \struct IntrusiveListHook
+     * \brief The link to embed in the objects stored in an IntrusiveList.
+     *
+     * An object can be part of several lists at once, as long as each of them uses its own hook.
+     *
+     * \note Copying an object does not copy its membership: a copied hook is always unlinked.
+     */
+    template <typename T>
+    struct IntrusiveListHook
+    {
+        /*!
+         * \brief Default constructor.
+         *
+         * Creates an unlinked hook.
+         */
+        IntrusiveListHook() : next(nullptr)
+        {}
+        /*!
+         * \brief Copy constructor.
+         *
+         * Creates an unlinked hook (the links are not copied).
+         */
+        IntrusiveListHook(const IntrusiveListHook<T> &) : next(nullptr)
+        {}
+        /*!
+         * \brief Assignment operator.
+         * \return A reference to `*this`
+         *
+         * \note The links are left untouched.
+         */
+        IntrusiveListHook<T> & operator=(const IntrusiveListHook<T> &)
+        {
+            return *this;
+        }
+
+        T * next; /*!< Link to the next object */
+    };
+
+    /*!
+     * \class IntrusiveList
+     * \brief An intrusive singly linked list implementation.
+     *
+     * The links live inside the stored objects (in the member \p Hook), so the list never allocates: it only links objects owned by the user.
+     *
+     * \warning The objects must outlive their membership (destroying a linked object is Undefined Behaviour).
+     * An object must not be linked twice through the same hook.
+     * \note Usage: `IntrusiveList<Task, &Task::hook>`.
+     */
+    template <typename T, IntrusiveListHook<T> T::* Hook>
+    class IntrusiveList
+    {
+        protected:
+            // data members
+            T * head_;    /*!< Pointer to the head */
+            T * tail_;    /*!< Pointer to the tail */
+            size_t size_; /*!< The size */
+
+            /*!
+             * \brief Get the next object.
+             * \param[in] value A linked object
+             * \return The object following \p value (`nullptr` if none)
+             */
+            static T * next_of(const T * value)
+            {
+                return (value->*Hook).next;
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            IntrusiveList() : head_(nullptr), tail_(nullptr), size_(0)
+            {}
+            IntrusiveList(const IntrusiveList<T, Hook> &) = delete;
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The IntrusiveList to move from
+             *
+             * \note The moved IntrusiveList will be left empty but still valid.
+             */
+            IntrusiveList(IntrusiveList<T, Hook> && other) noexcept : head_{std::exchange(other.head_, nullptr)},
+                                                                      tail_{std::exchange(other.tail_, nullptr)},
+                                                                      size_{std::exchange(other.size_, 0)}
+            {}
+            /*!
+             * \brief Destructor.
+             *
+             * Unlinks the objects (they are not destroyed).
+             */
+            ~IntrusiveList()
+            {
+                clear();
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const
+            {
+                return size_;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the list is empty, `false` otherwise
+             */
+            bool empty() const
+            {
+                return !head_;
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the first element.
+             * \return A direct reference to the head object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & front()
+            {
+                return *head_;
+            }
+            /*!
+             * \brief Get the first element.
+             * \return A direct `const` reference to the head object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return *head_;
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct reference to the tail object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & back()
+            {
+                return *tail_;
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct `const` reference to the tail object
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & back() const
+            {
+                return *tail_;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Clear the container.
+             *
+             * \note The objects are unlinked, not destroyed.
+             */
+            void clear()
+            {
+                T * current = head_;
+                while(current)
+                {
+                    T * tmp = next_of(current);
+                    (current->*Hook).next = nullptr;
+                    current = tmp;
+                }
+                head_ = nullptr;
+                tail_ = nullptr;
+                size_ = 0;
+            }
+            /*!
+             * \brief Link an object at the end of the container.
+             * \param[in,out] value The object to append (not linked through \p Hook)
+             */
+            void push_back(T & value)
+            {
+                (value.*Hook).next = nullptr;
+                if(tail_)
+                    (tail_->*Hook).next = &value;
+                else
+                    head_ = &value;
+                tail_ = &value;
+                ++size_;
+            }
+            /*!
+             * \brief Link an object at the beginning of the container.
+             * \param[in,out] value The object to prepend (not linked through \p Hook)
+             */
+            void push_front(T & value)
+            {
+                (value.*Hook).next = head_;
+                head_ = &value;
+                if(!tail_)
+                    tail_ = &value;
+                ++size_;
+            }
+            /*!
+             * \brief Unlink the first object of the container (if any).
+             */
+            void pop_front()
+            {
+                if(head_)
+                {
+                    T * tmp = head_;
+                    head_ = next_of(tmp);
+                    (tmp->*Hook).next = nullptr;
+                    if(!head_)
+                        tail_ = nullptr;
+                    --size_;
+                }
+            }
+
+            // Operators
+            IntrusiveList<T, Hook> & operator=(const IntrusiveList<T, Hook> &) = delete;
+            /*!
+             * \brief Move assign new contents to the container (replacing the current contents).
+             * \param[in,out] other An IntrusiveList of the same type (to move from)
+             * \return A reference to `*this`
+             *
+             * \note The current objects are unlinked and the moved IntrusiveList will be left empty but still valid.
+             */
+            IntrusiveList<T, Hook> & operator=(IntrusiveList<T, Hook> && other) noexcept
+            {
+                if(this != &other)
+                {
+                    clear();
+                    head_ = std::exchange(other.head_, nullptr);
+                    tail_ = std::exchange(other.tail_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                }
+                return *this;
+            }
+
+            // Iterator
+            /*!
+             * \class Iterator
+             * \brief An iterator implementation.
+             */
+            class Iterator final
+            {
+                friend class IntrusiveList;
+
+                private:
+                    T * node;
+
+                public:
+                    typedef std::forward_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef T & reference;                               /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    Iterator() : node(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] it The Iterator to copy
+                     */
+                    Iterator(const Iterator & it) : node(it.node)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The Iterator to copy
+                     * \return A reference to `*this`
+                     */
+                    Iterator & operator=(const Iterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T & operator*() const
+                    {
+                        return *node;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T * operator->() const
+                    {
+                        return node;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator & operator++() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).next;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment Iterator
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator operator++(int) //postfix
+                    {
+                        Iterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the Iterator `rhs` times.
+                     */
+                    Iterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend Iterator operator+(Iterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend Iterator operator+(size_t lhs, Iterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+            };
+            /*!
+             * \class ConstIterator
+             * \brief A `const` iterator implementation
+             */
+            class ConstIterator final
+            {
+                friend class IntrusiveList;
+
+                private:
+                    T * node;
+
+                public:
+                    typedef std::forward_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                           /*!< The pointer to a pointed value */
+                    typedef const T & reference;                         /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstIterator() : node(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] cit The ConstIterator to copy
+                     */
+                    ConstIterator(const ConstIterator & cit) : node(cit.node)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ConstIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ConstIterator & operator=(const ConstIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            node = other.node;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return *node;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value as `const`
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return node;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator & operator++() //prefix
+                    {
+                        if(node)
+                            node = (node->*Hook).next;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator operator++(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ConstIterator `rhs` times.
+                     */
+                    ConstIterator & operator+=(size_t rhs)
+                    {
+                        for(size_t i = 0; i < rhs; ++i)
+                        {
+                            ++(*this);
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ConstIterator operator+(ConstIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ConstIterator operator+(size_t lhs, ConstIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+            };
+
+            // Standard container types
+            typedef T value_type;                   /*!< The type of the elements */
+            typedef T & reference;                  /*!< The reference to an element */
+            typedef const T & const_reference;      /*!< The `const` reference to an element */
+            typedef size_t size_type;               /*!< The type of the sizes and indexes */
+            typedef std::ptrdiff_t difference_type; /*!< The type of the distance between two iterators */
+            typedef Iterator iterator;              /*!< The iterator type */
+            typedef ConstIterator const_iterator;   /*!< The `const` iterator type */
+
+            /*!
+             * \brief Get an iterator referring to the first element.
+             * \return An iterator
+             */
+            Iterator begin()
+            {
+                Iterator it;
+                it.node = head_;
+                return it;
+            }
+            /*!
+             * \brief Get an iterator referring to the _past-the-end_ element.
+             * \return An iterator
+             */
+            Iterator end()
+            {
+                Iterator it;
+                it.node = nullptr;
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator cbegin() const
+            {
+                ConstIterator cit;
+                cit.node = head_;
+                return cit;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator cend() const
+            {
+                ConstIterator cit;
+                cit.node = nullptr;
+                return cit;
+            }
+            //extras
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator begin() const
+            {
+                return cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator end() const
+            {
+                return cend();
+            }
+            /*!
+             * \brief Get an iterator referring to a linked object.
+             * \param[in] value An object linked in this container
+             * \return An iterator referring to \p value
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator iterator_to(T & value)
+            {
+                Iterator it;
+                it.node = &value;
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to a linked object.
+             * \param[in] value An object linked in this container
+             * \return A `const` iterator referring to \p value
+             *
+             * \note Constant time, no traversal.
+             */
+            ConstIterator iterator_to(const T & value) const
+            {
+                ConstIterator cit;
+                cit.node = const_cast<T*>(&value);
+                return cit;
+            }
+
+            // Iterator-based modifiers
+            /*!
+             * \brief Link an object after the given position.
+             * \param[in] pos The element after which to insert (must be dereferenceable)
+             * \param[in,out] value The object to insert (not linked through \p Hook)
+             * \return An iterator referring to the inserted object
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert_after(ConstIterator pos, T & value)
+            {
+                (value.*Hook).next = next_of(pos.node);
+                (pos.node->*Hook).next = &value;
+                if(pos.node == tail_)
+                    tail_ = &value;
+                ++size_;
+                return iterator_to(value);
+            }
+            /*!
+             * \brief Unlink the object following the given position.
+             * \param[in] pos The element preceding the one to remove (its successor must exist)
+             * \return An iterator referring to the element following the removed one
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator erase_after(ConstIterator pos)
+            {
+                T * tmp = next_of(pos.node);
+                (pos.node->*Hook).next = next_of(tmp);
+                (tmp->*Hook).next = nullptr;
+                if(tmp == tail_)
+                    tail_ = pos.node;
+                --size_;
+
+                Iterator it;
+                it.node = next_of(pos.node);
+                return it;
+            }
+            /*!
+             * \brief Link an object after the given position.
+             * \param[in] pos The element after which to insert (must be dereferenceable)
+             * \param[in,out] value The object to insert (not linked through \p Hook)
+             * \return An iterator referring to the inserted object
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator insert_after(Iterator pos, T & value)
+            {
+                return insert_after(iterator_cast<ConstIterator>(pos), value);
+            }
+            /*!
+             * \brief Unlink the object following the given position.
+             * \param[in] pos The element preceding the one to remove (its successor must exist)
+             * \return An iterator referring to the element following the removed one
+             *
+             * \note Constant time, no traversal.
+             */
+            Iterator erase_after(Iterator pos)
+            {
+                return erase_after(iterator_cast<ConstIterator>(pos));
+            }
+
+            // Operations
+            /*!
+             * \brief Move all the objects of another list at the end of this one.
+             * \param[in,out] other The IntrusiveList to take the objects from (left empty)
+             *
+             * \note Constant time, only the end links are updated.
+             */
+            void splice_back(IntrusiveList<T, Hook> & other)
+            {
+                if(this == &other || !other.head_)
+                    return;
+
+                if(tail_)
+                    (tail_->*Hook).next = other.head_;
+                else
+                    head_ = other.head_;
+                tail_ = other.tail_;
+                size_ += other.size_;
+                other.head_ = nullptr;
+                other.tail_ = nullptr;
+                other.size_ = 0;
+            }
+
+            // Iterator conversions
+            /*!
+             * \brief Iterator conversion.
+             * \param[in] it An Iterator to convert
+             * \return The converted iterator
+             *
+             * \note An Iterator can only be casted into an Iterator or a ConstIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const Iterator & it)
+            {
+                static_assert((std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::IntrusiveList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.node = it.node;
+                return res;
+            }
+    };
+}
+
+#endif // MANUAL_INTRUSIVELIST_H
@@ -0,0 +1,870 @@
+#ifndef MANUAL_LINKEDHASHMAP_H
+#define MANUAL_LINKEDHASHMAP_H
+
+/*!
+ * \file linkedhashmap.h
+ * \brief A hash map keeping its entries in a DoublyLinkedList (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "doublylinkedlist.h"
+
+namespace manual
+{
+    /*!
+     * \enum LinkedHashOrder
+     * \brief The order in which a LinkedHashMap keeps its entries.
+     */
+    enum class LinkedHashOrder
+    {
+        insertion, /*!< From the eldest inserted entry to the newest one */
+        access     /*!< From the least recently used entry to the most recently used one (the lookups move the entries to the back) */
+    };
+
+    /*!
+     * \struct LinkedHashEntry
+     * \brief An entry of a LinkedHashMap: the key, the mapped value and the hash of the key.
+     * \tparam Key The type of the key
+     * \tparam T The type of the mapped value
+     *
+     * The hash is kept so that the erasures and the evictions find the slot of the entry without calling the hash function.<br/>
+     * The entry is a `std::pair`: it binds to `std::pair<const Key, T> &` and decomposes in a structured binding as the pair.
+     */
+    template <typename Key, typename T>
+    struct LinkedHashEntry : std::pair<const Key, T>
+    {
+        /*!
+         * \brief Constructor.
+         * \param[in] key_hash The hash of the key
+         * \param[in] args The arguments to construct the pair from
+         */
+        template <typename... Args>
+        explicit LinkedHashEntry(size_t key_hash, Args &&... args) : std::pair<const Key, T>(std::forward<Args>(args)...), hash(key_hash)
+        {}
+
+        size_t hash; /*!< The hash of the key */
+    };
+
+    /*!
+     * \class LinkedHashMap
+     * \brief A hash map whose entries are the nodes of a DoublyLinkedList (insertion or access ordered).
+     * \tparam Key The type of the keys
+     * \tparam T The type of the mapped values
+     * \tparam Hash The hash function of the keys
+     * \tparam KeyEqual The equality of the keys
+     * \tparam Allocator The allocator of the entries
+     *
+     * The hash table (open addressing, linear probing) refers directly to the nodes of the list: find, erase and the moves
+     * within the order are constant time, and the iterators (the ones of the list) are only invalidated by the erasure of their entry.<br/>
+     * With a capacity, the eldest entries (the front of the list) are evicted by the insertions: in LinkedHashOrder::access,
+     * it is a least recently used (LRU) cache.<br/>
+     * The entries are LinkedHashEntry, pairs keeping the hash of their key: the erasures and the evictions do not call the hash function.
+     *
+     * \note The table is rebuilt when it is three quarters full: its size is a power of two (16 at least).
+     * \warning The moves and the swap of two maps with unequal allocators are Undefined Behaviour (as the splice of their lists).
+     */
+    template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, typename Allocator = std::allocator<std::pair<const Key, T>>>
+    class LinkedHashMap
+    {
+        public:
+            typedef LinkedHashEntry<Key, T> Entry;                                                                  /*!< The type of the entries of the list */
+            typedef DoublyLinkedList<Entry, typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>> List; /*!< The list of the entries */
+
+        protected:
+            /*!
+             * \struct Slot
+             * \brief A slot of the hash table.
+             */
+            struct Slot final
+            {
+                Entry * entry; /*!< The entry (`nullptr` if the slot is empty) */
+                size_t hash;   /*!< The hash of the key of the entry */
+            };
+
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Slot> SlotAllocator; /*!< The allocator rebound to the slot type */
+
+            // data members
+            List list_;                               /*!< The entries, in order */
+            std::vector<Slot, SlotAllocator> slots_; /*!< The hash table (empty until the first insertion) */
+            size_t shift_;                            /*!< The shift turning a mixed hash into a slot index */
+            size_t capacity_;                         /*!< The maximal number of entries (0 for unbounded) */
+            LinkedHashOrder order_;                   /*!< The order of the entries */
+            MANUAL_NO_UNIQUE_ADDRESS Hash hash_;      /*!< The hash function */
+            MANUAL_NO_UNIQUE_ADDRESS KeyEqual equal_; /*!< The key equality */
+
+            /*!
+             * \brief Get the slot where the probing for a hash starts.
+             * \param[in] hash The hash
+             * \return The slot index
+             *
+             * \note The hash is mixed (Fibonacci hashing) so that the identity hashes of the integers spread over the table.
+             */
+            size_t home(size_t hash) const noexcept
+            {
+                return static_cast<size_t>(hash * static_cast<size_t>(0x9E3779B97F4A7C15ull)) >> shift_;
+            }
+            /*!
+             * \brief Find the slot of a key.
+             * \param[in] key The key to look for
+             * \param[in] hash The hash of \p key
+             * \return The slot index, `slots_.size()` if the key is not in the map
+             */
+            size_t find_slot(const Key & key, size_t hash) const
+            {
+                if(list_.empty())
+                    return slots_.size();
+                const size_t mask = slots_.size() - 1;
+                for(size_t i = home(hash); slots_[i].entry; i = (i + 1) & mask)
+                {
+                    if(slots_[i].hash == hash && equal_(slots_[i].entry->first, key))
+                        return i;
+                }
+                return slots_.size();
+            }
+            /*!
+             * \brief Find the slot of an entry of the map.
+             * \param[in] entry The entry
+             * \return The slot index
+             *
+             * \note The probing starts from the hash kept in the entry: the hash function is not called.
+             */
+            size_t slot_of(const Entry & entry) const noexcept
+            {
+                const size_t mask = slots_.size() - 1;
+                size_t i = home(entry.hash);
+                while(slots_[i].entry != &entry)
+                    i = (i + 1) & mask;
+                return i;
+            }
+            /*!
+             * \brief Put an entry in the first empty slot of its probing sequence.
+             * \param[in] entry The entry
+             * \param[in] hash The hash of its key
+             *
+             * \warning The table must have an empty slot.
+             */
+            void insert_slot(Entry * entry, size_t hash) noexcept
+            {
+                const size_t mask = slots_.size() - 1;
+                size_t i = home(hash);
+                while(slots_[i].entry)
+                    i = (i + 1) & mask;
+                slots_[i] = Slot{entry, hash};
+            }
+            /*!
+             * \brief Empty a slot, moving back the next entries of the cluster (no tombstone is left).
+             * \param[in] index The slot index
+             */
+            void erase_slot(size_t index) noexcept
+            {
+                const size_t mask = slots_.size() - 1;
+                for(size_t next = (index + 1) & mask; slots_[next].entry; next = (next + 1) & mask)
+                {
+                    // The entry can fill the hole if the hole is between its home and its slot (cyclically)
+                    size_t start = home(slots_[next].hash);
+                    if(((next - start) & mask) >= ((next - index) & mask))
+                    {
+                        slots_[index] = slots_[next];
+                        index = next;
+                    }
+                }
+                slots_[index].entry = nullptr;
+            }
+            /*!
+             * \brief Rebuild the hash table with a given number of slots.
+             * \param[in] count The number of slots (a power of two)
+             */
+            void rebuild(size_t count)
+            {
+                std::vector<Slot, SlotAllocator> tmp(count, Slot{nullptr, 0}, slots_.get_allocator());
+                slots_.swap(tmp);
+                shift_ = std::numeric_limits<size_t>::digits;
+                for(size_t i = count; i > 1; i >>= 1)
+                    --shift_;
+                if(tmp.empty())
+                {
+                    for(Entry & entry : list_)
+                        insert_slot(&entry, entry.hash);
+                }
+                else
+                {
+                    for(const Slot & slot : tmp)
+                    {
+                        if(slot.entry)
+                            insert_slot(slot.entry, slot.hash);
+                    }
+                }
+            }
+            /*!
+             * \brief Make sure the table can hold a given number of entries without exceeding three quarters of its slots.
+             * \param[in] count The number of entries
+             */
+            void reserve_slots(size_t count)
+            {
+                size_t slots = slots_.size();
+                if(count <= slots / 4 * 3 && slots)
+                    return;
+                if(!slots)
+                    slots = 16;
+                while(count > slots / 4 * 3)
+                    slots *= 2;
+                rebuild(slots);
+            }
+            /*!
+             * \brief Record the use of an entry (it is moved to the back in LinkedHashOrder::access).
+             * \param[in] entry The entry
+             */
+            void touch(Entry & entry) noexcept
+            {
+                if(order_ == LinkedHashOrder::access)
+                    list_.splice(list_.cend(), list_, list_.iterator_to(static_cast<const Entry &>(entry)));
+            }
+            /*!
+             * \brief Remove the eldest entries while there are more entries than the capacity.
+             */
+            void evict() noexcept
+            {
+                while(capacity_ && list_.size() > capacity_)
+                    pop_front();
+            }
+            /*!
+             * \brief Insert a new entry at the back (the key is not in the map).
+             * \param[in] hash The hash of the key
+             * \param[in] args The arguments to construct the entry from
+             * \return An iterator referring to the new entry
+             */
+            template <typename... Args>
+            typename List::Iterator append(size_t hash, Args &&... args)
+            {
+                reserve_slots(list_.size() + 1);
+                typename List::Iterator it = list_.emplace(list_.cend(), hash, std::forward<Args>(args)...);
+                insert_slot(&*it, hash);
+                evict();
+                return it;
+            }
+
+        public:
+            // Standard container types
+            typedef Key key_type;                                             /*!< The type of the keys */
+            typedef T mapped_type;                                            /*!< The type of the mapped values */
+            typedef std::pair<const Key, T> value_type;                       /*!< The type of the entries */
+            typedef value_type & reference;                                   /*!< The reference to an entry */
+            typedef const value_type & const_reference;                       /*!< The `const` reference to an entry */
+            typedef size_t size_type;                                         /*!< The type of the sizes */
+            typedef std::ptrdiff_t difference_type;                           /*!< The type of the distance between two iterators */
+            typedef Hash hasher;                                              /*!< The hash function type */
+            typedef KeyEqual key_equal;                                       /*!< The key equality type */
+            typedef typename List::Iterator iterator;                         /*!< The iterator type */
+            typedef typename List::ConstIterator const_iterator;              /*!< The `const` iterator type */
+            typedef typename List::ReverseIterator reverse_iterator;          /*!< The reverse iterator type */
+            typedef typename List::ConstReverseIterator const_reverse_iterator; /*!< The `const` reverse iterator type */
+            typedef Allocator allocator_type;                                 /*!< The allocator type */
+
+            // Constructors
+            /*!
+             * \brief Constructor.
+             * \param[in] order The order of the entries
+             * \param[in] capacity The maximal number of entries (0 for unbounded)
+             * \param[in] hash The hash function
+             * \param[in] equal The key equality
+             * \param[in] alloc The allocator to get the entries from
+             *
+             * Creates an empty map (the table is allocated by the first insertion).
+             */
+            explicit LinkedHashMap(LinkedHashOrder order = LinkedHashOrder::insertion, size_t capacity = 0, const Hash & hash = Hash(), const KeyEqual & equal = KeyEqual(), const Allocator & alloc = Allocator())
+                : list_(typename List::allocator_type(alloc)), slots_(SlotAllocator(alloc)), shift_(std::numeric_limits<size_t>::digits), capacity_(capacity), order_(order), hash_(hash), equal_(equal)
+            {}
+            /*!
+             * \brief Initialization constructor.
+             * \param[in] init_list An initializer list of entries (the first one of each key is kept)
+             * \param[in] order The order of the entries
+             * \param[in] capacity The maximal number of entries (0 for unbounded)
+             */
+            LinkedHashMap(const std::initializer_list<value_type> & init_list, LinkedHashOrder order = LinkedHashOrder::insertion, size_t capacity = 0) : LinkedHashMap(order, capacity)
+            {
+                reserve(init_list.size());
+                for(const value_type & entry : init_list)
+                    insert(entry);
+            }
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The LinkedHashMap to copy (with its order and its capacity)
+             */
+            LinkedHashMap(const LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> & other) : list_(other.list_), slots_(std::allocator_traits<SlotAllocator>::select_on_container_copy_construction(other.slots_.get_allocator())),
+                                                                                              shift_(std::numeric_limits<size_t>::digits), capacity_(other.capacity_), order_(other.order_), hash_(other.hash_), equal_(other.equal_)
+            {
+                if(!list_.empty())
+                    rebuild(other.slots_.size());
+            }
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The LinkedHashMap to move from
+             *
+             * \note The nodes are stolen: the iterators remain valid (and refer to the new map). The moved map will be left empty but still valid.
+             */
+            LinkedHashMap(LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> && other) noexcept : list_(std::move(other.list_)), slots_(std::move(other.slots_)),
+                                                                                               shift_(std::exchange(other.shift_, std::numeric_limits<size_t>::digits)), capacity_(other.capacity_), order_(other.order_),
+                                                                                               hash_(other.hash_), equal_(other.equal_)
+            {
+                other.slots_.clear();
+            }
+
+            /*!
+             * \brief Get the allocator.
+             * \return A copy of the allocator the entries are obtained from
+             */
+            Allocator get_allocator() const
+            {
+                return Allocator(list_.get_allocator());
+            }
+            /*!
+             * \brief Get the list of the entries, in order.
+             * \return A `const` reference to the list
+             */
+            const List & list() const noexcept
+            {
+                return list_;
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the number of entries.
+             * \return The size
+             */
+            size_t size() const noexcept
+            {
+                return list_.size();
+            }
+            /*!
+             * \brief Check if the map is empty.
+             * \return `true` if the map is empty, `false` otherwise
+             */
+            bool empty() const noexcept
+            {
+                return list_.empty();
+            }
+            /*!
+             * \brief Get the maximal number of entries.
+             * \return The capacity (0 for unbounded)
+             */
+            size_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+            /*!
+             * \brief Set the maximal number of entries, evicting the eldest ones if needed.
+             * \param[in] capacity The new capacity (0 for unbounded)
+             */
+            void set_capacity(size_t capacity) noexcept
+            {
+                capacity_ = capacity;
+                evict();
+            }
+            /*!
+             * \brief Get the order of the entries.
+             * \return The order
+             */
+            LinkedHashOrder order() const noexcept
+            {
+                return order_;
+            }
+            /*!
+             * \brief Get the number of slots of the hash table.
+             * \return The number of slots
+             */
+            size_t bucket_count() const noexcept
+            {
+                return slots_.size();
+            }
+            /*!
+             * \brief Get the ratio of used slots.
+             * \return The load factor (0 while there is no table)
+             */
+            float load_factor() const noexcept
+            {
+                return slots_.empty() ? 0.f : static_cast<float>(list_.size()) / static_cast<float>(slots_.size());
+            }
+            /*!
+             * \brief Size the hash table for a given number of entries.
+             * \param[in] count The number of entries
+             *
+             * \note The table is never shrunk.
+             */
+            void reserve(size_t count)
+            {
+                if(count)
+                    reserve_slots(count);
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the eldest (or least recently used) entry.
+             * \return A reference to the first entry
+             * \warning Undefined Behaviour if the map is empty.
+             */
+            value_type & front()
+            {
+                return list_.front();
+            }
+            /*!
+             * \brief Get the eldest (or least recently used) entry.
+             * \return A `const` reference to the first entry
+             * \warning Undefined Behaviour if the map is empty.
+             */
+            const value_type & front() const
+            {
+                return list_.front();
+            }
+            /*!
+             * \brief Get the newest (or most recently used) entry.
+             * \return A reference to the last entry
+             * \warning Undefined Behaviour if the map is empty.
+             */
+            value_type & back()
+            {
+                return list_.back();
+            }
+            /*!
+             * \brief Get the newest (or most recently used) entry.
+             * \return A `const` reference to the last entry
+             * \warning Undefined Behaviour if the map is empty.
+             */
+            const value_type & back() const
+            {
+                return list_.back();
+            }
+            /*!
+             * \brief Get the value mapped to a key (the entry is used).
+             * \param[in] key The key
+             * \return A reference to the value
+             *
+             * \throws std::out_of_range If the key is not in the map.
+             */
+            T & at(const Key & key)
+            {
+                size_t i = find_slot(key, hash_(key));
+                if(i == slots_.size())
+                    throw std::out_of_range("[Out of range error] - manual::LinkedHashMap::at() - (key not found, size: " + std::to_string(list_.size()) + ").");
+                touch(*slots_[i].entry);
+                return slots_[i].entry->second;
+            }
+            /*!
+             * \brief Get the value mapped to a key (the order is unchanged).
+             * \param[in] key The key
+             * \return A `const` reference to the value
+             *
+             * \throws std::out_of_range If the key is not in the map.
+             */
+            const T & at(const Key & key) const
+            {
+                size_t i = find_slot(key, hash_(key));
+                if(i == slots_.size())
+                    throw std::out_of_range("[Out of range error] - manual::LinkedHashMap::at() - (key not found, size: " + std::to_string(list_.size()) + ").");
+                return slots_[i].entry->second;
+            }
+
+            // Lookup
+            /*!
+             * \brief Find the entry of a key (the entry is used).
+             * \param[in] key The key
+             * \return An iterator referring to the entry, end() if the key is not in the map
+             */
+            iterator find(const Key & key)
+            {
+                size_t i = find_slot(key, hash_(key));
+                if(i == slots_.size())
+                    return list_.end();
+                touch(*slots_[i].entry);
+                return list_.iterator_to(*slots_[i].entry);
+            }
+            /*!
+             * \brief Find the entry of a key (the order is unchanged).
+             * \param[in] key The key
+             * \return A `const` iterator referring to the entry, end() if the key is not in the map
+             */
+            const_iterator find(const Key & key) const
+            {
+                size_t i = find_slot(key, hash_(key));
+                if(i == slots_.size())
+                    return list_.cend();
+                return list_.iterator_to(static_cast<const Entry &>(*slots_[i].entry));
+            }
+            /*!
+             * \brief Check if a key is in the map (the order is unchanged).
+             * \param[in] key The key
+             * \return `true` if the key is in the map, `false` otherwise
+             */
+            bool contains(const Key & key) const
+            {
+                return find_slot(key, hash_(key)) != slots_.size();
+            }
+            /*!
+             * \brief Count the entries of a key (the order is unchanged).
+             * \param[in] key The key
+             * \return 1 if the key is in the map, 0 otherwise
+             */
+            size_t count(const Key & key) const
+            {
+                return contains(key) ? 1 : 0;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Insert an entry if its key is not in the map yet.
+             * \param[in] key The key
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the entry of \p key, and `true` if it was inserted
+             *
+             * \note A new entry is inserted at the back, then the eldest ones are evicted if the capacity is exceeded. An existing entry is used.
+             * The map is unchanged if an exception is thrown.
+             */
+            template <typename... Args>
+            std::pair<iterator, bool> try_emplace(const Key & key, Args &&... args)
+            {
+                size_t hash = hash_(key);
+                size_t i = find_slot(key, hash);
+                if(i != slots_.size())
+                {
+                    touch(*slots_[i].entry);
+                    return std::make_pair(list_.iterator_to(*slots_[i].entry), false);
+                }
+                return std::make_pair(append(hash, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)), true);
+            }
+            /*!
+             * \brief Insert an entry if its key is not in the map yet.
+             * \param[in] key The key (moved from only if the entry is inserted)
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the entry of \p key, and `true` if it was inserted
+             *
+             * \note A new entry is inserted at the back, then the eldest ones are evicted if the capacity is exceeded. An existing entry is used.
+             * The map is unchanged if an exception is thrown.
+             */
+            template <typename... Args>
+            std::pair<iterator, bool> try_emplace(Key && key, Args &&... args)
+            {
+                size_t hash = hash_(key);
+                size_t i = find_slot(key, hash);
+                if(i != slots_.size())
+                {
+                    touch(*slots_[i].entry);
+                    return std::make_pair(list_.iterator_to(*slots_[i].entry), false);
+                }
+                return std::make_pair(append(hash, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...)), true);
+            }
+            /*!
+             * \brief Insert an entry if its key is not in the map yet.
+             * \param[in] entry The entry to copy
+             * \return An iterator referring to the entry of the key, and `true` if it was inserted
+             */
+            std::pair<iterator, bool> insert(const value_type & entry)
+            {
+                return try_emplace(entry.first, entry.second);
+            }
+            /*!
+             * \brief Insert an entry, or assign the value of the existing one.
+             * \param[in] key The key
+             * \param[in] val The value
+             * \return An iterator referring to the entry of \p key, and `true` if it was inserted
+             */
+            template <typename M>
+            std::pair<iterator, bool> insert_or_assign(const Key & key, M && val)
+            {
+                std::pair<iterator, bool> res = try_emplace(key, std::forward<M>(val));
+                if(!res.second)
+                    res.first->second = std::forward<M>(val);
+                return res;
+            }
+            /*!
+             * \brief Remove the entry of a key.
+             * \param[in] key The key
+             * \return The number of removed entries (0 or 1)
+             */
+            size_t erase(const Key & key)
+            {
+                size_t i = find_slot(key, hash_(key));
+                if(i == slots_.size())
+                    return 0;
+                const Entry & entry = *slots_[i].entry;
+                erase_slot(i);
+                list_.erase(list_.iterator_to(entry));
+                return 1;
+            }
+            /*!
+             * \brief Remove an entry.
+             * \param[in] pos The entry to remove
+             * \return An iterator referring to the next entry
+             */
+            iterator erase(const_iterator pos)
+            {
+                erase_slot(slot_of(*pos));
+                return list_.erase(pos);
+            }
+            /*!
+             * \brief Remove an entry.
+             * \param[in] pos The entry to remove
+             * \return An iterator referring to the next entry
+             */
+            iterator erase(iterator pos)
+            {
+                return erase(List::template iterator_cast<const_iterator>(pos));
+            }
+            /*!
+             * \brief Remove the eldest (or least recently used) entry.
+             *
+             * \note The hash function is not called (the hash is kept in the entry).
+             * \warning Undefined Behaviour if the map is empty.
+             */
+            void pop_front() noexcept
+            {
+                erase_slot(slot_of(list_.front()));
+                list_.pop_front();
+            }
+            /*!
+             * \brief Remove all the entries.
+             *
+             * \note The table keeps its size.
+             */
+            void clear() noexcept
+            {
+                if(list_.empty())
+                    return;
+                for(Slot & slot : slots_)
+                    slot.entry = nullptr;
+                list_.clear();
+            }
+            /*!
+             * \brief Swap the contents with another LinkedHashMap.
+             * \param[in,out] other The LinkedHashMap to swap with (the allocators must compare equal)
+             */
+            void swap(LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> & other) noexcept
+            {
+                List tmp(std::move(list_));
+                list_ = std::move(other.list_);
+                other.list_ = std::move(tmp);
+                slots_.swap(other.slots_);
+                std::swap(shift_, other.shift_);
+                std::swap(capacity_, other.capacity_);
+                std::swap(order_, other.order_);
+                std::swap(hash_, other.hash_);
+                std::swap(equal_, other.equal_);
+            }
+
+            // Operations
+            /*!
+             * \brief Move an entry to the front (it becomes the eldest, the next one to be evicted).
+             * \param[in] pos The entry to move
+             *
+             * \note Constant time, the node is relinked.
+             */
+            void move_to_front(const_iterator pos) noexcept
+            {
+                list_.splice(list_.cbegin(), list_, pos);
+            }
+            /*!
+             * \brief Move an entry to the front (it becomes the eldest, the next one to be evicted).
+             * \param[in] pos The entry to move
+             *
+             * \note Constant time, the node is relinked.
+             */
+            void move_to_front(iterator pos) noexcept
+            {
+                move_to_front(List::template iterator_cast<const_iterator>(pos));
+            }
+            /*!
+             * \brief Move an entry to the back (it becomes the newest, the last one to be evicted).
+             * \param[in] pos The entry to move
+             *
+             * \note Constant time, the node is relinked.
+             */
+            void move_to_back(const_iterator pos) noexcept
+            {
+                list_.splice(list_.cend(), list_, pos);
+            }
+            /*!
+             * \brief Move an entry to the back (it becomes the newest, the last one to be evicted).
+             * \param[in] pos The entry to move
+             *
+             * \note Constant time, the node is relinked.
+             */
+            void move_to_back(iterator pos) noexcept
+            {
+                move_to_back(List::template iterator_cast<const_iterator>(pos));
+            }
+
+            // Operators
+            /*!
+             * \brief Access or insert the value mapped to a key (the entry is used).
+             * \param[in] key The key
+             * \return A reference to the value (value-initialized if the entry was inserted)
+             */
+            T & operator[](const Key & key)
+            {
+                return try_emplace(key).first->second;
+            }
+            /*!
+             * \brief Access or insert the value mapped to a key (the entry is used).
+             * \param[in] key The key (moved from only if the entry is inserted)
+             * \return A reference to the value (value-initialized if the entry was inserted)
+             */
+            T & operator[](Key && key)
+            {
+                return try_emplace(std::move(key)).first->second;
+            }
+            /*!
+             * \brief Copy assignment operator.
+             * \param[in] other The LinkedHashMap to copy (with its order and its capacity)
+             * \return A reference to the current map
+             */
+            LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> & operator=(const LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> & other)
+            {
+                if(this != &other)
+                {
+                    LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> tmp(other);
+                    swap(tmp);
+                }
+                return *this;
+            }
+            /*!
+             * \brief Move assignment operator.
+             * \param[in,out] other The LinkedHashMap to move from (the allocators must compare equal)
+             * \return A reference to the current map
+             *
+             * \note The moved map will be left empty but still valid.
+             */
+            LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> & operator=(LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> && other) noexcept
+            {
+                if(this != &other)
+                {
+                    clear();
+                    swap(other);
+                }
+                return *this;
+            }
+
+            // Iterator
+            /*!
+             * \brief Get an iterator referring to the eldest (or least recently used) entry.
+             * \return An iterator
+             */
+            iterator begin()
+            {
+                return list_.begin();
+            }
+            /*!
+             * \brief Get an iterator referring to the _past-the-end_ entry.
+             * \return An iterator
+             */
+            iterator end()
+            {
+                return list_.end();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the eldest (or least recently used) entry.
+             * \return A `const` iterator
+             */
+            const_iterator begin() const
+            {
+                return list_.cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ entry.
+             * \return A `const` iterator
+             */
+            const_iterator end() const
+            {
+                return list_.cend();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the eldest (or least recently used) entry.
+             * \return A `const` iterator
+             */
+            const_iterator cbegin() const
+            {
+                return list_.cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ entry.
+             * \return A `const` iterator
+             */
+            const_iterator cend() const
+            {
+                return list_.cend();
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the newest (or most recently used) entry.
+             * \return A reverse iterator
+             */
+            reverse_iterator rbegin()
+            {
+                return list_.rbegin();
+            }
+            /*!
+             * \brief Get a reverse iterator referring to the _preceding-the-beginning_ entry.
+             * \return A reverse iterator
+             */
+            reverse_iterator rend()
+            {
+                return list_.rend();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the newest (or most recently used) entry.
+             * \return A `const` reverse iterator
+             */
+            const_reverse_iterator crbegin() const
+            {
+                return list_.crbegin();
+            }
+            /*!
+             * \brief Get a `const` reverse iterator referring to the _preceding-the-beginning_ entry.
+             * \return A `const` reverse iterator
+             */
+            const_reverse_iterator crend() const
+            {
+                return list_.crend();
+            }
+
+            /*!
+             * \brief Swap two LinkedHashMap.
+             * \param[in,out] lhs The first map
+             * \param[in,out] rhs The second map
+             */
+            friend void swap(LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> & lhs, LinkedHashMap<Key, T, Hash, KeyEqual, Allocator> & rhs) noexcept
+            {
+                lhs.swap(rhs);
+            }
+    };
+
+    // The moves do not throw: a std::vector of maps relocates them by move
+    static_assert(std::is_nothrow_move_constructible<LinkedHashMap<int, int>>::value && std::is_nothrow_move_assignable<LinkedHashMap<int, int>>::value, "manual::LinkedHashMap - The moves may throw.");
+}
+
+namespace std
+{
+    /*!
+     * \brief The size of a manual::LinkedHashEntry in a structured binding (the size of its pair).
+     */
+    template <typename Key, typename T>
+    struct tuple_size<manual::LinkedHashEntry<Key, T>> : std::integral_constant<size_t, 2>
+    {};
+
+    /*!
+     * \brief The types of the elements of a manual::LinkedHashEntry in a structured binding (the ones of its pair).
+     */
+    template <size_t I, typename Key, typename T>
+    struct tuple_element<I, manual::LinkedHashEntry<Key, T>> : tuple_element<I, std::pair<const Key, T>>
+    {};
+}
+
+#endif // MANUAL_LINKEDHASHMAP_H
@@ -7,122 +7,615 @@
  * \author Raphaël Lefèvre
  */
 
-//#include <cstddef>
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 
+#include "listhardening.h"
+#include "listindex.h"
+#include "liststats.h"
+#include "poolallocator.h"
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#include <memory_resource>
+#define MANUAL_HAS_PMR
+#endif
+#endif
+
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(no_unique_address)
+#define MANUAL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+#endif
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#define MANUAL_NO_UNIQUE_ADDRESS
+#endif
+#endif
+
+#ifndef MANUAL_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define MANUAL_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define MANUAL_PREFETCH(address) ((void)(address))
+#endif
+#endif
+
 namespace manual
 {
     /*!
      * \class LinkedList
      * \brief A linked list implementation.
+     *
+     * The nodes are obtained from \p Allocator (rebound to the node type), which can be any `std::allocator` compatible allocator
+     * (e.g. `std::pmr::polymorphic_allocator` or manual::PoolAllocator).<br/>
+     * The positional access walks the list, unless \p IndexPolicy keeps an index of the nodes (e.g. manual::CheckpointIndex).<br/>
+     * The allocations and the walks of the positional access are counted if \p StatsPolicy does (e.g. manual::CountingStats, see stats()).
      */
-    template <typename T>
+    template <typename T, typename Allocator = std::allocator<T>, typename IndexPolicy = NoIndex, typename StatsPolicy = NoStats>
     class LinkedList
     {
         protected:
+            struct Node;
+            /*!
+             * \struct Link
+             * \brief Internal representation of a link to the next node.
+             *
+             * A Node is a Link carrying a value, the container itself holds the Link preceding the head.
+             */
+            struct Link
+            {
+                Node * next = nullptr; /*!< Link to the next node */
+#ifdef MANUAL_HARDENED
+                std::uint64_t stamp = 0; /*!< The stamp checked by the iterators (0 for the link preceding the head and the destroyed nodes) */
+#endif
+            };
             /*!
              * \struct Node
              * \brief Internal representation of a node.
              */
-            struct Node final
+            struct Node final : Link
             {
-                T value;               /*!< The value */
-                Node * next = nullptr; /*!< Link to the next node */
+                /*!
+                 * \brief Constructor.
+                 * \param[in] args The arguments to construct the value from
+                 */
+                template <typename... Args>
+                explicit Node(Args &&... args) : Link(), value(std::forward<Args>(args)...)
+                {}
+
+                T value; /*!< The value */
+            };
+
+            /*!
+             * \struct SpareNode
+             * \brief Internal representation of a spare node (the storage of a destroyed node, kept for the next insertions).
+             */
+            struct SpareNode final
+            {
+                SpareNode * next; /*!< Link to the next spare node */
             };
 
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator; /*!< The allocator rebound to the node type */
+            typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;                             /*!< The node allocator traits */
+            typedef typename IndexPolicy::template Index<Node> NodeIndex;                                 /*!< The index of the nodes */
+            typedef IteratorPosition<LinkedList, !std::is_same<IndexPolicy, NoIndex>::value> Position;   /*!< The position cached by the iterators (empty with NoIndex) */
+
+            /*!
+             * \brief Enable a function template only for the input iterators (so that it is not picked for two integers).
+             */
+            template <typename InputIt>
+            using RequireInputIterator = typename std::enable_if<std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type;
+
             // data members
-            Node * head_; /*!< Pointer to the head */
-            Node * tail_; /*!< Pointer to the tail */
-            size_t size_; /*!< The size */
+            Link head_;                                       /*!< Link to the head (`head_.next` is the first node) */
+            Node * tail_;                                     /*!< Pointer to the tail */
+            size_t size_;                                     /*!< The size */
+            MANUAL_NO_UNIQUE_ADDRESS NodeAllocator allocator_; /*!< The node allocator */
+            MANUAL_NO_UNIQUE_ADDRESS NodeIndex index_;         /*!< The index of the nodes (empty with NoIndex) */
+            MANUAL_NO_UNIQUE_ADDRESS mutable StatsPolicy stats_; /*!< The counters (empty with NoStats, `mutable` to count the `const` walks) */
+            SpareNode * spare_;                               /*!< The spare nodes (allocated, not constructed) */
+            size_t spare_count_;                              /*!< The number of spare nodes */
+            size_t spare_limit_;                              /*!< The maximal number of spare nodes to keep (set by reserve()) */
+#ifdef MANUAL_HARDENED
+            std::uint64_t next_stamp_ = hardened_stamp_base(); /*!< The stamp of the next created node */
+#endif
 
-        public:
-            // Constructors
+            // Node management
             /*!
-             * \brief Default constructor.
+             * \brief Allocate and construct a node.
+             * \param[in] args The arguments to construct the value from
+             * \return The new node (not linked)
              *
-             * Creates an empty list.
+             * \note A spare node is used if there is one. The node is given back if the value constructor throws.
+             * In hardened mode, the node gets a new stamp.
              */
-            LinkedList() : head_(nullptr), tail_(nullptr), size_(0)
-            {}
+            template <typename... Args>
+            Node * create_node(Args &&... args)
+            {
+                if(!spare_)
+                {
+                    Node * node = NodeAllocatorTraits::allocate(allocator_, 1);
+                    stats_.on_allocate();
+                    try
+                    {
+                        NodeAllocatorTraits::construct(allocator_, node, std::forward<Args>(args)...);
+                    }
+                    catch(...)
+                    {
+                        NodeAllocatorTraits::deallocate(allocator_, node, 1);
+                        stats_.on_deallocate();
+                        throw;
+                    }
+                    MANUAL_HARDENED_ONLY(node->stamp = next_stamp_++;)
+                    return node;
+                }
+
+                SpareNode * next = spare_->next;
+                Node * node = reinterpret_cast<Node*>(spare_);
+                try
+                {
+                    NodeAllocatorTraits::construct(allocator_, node, std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    spare_ = ::new(static_cast<void*>(node)) SpareNode{next};
+                    throw;
+                }
+                spare_ = next;
+                --spare_count_;
+                MANUAL_HARDENED_ONLY(node->stamp = next_stamp_++;)
+                return node;
+            }
             /*!
-             * \brief Copy constructor.
-             * \param[in] other The LinkedList to copy
+             * \brief Destroy a node, and keep it as a spare node or deallocate it.
+             * \param[in] node The node to destroy (already unlinked)
+             *
+             * \note The node is kept while there are less than `spare_limit_` spare nodes.
+             * In hardened mode, its stamp is cleared first (the iterators to the node become invalid).
              */
-            LinkedList(const LinkedList<T> & other) : head_(nullptr), tail_(nullptr), size_(other.size_)
+            void destroy_node(Node * node) noexcept
             {
-                if(size_)
+                MANUAL_HARDENED_ONLY(node->stamp = 0;)
+                NodeAllocatorTraits::destroy(allocator_, node);
+                if(spare_count_ < spare_limit_)
+                {
+                    spare_ = ::new(static_cast<void*>(node)) SpareNode{spare_};
+                    ++spare_count_;
+                }
+                else
+                {
+                    NodeAllocatorTraits::deallocate(allocator_, node, 1);
+                    stats_.on_deallocate();
+                }
+            }
+            /*!
+             * \brief Deallocate all the spare nodes.
+             */
+            void release_spare_nodes() noexcept
+            {
+                while(spare_)
+                {
+                    SpareNode * next = spare_->next;
+                    NodeAllocatorTraits::deallocate(allocator_, reinterpret_cast<Node*>(spare_), 1);
+                    stats_.on_deallocate();
+                    spare_ = next;
+                }
+                spare_count_ = 0;
+            }
+            /*!
+             * \brief Destroy all the nodes (the links and the size are left as is).
+             *
+             * \note When the nodes are trivially destructible and the allocator can take all its blocks back at once (see PoolAllocator::recycle_if_unique()),
+             * the nodes are not visited (the spare ones are dropped as well), except in hardened mode (their stamps are cleared).
+             * Otherwise each node is destroyed while the next one is prefetched.
+             */
+            void destroy_nodes() noexcept
+            {
+                if(release_nodes(std::integral_constant<bool, std::is_trivially_destructible<Node>::value && allocator_has_recycle<NodeAllocator>::value && !hardened_mode>()))
+                    return;
+                Node * current = head_.next;
+                Node * tmp = nullptr;
+                for(size_t i = 0; i < size_; ++i)
                 {
-                    head_ = new Node;
-                    head_->value = other.head_->value;
-                    head_->next = nullptr;
+                    tmp = current->next;
+                    MANUAL_PREFETCH(tmp);
+                    destroy_node(current);
+                    current = tmp;
+                }
+            }
+            /*!
+             * \brief Give all the nodes back to the allocator at once, if it is the only user of its memory.
+             * \return `true` if the nodes (including the spare ones) were released, `false` otherwise
+             */
+            bool release_nodes(std::true_type) noexcept
+            {
+                if(!allocator_.recycle_if_unique())
+                    return false;
+                stats_.on_deallocate(size_ + spare_count_);
+                spare_ = nullptr;
+                spare_count_ = 0;
+                return true;
+            }
+            /*!
+             * \brief Do nothing (the nodes have to be destroyed one by one).
+             * \return `false`
+             */
+            bool release_nodes(std::false_type) noexcept
+            {
+                return false;
+            }
+            /*!
+             * \brief Prepare the allocator for the creation of a given number of nodes.
+             * \param[in] count The number of nodes about to be created
+             *
+             * \note Only has an effect if the allocator provides `reserve()` (e.g. manual::PoolAllocator: the nodes then come from one slab).
+             */
+            void reserve_nodes(size_t count)
+            {
+                reserve_nodes(count, allocator_has_reserve<NodeAllocator>());
+            }
+            /*!
+             * \brief Reserve the nodes in the allocator.
+             * \param[in] count The number of nodes about to be created
+             */
+            void reserve_nodes(size_t count, std::true_type)
+            {
+                allocator_.reserve(count);
+            }
+            /*!
+             * \brief Do nothing (the allocator cannot reserve).
+             */
+            void reserve_nodes(size_t, std::false_type)
+            {}
+            /*!
+             * \brief Prepare the allocator for the nodes of a range (the size of the range is known and the allocator can reserve).
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the last one of the range
+             */
+            template <typename ForwardIt>
+            void reserve_nodes(ForwardIt first, ForwardIt last, std::true_type)
+            {
+                reserve_nodes(static_cast<size_t>(std::distance(first, last)));
+            }
+            /*!
+             * \brief Do nothing (the size of the range is unknown or the allocator cannot reserve).
+             */
+            template <typename InputIt>
+            void reserve_nodes(InputIt, InputIt, std::false_type)
+            {}
+            /*!
+             * \brief Append the values of a range.
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the last one of the range
+             *
+             * \note The nodes are created in one go from the allocator when the size of the range is known (forward iterators).
+             */
+            template <typename InputIt>
+            void append_values(InputIt first, InputIt last)
+            {
+                reserve_nodes(first, last, std::integral_constant<bool, allocator_has_reserve<NodeAllocator>::value
+                                                                        && std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::forward_iterator_tag>::value>());
+                for(; first != last; ++first)
+                    emplace_back(*first);
+            }
+            /*!
+             * \brief Check the consistency of the size and of the ends (hardened mode, no-op otherwise).
+             *
+             * \note Constant time: called after the modifications.
+             */
+            void check_ends() const noexcept
+            {
+                MANUAL_HARDENED_CHECK(!size_ == !head_.next && !size_ == !tail_, "manual::LinkedList - The size and the ends are desynchronized.");
+                MANUAL_HARDENED_CHECK(!tail_ || !tail_->next, "manual::LinkedList - The tail has a next node.");
+                MANUAL_HARDENED_CHECK(size_ != 1 || head_.next == tail_, "manual::LinkedList - The single node is not both the head and the tail.");
+            }
+            /*!
+             * \brief Link a node after a given link.
+             * \param[in,out] pos The link preceding the insertion point
+             * \param[in,out] node The node to insert (not linked)
+             * \return The inserted node
+             */
+            Node * link_after(Link * pos, Node * node) noexcept
+            {
+                index_.invalidate();
+                node->next = pos->next;
+                pos->next = node;
+                if(!node->next)
+                    tail_ = node;
+                ++size_;
+                check_ends();
+                return node;
+            }
+            /*!
+             * \brief Unlink and destroy the node following a given link.
+             * \param[in,out] pos The link preceding the node to remove
+             * \return The node following the removed one
+             */
+            Node * erase_node_after(Link * pos) noexcept
+            {
+                index_.invalidate();
+                Node * tmp = pos->next;
+                pos->next = tmp->next;
+                if(tmp == tail_)
+                    tail_ = (pos == &head_) ? nullptr : static_cast<Node*>(pos);
+                destroy_node(tmp);
+                --size_;
+                check_ends();
+                return pos->next;
+            }
+            /*!
+             * \brief Move a chain of nodes of \p other after a given link.
+             * \param[in,out] pos The link after which to link the chain
+             * \param[in,out] other The LinkedList owning the chain (can be `*this`)
+             * \param[in,out] prev The link preceding the first node of the chain
+             * \param[in,out] last The last node of the chain
+             * \param[in] count The number of nodes in the chain
+             *
+             * \warning \p pos must not be part of the chain.
+             */
+            void transfer_after(Link * pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Link * prev, Node * last, size_t count) noexcept
+            {
+                index_.invalidate();
+                other.index_.invalidate();
+                Node * first = prev->next;
+                prev->next = last->next;
+                if(last == other.tail_)
+                    other.tail_ = (prev == &other.head_) ? nullptr : static_cast<Node*>(prev);
+                other.size_ -= count;
 
-                    Node * current = head_;
-                    Node * other_current = other.head_;
-                    while(other_current->next)
+                last->next = pos->next;
+                pos->next = first;
+                if(!last->next)
+                    tail_ = last;
+                size_ += count;
+                check_ends();
+                other.check_ends();
+            }
+            /*!
+             * \brief Cut a null-terminated chain after a given number of nodes.
+             * \param[in,out] first The first node of the chain (can be `nullptr`)
+             * \param[in] count The number of nodes to keep in the chain starting at \p first (at least 1)
+             * \return The first node of the remainder (`nullptr` if none)
+             */
+            static Node * cut_chain(Node * first, size_t count) noexcept
+            {
+                if(!first)
+                    return nullptr;
+                while(--count && first->next)
+                    first = first->next;
+                Node * rest = first->next;
+                first->next = nullptr;
+                return rest;
+            }
+            /*!
+             * \brief Merge two sorted null-terminated chains and link the result after a given link.
+             * \param[in,out] pos The link after which to link the merged chain
+             * \param[in,out] left The first chain (not empty)
+             * \param[in,out] right The second chain (can be `nullptr`)
+             * \param[in] comp The "less than" comparison function object
+             * \return The last node of the merged chain
+             *
+             * \note The merge is stable: for equivalent elements, the ones of \p left come first.
+             * If \p comp throws, the rest of \p left then the rest of \p right are linked after the merged nodes.
+             */
+            template <typename Compare>
+            static Node * merge_chains(Link * pos, Node * left, Node * right, Compare & comp)
+            {
+                try
+                {
+                    while(left && right)
                     {
-                        current->next = new Node;
-                        current->next->value = other_current->next->value;
-                        current->next->next = nullptr;
-
-                        current = current->next;
-                        other_current = other_current->next;
+                        if(comp(right->value, left->value))
+                        {
+                            pos->next = right;
+                            right = right->next;
+                        }
+                        else
+                        {
+                            pos->next = left;
+                            left = left->next;
+                        }
+                        pos = pos->next;
                     }
-                    tail_= current;
+                }
+                catch(...)
+                {
+                    pos->next = left;
+                    while(left->next)
+                        left = left->next;
+                    left->next = right;
+                    throw;
+                }
+                pos->next = left ? left : right;
+                while(pos->next)
+                    pos = pos->next;
+                return static_cast<Node*>(pos);
+            }
+            /*!
+             * \brief Find the node at the given index.
+             * \param[in] index The position of the node (lower than the size)
+             * \return The node
+             *
+             * \note Walks from the closest checkpoint of the index (from the head with NoIndex), the walk is counted by the statistics policy.
+             */
+            Node * node_at(size_t index) const noexcept
+            {
+                Node * current = nullptr;
+                size_t position = 0;
+                if(!index_.nearest(index, head_.next, size_, current, position))
+                {
+                    current = head_.next;
+                    position = 0;
+                }
+                stats_.on_walk(index - position);
+                for(; position < index; ++position)
+                    current = current->next;
+                return current;
+            }
+            /*!
+             * \brief Move the link of an iterator to a given position with the index (fast jump of an iterator).
+             * \param[in,out] node The link of the iterator (`&head_` before the head, `nullptr` at the end)
+             * \param[in,out] position The cached position of \p node (`size_t(-1)` before the head, the size at the end)
+             * \param[in] target The position to reach (up to the size)
+             * \return `true` if \p node was moved, `false` if it is not at \p position anymore (nothing is changed)
+             */
+            bool jump(Link *& node, size_t & position, size_t target) const noexcept
+            {
+                if(node == &head_ ? position != static_cast<size_t>(-1) : (!node ? position != size_ : (position >= size_ || node_at(position) != node)))
+                    return false;
+                position = target;
+                node = (target < size_) ? node_at(target) : nullptr;
+                return true;
+            }
+            /*!
+             * \brief Copy the allocator of \p other (it follows the copied content).
+             * \param[in] other The LinkedList being copied
+             *
+             * \note If the allocators are not equal, the nodes obtained from the current one (including the spare ones) are destroyed first.
+             */
+            void copy_allocator(const LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, std::true_type)
+            {
+                if(allocator_ != other.allocator_)
+                {
+                    clear();
+                    release_spare_nodes();
+                }
+                allocator_ = other.allocator_;
+            }
+            /*!
+             * \brief Keep the current allocator (it does not follow the copied content).
+             */
+            void copy_allocator(const LinkedList<T, Allocator, IndexPolicy, StatsPolicy> &, std::false_type)
+            {}
+            /*!
+             * \brief Steal the content of \p other and its spare nodes (the allocator follows the moved content).
+             * \param[in,out] other The LinkedList to move from
+             *
+             * \warning The container must be empty.
+             */
+            void move_from(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, std::true_type) noexcept
+            {
+                release_spare_nodes();
+                allocator_ = std::move(other.allocator_);
+                spare_ = std::exchange(other.spare_, nullptr);
+                spare_count_ = std::exchange(other.spare_count_, 0);
+                index_ = std::move(other.index_);
+                head_.next = std::exchange(other.head_.next, nullptr);
+                tail_ = std::exchange(other.tail_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            /*!
+             * \brief Steal the content of \p other if the allocators are equal, move the values one by one otherwise.
+             * \param[in,out] other The LinkedList to move from
+             *
+             * \warning The container must be empty.
+             */
+            void move_from(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, std::false_type)
+            {
+                if(allocator_ == other.allocator_)
+                {
+                    index_ = std::move(other.index_);
+                    head_.next = std::exchange(other.head_.next, nullptr);
+                    tail_ = std::exchange(other.tail_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                }
+                else
+                {
+                    for(Node * current = other.head_.next; current; current = current->next)
+                        push_back(std::move(current->value));
+                    other.clear();
                 }
             }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            LinkedList() noexcept(std::is_nothrow_default_constructible<NodeAllocator>::value) : head_(), tail_(nullptr), size_(0), allocator_(), index_(), stats_(), spare_(nullptr), spare_count_(0), spare_limit_(0)
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates an empty list.
+             */
+            explicit LinkedList(const Allocator & alloc) noexcept(std::is_nothrow_constructible<NodeAllocator, const Allocator &>::value) : head_(), tail_(nullptr), size_(0), allocator_(alloc), index_(), stats_(), spare_(nullptr), spare_count_(0), spare_limit_(0)
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The LinkedList to copy
+             */
+            LinkedList(const LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other) : LinkedList(other.cbegin(), other.cend(), Allocator(NodeAllocatorTraits::select_on_container_copy_construction(other.allocator_)))
+            {}
             /*!
              * \brief Move constructor.
              * \param[in,out] other The LinkedList to move from
              *
              * \note The moved LinkedList will be left empty but still valid.
              */
-            LinkedList(LinkedList<T> && other) noexcept : head_{std::exchange(other.head_, nullptr)},
-                                                          tail_{std::exchange(other.tail_, nullptr)},
-                                                          size_{std::exchange(other.size_, 0)}
+            LinkedList(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept : head_{std::exchange(other.head_.next, nullptr)},
+                                                                     tail_{std::exchange(other.tail_, nullptr)},
+                                                                     size_{std::exchange(other.size_, 0)},
+                                                                     allocator_{std::move(other.allocator_)},
+                                                                     index_{std::move(other.index_)},
+                                                                     stats_(),
+                                                                     spare_{std::exchange(other.spare_, nullptr)},
+                                                                     spare_count_{std::exchange(other.spare_count_, 0)},
+                                                                     spare_limit_{other.spare_limit_}
             {}
             /*!
              * \brief Initialization constructor.
              * \param[in] init_list An initializer list to copy
+             * \param[in] alloc The allocator to get the nodes from
+             */
+            LinkedList(const std::initializer_list<T> & init_list, const Allocator & alloc = Allocator()) : LinkedList(init_list.begin(), init_list.end(), alloc)
+            {}
+            /*!
+             * \brief Range constructor.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * \note When the size of the range is known (forward iterators) and the allocator provides `reserve()` (e.g. manual::PoolAllocator),
+             * all the nodes are reserved at once.
              */
-            LinkedList(const std::initializer_list<T> & init_list) : head_(nullptr), tail_(nullptr), size_(init_list.size())
+            template <typename InputIt, typename = RequireInputIterator<InputIt>>
+            LinkedList(InputIt first, InputIt last, const Allocator & alloc = Allocator()) : head_(), tail_(nullptr), size_(0), allocator_(alloc), index_(), stats_(), spare_(nullptr), spare_count_(0), spare_limit_(0)
             {
-                if(size_)
+                try
                 {
-                    typename std::initializer_list<T>::iterator it = init_list.begin();
-
-                    head_ = new Node;
-                    head_->value = *it;
-                    head_->next = nullptr;
-
-                    Node * current = head_;
-
-                    for(++it; it != init_list.end(); ++it)
-                    {
-                        current->next = new Node;
-                        current->next->value = *it;
-                        current->next->next = nullptr;
-
-                        current = current->next;
-                    }
-                    tail_ = current;
+                    append_values(first, last);
+                }
+                catch(...)
+                {
+                    clear();
+                    throw;
                 }
             }
             ~LinkedList()
             {
                 if(size_)
-                {
-                    Node * current = head_;
-                    Node * tmp = nullptr;
-                    for(size_t i = 0; i < size_; ++i)
-                    {
-                        tmp = current->next;
-                        delete current;
-                        current = tmp;
-                    }
-                }
+                    destroy_nodes();
+                release_spare_nodes();
+            }
+
+            /*!
+             * \brief Get the allocator.
+             * \return A copy of the allocator the nodes are obtained from
+             */
+            Allocator get_allocator() const
+            {
+                return Allocator(allocator_);
             }
 
             // Capacity
@@ -140,7 +633,93 @@ namespace manual
              */
             bool empty() const
             {
-                return !head_;
+                return !head_.next;
+            }
+            /*!
+             * \brief Get the number of nodes owned by the container.
+             * \return The size plus the number of spare nodes
+             */
+            size_t capacity() const
+            {
+                return size_ + spare_count_;
+            }
+            /*!
+             * \brief Make room for a given number of elements, and keep the nodes of the removed elements from then on.
+             * \param[in] count The number of elements to make room for
+             *
+             * Spare nodes are allocated until capacity() reaches \p count. Then up to \p count spare nodes are kept:
+             * the nodes of the removed elements (pop, erase, clear, copy assignment...) are reused by the next insertions instead of being deallocated.
+             * \note Use shrink_to_fit() to deallocate the spare nodes (and stop keeping them).
+             */
+            void reserve(size_t count)
+            {
+                if(spare_limit_ < count)
+                    spare_limit_ = count;
+                if(size_ + spare_count_ < count)
+                {
+                    size_t missing = count - size_ - spare_count_;
+                    reserve_nodes(missing);
+                    SpareNode ** last = &spare_; // keep the allocation order, for the traversal of the next insertions
+                    while(*last)
+                        last = &(*last)->next;
+                    for(; missing; --missing)
+                    {
+                        *last = ::new(static_cast<void*>(NodeAllocatorTraits::allocate(allocator_, 1))) SpareNode{nullptr};
+                        last = &(*last)->next;
+                        ++spare_count_;
+                        stats_.on_allocate();
+                    }
+                }
+            }
+            /*!
+             * \brief Deallocate the spare nodes.
+             *
+             * \note The nodes of the removed elements are deallocated again, until the next call to reserve().
+             */
+            void shrink_to_fit() noexcept
+            {
+                release_spare_nodes();
+                spare_limit_ = 0;
+            }
+
+            // Statistics
+            /*!
+             * \brief Get the counters of the container.
+             * \return The node allocations and deallocations, and the walks of the positional access (all zero with NoStats)
+             *
+             * A walk is counted each time an index-based operation (`operator[]`, `at()`, `insert()`, `remove()`, `pop_back()`...) follows links
+             * to reach a position; its length is the number of links followed from the head, the tail or a checkpoint of the index.
+             * \note The counters belong to the container object: they start from zero on construction (copy and move included) and are kept by the assignments.
+             */
+            ListStats stats() const noexcept
+            {
+                return stats_.get();
+            }
+            /*!
+             * \brief Reset the counters of the container to zero.
+             */
+            void reset_stats() noexcept
+            {
+                stats_.reset();
+            }
+            /*!
+             * \brief Check the whole chain against the size and the tail.
+             * \return `true` if the chain holds `size()` nodes and ends with the tail, `false` if the container is corrupted
+             *
+             * \note Linear time (at most `size()` links are followed), available in every mode: the hardened mode only runs the constant time checks.
+             */
+            bool validate() const noexcept
+            {
+                const Node * current = head_.next;
+                const Node * last = nullptr;
+                for(size_t i = 0; i < size_; ++i)
+                {
+                    if(!current)
+                        return false;
+                    last = current;
+                    current = current->next;
+                }
+                return !current && last == tail_;
             }
 
             // Element Access
@@ -148,40 +727,44 @@ namespace manual
              * \brief Get the first element.
              * \return A direct `const` reference to the head value
              *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
              */
             const T & front() const
             {
-                return head_->value;
+                MANUAL_HARDENED_CHECK(size_, "manual::LinkedList::front() - The container is empty.");
+                return head_.next->value;
             }
             /*!
              * \brief Get the first element.
              * \return A direct reference to the head value
              *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
              */
             T & front()
             {
-                return head_->value;
+                MANUAL_HARDENED_CHECK(size_, "manual::LinkedList::front() - The container is empty.");
+                return head_.next->value;
             }
             /*!
              * \brief Get the last element.
              * \return A direct `const` reference to the tail value
              *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
              */
             const T & back() const
             {
+                MANUAL_HARDENED_CHECK(size_, "manual::LinkedList::back() - The container is empty.");
                 return tail_->value;
             }
             /*!
              * \brief Get the last element.
              * \return A direct reference to the tail value
              *
-             * \warning Never call this function on an empty container (Undefined Behaviour).
+             * \warning Never call this function on an empty container (Undefined Behaviour, checked in hardened mode).
              */
             T & back()
             {
+                MANUAL_HARDENED_CHECK(size_, "manual::LinkedList::back() - The container is empty.");
                 return tail_->value;
             }
             /*!
@@ -189,29 +772,25 @@ namespace manual
              * \param[in] index The position of the element to access
              * \return A `const` reference to the element value at the given index
              *
-             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
-             * \note Iterates over the container until the index is reached. No direct access.
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour, checked in hardened mode).
+             * \note Iterates over the container (from the closest checkpoint of the index, if any) until the index is reached. No direct access.
              */
             const T & operator[](size_t index) const
             {
-                Node * current = head_;
-                for(size_t i = 0; i < index; ++i)
-                {
-                    current = current->next;
-                }
-                return current->value;
+                MANUAL_HARDENED_CHECK(index < size_, "manual::LinkedList::operator[]() - Index out of range.");
+                return node_at(index)->value;
             }
             /*!
              * \brief Access to an element by index.
              * \param[in] index The position of the element to access
              * \return A reference to the element value at the given index
              *
-             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
-             * \note Iterates over the container until the index is reached. No direct access.
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour, checked in hardened mode).
+             * \note Iterates over the container (from the closest checkpoint of the index, if any) until the index is reached. No direct access.
              */
             T & operator[](size_t index)
             {
-                return const_cast<T&>(const_cast<const LinkedList<T> &>(*this)[index]);
+                return const_cast<T&>(const_cast<const LinkedList<T, Allocator, IndexPolicy, StatsPolicy> &>(*this)[index]);
             }
             /*!
              * \brief Safely access to an element by index.
@@ -219,7 +798,7 @@ namespace manual
              * \return A `const` reference to the element value at the given index
              *
              * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
-             * \note Iterates over the container until the index is reached. No direct access.
+             * \note Iterates over the container (from the closest checkpoint of the index, if any) until the index is reached. No direct access.
              */
             const T & at(size_t index) const
             {
@@ -234,51 +813,120 @@ namespace manual
              * \return A reference to the element value at the given index
              *
              * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
-             * \note Iterates over the container until the index is reached. No direct access.
+             * \note Iterates over the container (from the closest checkpoint of the index, if any) until the index is reached. No direct access.
              */
             T & at(size_t index)
             {
-                return const_cast<T&>(const_cast<const LinkedList<T> &>(*this).at(index));
+                return const_cast<T&>(const_cast<const LinkedList<T, Allocator, IndexPolicy, StatsPolicy> &>(*this).at(index));
             }
 
             // Modifiers
             /*!
              * \brief Clear the container.
+             *
+             * \note The nodes are kept as spare nodes up to the count given to reserve() (deallocated otherwise).
              */
-            void clear()
+            void clear() noexcept
             {
                 if(size_)
                 {
-                    Node * current = head_;
-                    Node * tmp = nullptr;
-                    for(size_t i = 0; i < size_; ++i)
-                    {
-                        tmp = current->next;
-                        delete current;
-                        current = tmp;
-                    }
-                    head_ = nullptr;
+                    destroy_nodes();
+                    head_.next = nullptr;
                     tail_ = nullptr;
                     size_ = 0;
+                    index_.on_clear();
                 }
             }
+            /*!
+             * \brief Replace the contents with the values of a range.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             *
+             * \note The new nodes are created before the old ones are destroyed: the contents are unchanged if an exception is thrown
+             * (and the range can be part of the container).
+             */
+            template <typename InputIt, typename = RequireInputIterator<InputIt>>
+            void assign(InputIt first, InputIt last)
+            {
+                LinkedList<T, Allocator, IndexPolicy, StatsPolicy> tmp(first, last, get_allocator());
+                clear();
+                splice_back(tmp);
+            }
+            /*!
+             * \brief Replace the contents with copies of a value.
+             * \param[in] count The new size
+             * \param[in] val The value to copy (can be an element of the container)
+             *
+             * \note The contents are unchanged if an exception is thrown.
+             */
+            void assign(size_t count, const T & val)
+            {
+                LinkedList<T, Allocator, IndexPolicy, StatsPolicy> tmp(get_allocator());
+                tmp.reserve_nodes(count);
+                for(size_t i = 0; i < count; ++i)
+                    tmp.emplace_back(val);
+                clear();
+                splice_back(tmp);
+            }
+            /*!
+             * \brief Replace the contents with the values of an initializer list.
+             * \param[in] init_list The initializer list to copy
+             */
+            void assign(const std::initializer_list<T> & init_list)
+            {
+                assign(init_list.begin(), init_list.end());
+            }
             /*!
              * \brief Add a value at the end of the container.
              * \param[in] val The value to append
              */
             void push_back(const T & val)
             {
-                Node * tmp = new Node;
-                tmp->value = val;
+                emplace_back(val);
+            }
+            /*!
+             * \brief Add a value at the end of the container.
+             * \param[in,out] val The value to append (moved)
+             */
+            void push_back(T && val)
+            {
+                emplace_back(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the end of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_back(Args &&... args)
+            {
+                Node * tmp = create_node(std::forward<Args>(args)...);
                 tmp->next = nullptr;
 
                 if(size_)
                     tail_->next = tmp;
                 else
-                    head_ = tmp;
+                    head_.next = tmp;
 
                 tail_ = tmp;
                 ++size_;
+                index_.on_insert(size_-1, size_);
+                check_ends();
+                return tmp->value;
+            }
+            /*!
+             * \brief Add the values of a range at the end of the container.
+             * \param[in] range The values to append (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             *
+             * \note The contents are unchanged if an exception is thrown.
+             */
+            template <typename Range>
+            void append_range(Range && range)
+            {
+                using std::begin;
+                using std::end;
+                LinkedList<T, Allocator, IndexPolicy, StatsPolicy> tmp(begin(range), end(range), get_allocator());
+                splice_back(tmp);
             }
             /*!
              * \brief Add a value at the beginning of the container.
@@ -286,58 +934,78 @@ namespace manual
              */
             void push_front(const T & val)
             {
-                Node * tmp = new Node;
-                tmp->value = val;
-                tmp->next = head_;
-                head_ = tmp;
+                emplace_front(val);
+            }
+            /*!
+             * \brief Add a value at the beginning of the container.
+             * \param[in,out] val The value to prepend (moved)
+             */
+            void push_front(T && val)
+            {
+                emplace_front(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the beginning of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace_front(Args &&... args)
+            {
+                Node * tmp = create_node(std::forward<Args>(args)...);
+                tmp->next = head_.next;
+                head_.next = tmp;
                 if(!size_)
                     tail_ = tmp;
                 ++size_;
+                index_.on_insert(0, size_);
+                check_ends();
+                return tmp->value;
             }
             /*!
              * \brief Remove the last value of the container (if any).
+             *
+             * \note Iterates over the container to find the node preceding the tail (linear time, or from the closest checkpoint of the index).
+             * Use LinkedStack or LinkedQueue, which only work on the constant time ends, or DoublyLinkedList when both ends are needed.
              */
-            void pop_back()
+            void pop_back() noexcept
             {
                 if(size_)
                 {
                     if(size_ == 1)
                     {
-                        delete head_;
-                        head_ = nullptr;
+                        index_.on_erase(0, nullptr);
+                        destroy_node(head_.next);
+                        head_.next = nullptr;
                         tail_ = nullptr;
                     }
                     else
                     {
-                        Node * current = head_;
-                        bool stop(false);
-                        while(!stop)
-                        {
-                            if(current->next == tail_)
-                                stop = true;
-                            else
-                                current = current->next;
-                        }
-                        delete current->next;
+                        Node * current = node_at(size_-2);
+                        index_.on_erase(size_-1, nullptr);
+                        destroy_node(current->next);
                         current->next = nullptr;
                         tail_ = current;
                     }
                     --size_;
+                    check_ends();
                 }
             }
             /*!
              * \brief Remove the first value of the container (if any).
              */
-            void pop_front()
+            void pop_front() noexcept
             {
                 if(size_)
                 {
-                    Node * tmp = head_->next;
-                    delete head_;
-                    head_ = tmp;
+                    Node * tmp = head_.next->next;
+                    index_.on_erase(0, tmp);
+                    destroy_node(head_.next);
+                    head_.next = tmp;
                     if(size_ == 1)
                         tail_ = nullptr;
                     --size_;
+                    check_ends();
                 }
             }
             /*!
@@ -348,32 +1016,50 @@ namespace manual
              * \note Does nothing if the index exceeds the size value.
              */
             void insert(size_t index, const T & val)
+            {
+                emplace(index, val);
+            }
+            /*!
+             * \brief Insert a value at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in,out] val The element to be inserted (moved)
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            void insert(size_t index, T && val)
+            {
+                emplace(index, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in] args The arguments to construct the value from
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            template <typename... Args>
+            void emplace(size_t index, Args &&... args)
             {
                 if(index <= size_)
                 {
                     if(index == 0)
                     {
-                        push_front(val);
+                        emplace_front(std::forward<Args>(args)...);
                     }
                     else if(index == size_)
                     {
-                        push_back(val);
+                        emplace_back(std::forward<Args>(args)...);
                     }
                     else
                     {
-                        Node * tmp = new Node;
-                        tmp->value = val;
+                        Node * tmp = create_node(std::forward<Args>(args)...);
 
-                        Node * prev = nullptr;
-                        Node * current = head_;
-                        for(size_t i = 0; i < index; ++i)
-                        {
-                            prev = current;
-                            current = current->next;
-                        }
+                        Node * prev = node_at(index-1);
+                        tmp->next = prev->next;
                         prev->next = tmp;
-                        tmp->next = current;
                         ++size_;
+                        index_.on_insert(index, size_);
+                        check_ends();
                     }
                 }
             }
@@ -383,7 +1069,7 @@ namespace manual
              *
              * \note Does nothing if the index is out-of-range or if the container is empty.
              */
-            void remove(size_t index)
+            void remove(size_t index) noexcept
             {
                 if(index < size_)
                 {
@@ -397,16 +1083,13 @@ namespace manual
                     }
                     else
                     {
-                        Node * prev = nullptr;
-                        Node * current = head_;
-                        for(size_t i = 0; i < index; ++i)
-                        {
-                            prev = current;
-                            current = current->next;
-                        }
+                        Node * prev = node_at(index-1);
+                        Node * current = prev->next;
+                        index_.on_erase(index, current->next);
                         prev->next = current->next;
-                        delete current;
+                        destroy_node(current);
                         --size_;
+                        check_ends();
                     }
                 }
             }
@@ -416,32 +1099,27 @@ namespace manual
              * \brief Copy assign new contents to the container (replacing the current contents).
              * \param[in] other A LinkedList of the same type (to copy)
              * \return A reference to `*this`
+             *
+             * \note The existing nodes are reused: the values are copy-assigned in place, and only the size difference is allocated or destroyed.
+             * \warning If a copy throws, the container holds a part of the copied values.
              */
-            LinkedList<T> & operator=(const LinkedList<T> & other)
+            LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & operator=(const LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other)
             {
                 if(this != &other)
                 {
-                    clear();
-                    size_ = other.size_;
-                    if(size_)
-                    {
-                        head_ = new Node;
-                        head_->value = other.head_->value;
-                        head_->next = nullptr;
+                    copy_allocator(other, typename NodeAllocatorTraits::propagate_on_container_copy_assignment());
 
-                        Node * current = head_;
-                        Node * other_current = other.head_;
-                        while(other_current->next)
-                        {
-                            current->next = new Node;
-                            current->next->value = other_current->next->value;
-                            current->next->next = nullptr;
-
-                            current = current->next;
-                            other_current = other_current->next;
-                        }
-                        tail_= current;
+                    Link * last = &head_; // the last overwritten node
+                    const Node * other_current = other.head_.next;
+                    for(; last->next && other_current; other_current = other_current->next)
+                    {
+                        last->next->value = other_current->value;
+                        last = last->next;
                     }
+                    while(last->next)
+                        erase_node_after(last);
+                    for(; other_current; other_current = other_current->next)
+                        emplace_back(other_current->value);
                 }
                 return *this;
             }
@@ -451,15 +1129,14 @@ namespace manual
              * \return A reference to `*this`
              *
              * \note The moved LinkedList will be left empty but still valid.
+             * \note If the allocator does not follow the moved content and both allocators are not equal, the values are moved one by one.
              */
-            LinkedList<T> & operator=(LinkedList<T> && other) noexcept
+            LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & operator=(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept(NodeAllocatorTraits::propagate_on_container_move_assignment::value)
             {
                 if(this != &other)
                 {
                     clear();
-                    head_ = std::exchange(other.head_, nullptr);
-                    tail_ = std::exchange(other.tail_, nullptr);
-                    size_ = std::exchange(other.size_, 0);
+                    move_from(other, typename NodeAllocatorTraits::propagate_on_container_move_assignment());
                 }
                 return *this;
             }
@@ -469,14 +1146,20 @@ namespace manual
              * \class Iterator
              * \brief An iterator implementation.
              */
-            class Iterator final
+            class Iterator final : private Position
             {
                 friend class LinkedList;
 
                 private:
-                    Node * node;
+                    iterator_link_t<Link> node;
 
                 public:
+                    typedef std::forward_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef T & reference;                               /*!< The reference to a pointed value */
+
                     /*!
                      * \brief Default constructor.
                      *
@@ -488,7 +1171,7 @@ namespace manual
                      * \brief Copy constructor.
                      * \param[in] it The Iterator to copy
                      */
-                    Iterator(const Iterator & it) : node(it.node)
+                    Iterator(const Iterator & it) : Position(it), node(it.node)
                     {}
                     /*!
                      * \brief Assignment operator.
@@ -499,6 +1182,7 @@ namespace manual
                     {
                         if(this != &other)
                         {
+                            Position::operator=(other);
                             node = other.node;
                         }
                         return *this;
@@ -531,7 +1215,7 @@ namespace manual
                      */
                     T & operator*() const
                     {
-                        return node->value;
+                        return static_cast<Node*>(node)->value;
                     }
                     /*!
                      * \brief Member of pointer (dereference) operator.
@@ -541,7 +1225,7 @@ namespace manual
                      */
                     T * operator->() const
                     {
-                        return &(node->value);
+                        return &(static_cast<Node*>(node)->value);
                     }
                     /*!
                      * \brief Prefix increment operator.
@@ -552,7 +1236,10 @@ namespace manual
                     Iterator & operator++() //prefix
                     {
                         if(node)
+                        {
                             node = node->next;
+                            this->step_forward();
+                        }
                         return *this;
                     }
                     /*!
@@ -573,9 +1260,23 @@ namespace manual
                      * \return A reference to `*this`
                      *
                      * Increment the Iterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
                      */
                     Iterator & operator+=(size_t rhs)
                     {
+                        const LinkedList * indexed = this->indexed_list();
+                        if(indexed && node && rhs >= indexed->index_.jump_distance())
+                        {
+                            size_t & position = this->cached_position();
+                            Link * target = node;
+                            if(indexed->jump(target, position, (rhs < indexed->size_ - position) ? position + rhs : indexed->size_))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
                         for(size_t i = 0; i < rhs; ++i)
                         {
                             ++(*this);
@@ -607,19 +1308,39 @@ namespace manual
                     {
                         return rhs + lhs;
                     }
+                    /*!
+                     * \brief Get the Iterator following another one by a given number of elements.
+                     * \param[in] it The Iterator to start from
+                     * \param[in] n The number of increments
+                     * \return The resulting Iterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::next; next(it, n);`) jumps with the index of an indexed list, like `it + n`.
+                     * `std::next()` always walks.
+                     */
+                    friend Iterator next(Iterator it, difference_type n = 1)
+                    {
+                        it += static_cast<size_t>(n);
+                        return it;
+                    }
             };
             /*!
              * \class ConstIterator
              * \brief A `const` iterator implementation
              */
-            class ConstIterator final
+            class ConstIterator final : private Position
             {
                 friend class LinkedList;
 
                 private:
-                    Node * node;
+                    iterator_link_t<Link> node;
 
                 public:
+                    typedef std::forward_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                           /*!< The pointer to a pointed value */
+                    typedef const T & reference;                         /*!< The reference to a pointed value */
+
                     /*!
                      * \brief Default constructor.
                      *
@@ -631,7 +1352,7 @@ namespace manual
                      * \brief Copy constructor.
                      * \param[in] cit The ConstIterator to copy
                      */
-                    ConstIterator(const ConstIterator & cit) : node(cit.node)
+                    ConstIterator(const ConstIterator & cit) : Position(cit), node(cit.node)
                     {}
                     /*!
                      * \brief Assignment operator.
@@ -642,6 +1363,7 @@ namespace manual
                     {
                         if(this != &other)
                         {
+                            Position::operator=(other);
                             node = other.node;
                         }
                         return *this;
@@ -674,7 +1396,7 @@ namespace manual
                      */
                     const T & operator*() const
                     {
-                        return node->value;
+                        return static_cast<Node*>(node)->value;
                     }
                     /*!
                      * \brief Member of pointer (dereference) operator.
@@ -684,7 +1406,7 @@ namespace manual
                      */
                     const T * operator->() const
                     {
-                        return &(node->value);
+                        return &(static_cast<Node*>(node)->value);
                     }
                     /*!
                      * \brief Prefix increment operator.
@@ -695,7 +1417,10 @@ namespace manual
                     ConstIterator & operator++() //prefix
                     {
                         if(node)
+                        {
                             node = node->next;
+                            this->step_forward();
+                        }
                         return *this;
                     }
                     /*!
@@ -716,9 +1441,23 @@ namespace manual
                      * \return A reference to `*this`
                      *
                      * Increment the ConstIterator `rhs` times.
+                     *
+                     * \note With an index, a long jump looks the target up in the index instead of walking (see manual::IteratorPosition).
                      */
                     ConstIterator & operator+=(size_t rhs)
                     {
+                        const LinkedList * indexed = this->indexed_list();
+                        if(indexed && node && rhs >= indexed->index_.jump_distance())
+                        {
+                            size_t & position = this->cached_position();
+                            Link * target = node;
+                            if(indexed->jump(target, position, (rhs < indexed->size_ - position) ? position + rhs : indexed->size_))
+                            {
+                                node = target;
+                                return *this;
+                            }
+                            this->forget();
+                        }
                         for(size_t i = 0; i < rhs; ++i)
                         {
                             ++(*this);
@@ -750,8 +1489,32 @@ namespace manual
                     {
                         return rhs + lhs;
                     }
+                    /*!
+                     * \brief Get the ConstIterator following another one by a given number of elements.
+                     * \param[in] it The ConstIterator to start from
+                     * \param[in] n The number of increments
+                     * \return The resulting ConstIterator
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::next; next(it, n);`) jumps with the index of an indexed list, like `it + n`.
+                     * `std::next()` always walks.
+                     */
+                    friend ConstIterator next(ConstIterator it, difference_type n = 1)
+                    {
+                        it += static_cast<size_t>(n);
+                        return it;
+                    }
             };
 
+            // Standard container types
+            typedef T value_type;                   /*!< The type of the elements */
+            typedef T & reference;                  /*!< The reference to an element */
+            typedef const T & const_reference;      /*!< The `const` reference to an element */
+            typedef size_t size_type;               /*!< The type of the sizes and indexes */
+            typedef std::ptrdiff_t difference_type; /*!< The type of the distance between two iterators */
+            typedef Iterator iterator;              /*!< The iterator type */
+            typedef ConstIterator const_iterator;   /*!< The `const` iterator type */
+            typedef Allocator allocator_type;       /*!< The allocator type */
+
             /*!
              * \brief Get an iterator referring to the first element.
              * \return An iterator
@@ -759,7 +1522,8 @@ namespace manual
             Iterator begin()
             {
                 Iterator it;
-                it.node = head_;
+                it.node = head_.next;
+                it.remember(this, 0);
                 return it;
             }
             /*!
@@ -769,7 +1533,8 @@ namespace manual
             Iterator end()
             {
                 Iterator it;
-                it.node = tail_->next; //nullptr
+                it.node = nullptr;
+                it.remember(this, size_);
                 return it;
             }
             /*!
@@ -779,7 +1544,8 @@ namespace manual
             ConstIterator cbegin() const
             {
                 ConstIterator cit;
-                cit.node = head_;
+                cit.node = head_.next;
+                cit.remember(this, 0);
                 return cit;
             }
             /*!
@@ -789,7 +1555,8 @@ namespace manual
             ConstIterator cend() const
             {
                 ConstIterator cit;
-                cit.node = tail_->next; //nullptr
+                cit.node = nullptr;
+                cit.remember(this, size_);
                 return cit;
             }
             //extras
@@ -810,6 +1577,794 @@ namespace manual
                 return cend();
             }
 
+            /*!
+             * \brief Get an iterator referring to the _before-the-beginning_ element.
+             * \return An iterator
+             *
+             * \warning Should not be dereferenced (Undefined Behaviour). It is only meant to be given to the `*_after()` functions or incremented.
+             */
+            Iterator before_begin()
+            {
+                Iterator it;
+                it.node = &head_;
+                it.remember(this, static_cast<size_t>(-1));
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _before-the-beginning_ element.
+             * \return A `const` iterator
+             *
+             * \warning Should not be dereferenced (Undefined Behaviour). It is only meant to be given to the `*_after()` functions or incremented.
+             */
+            ConstIterator cbefore_begin() const
+            {
+                ConstIterator cit;
+                cit.node = const_cast<Link*>(&head_);
+                cit.remember(this, static_cast<size_t>(-1));
+                return cit;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _before-the-beginning_ element.
+             * \return A `const` iterator
+             *
+             * \warning Should not be dereferenced (Undefined Behaviour). It is only meant to be given to the `*_after()` functions or incremented.
+             */
+            ConstIterator before_begin() const
+            {
+                return cbefore_begin();
+            }
+
+            // Iterator-based modifiers
+            /*!
+             * \brief Insert a value after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in] val The element to be inserted
+             * \return An iterator referring to the inserted element
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator insert_after(ConstIterator pos, const T & val)
+            {
+                return emplace_after(pos, val);
+            }
+            /*!
+             * \brief Insert a value after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator referring to the inserted element
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator insert_after(ConstIterator pos, T && val)
+            {
+                return emplace_after(pos, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the inserted element
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            Iterator emplace_after(ConstIterator pos, Args &&... args)
+            {
+                Iterator it;
+                it.node = link_after(pos.node, create_node(std::forward<Args>(args)...));
+                return it;
+            }
+            /*!
+             * \brief Remove the element following the given position.
+             * \param[in] pos The element preceding the one to remove (can be before_begin())
+             * \return An iterator referring to the element following the removed one
+             *
+             * \warning There must be an element after \p pos (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator erase_after(ConstIterator pos) noexcept
+            {
+                Iterator it;
+                it.node = erase_node_after(pos.node);
+                return it;
+            }
+            /*!
+             * \brief Remove the elements between two positions (both excluded).
+             * \param[in] first The element preceding the first one to remove (can be before_begin())
+             * \param[in] last The element following the last one to remove (can be end())
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase_after(ConstIterator first, ConstIterator last) noexcept
+            {
+                while(first.node->next != last.node)
+                    erase_node_after(first.node);
+
+                Iterator it;
+                it.node = last.node;
+                return it;
+            }
+            /*!
+             * \brief Insert the values of a range after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in] range The values to insert (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             * \return An iterator referring to the last inserted element (\p pos if the range is empty)
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note The values are copied into a temporary chain which is then linked in constant time:
+             * the contents are unchanged if an exception is thrown (and the range can be part of the container).
+             */
+            template <typename Range>
+            Iterator insert_range_after(ConstIterator pos, Range && range)
+            {
+                using std::begin;
+                using std::end;
+                LinkedList<T, Allocator, IndexPolicy, StatsPolicy> tmp(begin(range), end(range), get_allocator());
+
+                Iterator it;
+                it.node = tmp.tail_ ? static_cast<Link*>(tmp.tail_) : static_cast<Link*>(pos.node);
+                splice_after(pos, tmp);
+                return it;
+            }
+            /*!
+             * \brief Insert a value after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in] val The element to be inserted
+             * \return An iterator referring to the inserted element
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator insert_after(Iterator pos, const T & val)
+            {
+                return emplace_after(iterator_cast<ConstIterator>(pos), val);
+            }
+            /*!
+             * \brief Insert a value after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator referring to the inserted element
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator insert_after(Iterator pos, T && val)
+            {
+                return emplace_after(iterator_cast<ConstIterator>(pos), std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator referring to the inserted element
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            template <typename... Args>
+            Iterator emplace_after(Iterator pos, Args &&... args)
+            {
+                return emplace_after(iterator_cast<ConstIterator>(pos), std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the element following the given position.
+             * \param[in] pos The element preceding the one to remove (can be before_begin())
+             * \return An iterator referring to the element following the removed one
+             *
+             * \warning There must be an element after \p pos (Undefined Behaviour).
+             * \note Constant time, no traversal.
+             */
+            Iterator erase_after(Iterator pos) noexcept
+            {
+                return erase_after(iterator_cast<ConstIterator>(pos));
+            }
+            /*!
+             * \brief Remove the elements between two positions (both excluded).
+             * \param[in] first The element preceding the first one to remove (can be before_begin())
+             * \param[in] last The element following the last one to remove (can be end())
+             * \return An iterator referring to \p last
+             *
+             * \warning \p last must be reachable from \p first (Undefined Behaviour).
+             */
+            Iterator erase_after(Iterator first, Iterator last) noexcept
+            {
+                return erase_after(iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Insert the values of a range after the given position.
+             * \param[in] pos The element after which to insert (can be before_begin())
+             * \param[in] range The values to insert (anything `std::begin()` and `std::end()` accept, e.g. a container or an array)
+             * \return An iterator referring to the last inserted element (\p pos if the range is empty)
+             *
+             * \warning \p pos must be a valid iterator of this container other than end() (Undefined Behaviour).
+             * \note The contents are unchanged if an exception is thrown (and the range can be part of the container).
+             */
+            template <typename Range>
+            Iterator insert_range_after(Iterator pos, Range && range)
+            {
+                return insert_range_after(iterator_cast<ConstIterator>(pos), std::forward<Range>(range));
+            }
+
+            // Lookup
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return An iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time.
+             */
+            Iterator find(const T & val)
+            {
+                return find_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return A `const` iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time.
+             */
+            ConstIterator find(const T & val) const
+            {
+                return find_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return An iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            Iterator find_if(UnaryPredicate pred)
+            {
+                Node * current = head_.next;
+                size_t position = 0;
+                for(; current && !pred(current->value); current = current->next)
+                    ++position;
+                Iterator it;
+                it.node = current;
+                it.remember(this, position);
+                return it;
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return A `const` iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            ConstIterator find_if(UnaryPredicate pred) const
+            {
+                Node * current = head_.next;
+                size_t position = 0;
+                for(; current && !pred(static_cast<const T &>(current->value)); current = current->next)
+                    ++position;
+                ConstIterator cit;
+                cit.node = current;
+                cit.remember(this, position);
+                return cit;
+            }
+            /*!
+             * \brief Check if an element is equal to a value.
+             * \param[in] val The value to look for
+             * \return `true` if an element is equal to \p val, `false` otherwise
+             *
+             * \note Linear time.
+             */
+            bool contains(const T & val) const
+            {
+                return find(val) != cend();
+            }
+            /*!
+             * \brief Count the elements equal to a value.
+             * \param[in] val The value to look for
+             * \return The number of elements equal to \p val
+             *
+             * \note Linear time.
+             */
+            size_t count(const T & val) const
+            {
+                return count_if([&val](const T & value){ return value == val; });
+            }
+            /*!
+             * \brief Count the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of elements satisfying \p pred
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            size_t count_if(UnaryPredicate pred) const
+            {
+                size_t res = 0;
+                for(const Node * current = head_.next; current; current = current->next)
+                {
+                    if(pred(current->value))
+                        ++res;
+                }
+                return res;
+            }
+
+            // Operations
+            /*!
+             * \brief Move all the elements of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice_after(ConstIterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other) noexcept
+            {
+                if(other.size_)
+                    transfer_after(pos.node, other, &other.head_, other.tail_, other.size_);
+            }
+            /*!
+             * \brief Move all the elements of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice_after(ConstIterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept
+            {
+                splice_after(pos, other);
+            }
+            /*!
+             * \brief Move the element following \p it in another list after the given position.
+             * \param[in] pos The element after which to move the element (can be before_begin())
+             * \param[in,out] other The LinkedList to take the element from (can be `*this`)
+             * \param[in] it The element preceding the one to move
+             *
+             * \warning Both allocators must compare equal and there must be an element after \p it (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice_after(ConstIterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, ConstIterator it) noexcept
+            {
+                if(pos.node != it.node && pos.node != it.node->next)
+                    transfer_after(pos.node, other, it.node, it.node->next, 1);
+            }
+            /*!
+             * \brief Move the element following \p it in another list after the given position.
+             * \param[in] pos The element after which to move the element (can be before_begin())
+             * \param[in,out] other The LinkedList to take the element from (can be `*this`)
+             * \param[in] it The element preceding the one to move
+             *
+             * \warning Both allocators must compare equal and there must be an element after \p it (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice_after(ConstIterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, ConstIterator it) noexcept
+            {
+                splice_after(pos, other, it);
+            }
+            /*!
+             * \brief Move the elements (first, last) of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (can be `*this`)
+             * \param[in] first The element preceding the first one to move (can be before_begin())
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in (first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to find its last node and count its size.
+             */
+            void splice_after(ConstIterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, ConstIterator first, ConstIterator last) noexcept
+            {
+                if(first.node->next != last.node)
+                {
+                    Node * tail = first.node->next;
+                    size_t count = 1;
+                    while(tail->next != last.node)
+                    {
+                        tail = tail->next;
+                        ++count;
+                    }
+                    transfer_after(pos.node, other, first.node, tail, count);
+                }
+            }
+            /*!
+             * \brief Move the elements (first, last) of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (can be `*this`)
+             * \param[in] first The element preceding the first one to move (can be before_begin())
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in (first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to find its last node and count its size.
+             */
+            void splice_after(ConstIterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, ConstIterator first, ConstIterator last) noexcept
+            {
+                splice_after(pos, other, first, last);
+            }
+            /*!
+             * \brief Move all the elements of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice_after(Iterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other) noexcept
+            {
+                splice_after(iterator_cast<ConstIterator>(pos), other);
+            }
+            /*!
+             * \brief Move all the elements of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice_after(Iterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept
+            {
+                splice_after(iterator_cast<ConstIterator>(pos), other);
+            }
+            /*!
+             * \brief Move the element following \p it in another list after the given position.
+             * \param[in] pos The element after which to move the element (can be before_begin())
+             * \param[in,out] other The LinkedList to take the element from (can be `*this`)
+             * \param[in] it The element preceding the one to move
+             *
+             * \warning Both allocators must compare equal and there must be an element after \p it (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice_after(Iterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Iterator it) noexcept
+            {
+                splice_after(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(it));
+            }
+            /*!
+             * \brief Move the element following \p it in another list after the given position.
+             * \param[in] pos The element after which to move the element (can be before_begin())
+             * \param[in,out] other The LinkedList to take the element from (can be `*this`)
+             * \param[in] it The element preceding the one to move
+             *
+             * \warning Both allocators must compare equal and there must be an element after \p it (Undefined Behaviour).
+             * \note Constant time, the node is relinked (no copy, no allocation).
+             */
+            void splice_after(Iterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, Iterator it) noexcept
+            {
+                splice_after(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(it));
+            }
+            /*!
+             * \brief Move the elements (first, last) of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (can be `*this`)
+             * \param[in] first The element preceding the first one to move (can be before_begin())
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in (first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to find its last node and count its size.
+             */
+            void splice_after(Iterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Iterator first, Iterator last) noexcept
+            {
+                splice_after(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Move the elements (first, last) of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The LinkedList to take the elements from (can be `*this`)
+             * \param[in] first The element preceding the first one to move (can be before_begin())
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning Both allocators must compare equal and \p pos must not be in (first, last) (Undefined Behaviour).
+             * \note The nodes are relinked (no copy, no allocation) but the range is walked to find its last node and count its size.
+             */
+            void splice_after(Iterator pos, LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, Iterator first, Iterator last) noexcept
+            {
+                splice_after(iterator_cast<ConstIterator>(pos), other, iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Move all the elements of another list at the end of the container.
+             * \param[in,out] other The LinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice_back(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other) noexcept
+            {
+                if(other.size_)
+                    transfer_after(size_ ? static_cast<Link*>(tail_) : &head_, other, &other.head_, other.tail_, other.size_);
+            }
+            /*!
+             * \brief Move all the elements of another list at the end of the container.
+             * \param[in,out] other The LinkedList to take the elements from (left empty)
+             *
+             * \warning Both allocators must compare equal and \p other must not be `*this` (Undefined Behaviour).
+             * \note Constant time, the nodes are relinked (no copy, no allocation).
+             */
+            void splice_back(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other) noexcept
+            {
+                splice_back(other);
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list.
+             * \param[in,out] other The LinkedList to merge (left empty)
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
+             */
+            template <typename Compare>
+            void merge(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other, Compare comp)
+            {
+                if(this == &other)
+                    return;
+
+                Link * pos = &head_;
+                while(pos->next && other.head_.next)
+                {
+                    if(comp(other.head_.next->value, pos->next->value))
+                    {
+                        Node * last = other.head_.next;
+                        size_t count = 1;
+                        while(last->next && comp(last->next->value, pos->next->value))
+                        {
+                            last = last->next;
+                            ++count;
+                        }
+                        transfer_after(pos, other, &other.head_, last, count);
+                        pos = last;
+                    }
+                    pos = pos->next;
+                }
+                if(other.head_.next)
+                    transfer_after(pos, other, &other.head_, other.tail_, other.size_);
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list.
+             * \param[in,out] other The LinkedList to merge (left empty)
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
+             */
+            template <typename Compare>
+            void merge(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other, Compare comp)
+            {
+                merge(other, comp);
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list (using `operator<`).
+             * \param[in,out] other The LinkedList to merge (left empty)
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
+             */
+            void merge(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> & other)
+            {
+                merge(other, [](const T & lhs, const T & rhs){ return lhs < rhs; });
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list (using `operator<`).
+             * \param[in,out] other The LinkedList to merge (left empty)
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \warning Both allocators must compare equal (Undefined Behaviour).
+             * \note Linear time, the nodes are relinked (no copy, no allocation).
+             */
+            void merge(LinkedList<T, Allocator, IndexPolicy, StatsPolicy> && other)
+            {
+                merge(other);
+            }
+            /*!
+             * \brief Split the container in two after the given position.
+             * \param[in] pos The element preceding the first one to move to the new list (can be before_begin())
+             * \return A LinkedList holding the elements (pos, end())
+             *
+             * \note The nodes are relinked (no copy, no allocation) but the moved part is walked to count its size.
+             * Splitting at a position (rather than after) would require to find its preceding node first.
+             */
+            LinkedList<T, Allocator, IndexPolicy, StatsPolicy> split_after(ConstIterator pos)
+            {
+                LinkedList<T, Allocator, IndexPolicy, StatsPolicy> res(get_allocator());
+                if(pos.node->next)
+                {
+                    size_t count = 0;
+                    for(Node * current = pos.node->next; current; current = current->next)
+                        ++count;
+                    res.transfer_after(&res.head_, *this, pos.node, tail_, count);
+                }
+                return res;
+            }
+            /*!
+             * \brief Split the container in two after the given position.
+             * \param[in] pos The element preceding the first one to move to the new list (can be before_begin())
+             * \return A LinkedList holding the elements (pos, end())
+             *
+             * \note The nodes are relinked (no copy, no allocation) but the moved part is walked to count its size.
+             * Splitting at a position (rather than after) would require to find its preceding node first.
+             */
+            LinkedList<T, Allocator, IndexPolicy, StatsPolicy> split_after(Iterator pos)
+            {
+                return split_after(iterator_cast<ConstIterator>(pos));
+            }
+            /*!
+             * \brief Sort the container.
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The sort is stable: equivalent elements keep their relative order.
+             *
+             * \note Bottom-up merge sort in O(n log(n)) time and constant extra memory.
+             * The nodes are relinked, the values are neither copied nor moved and the iterators remain valid.
+             * \note If \p comp throws, the container keeps all its elements, in an unspecified order.
+             */
+            template <typename Compare>
+            void sort(Compare comp)
+            {
+                if(size_ < 2)
+                    return;
+
+                index_.invalidate();
+                Link * last = &head_;
+                Node * rest = nullptr;
+                try
+                {
+                    for(size_t width = 1; width < size_; width *= 2)
+                    {
+                        last = &head_;
+                        rest = head_.next;
+                        while(rest)
+                        {
+                            Node * left = rest;
+                            Node * right = cut_chain(left, width);
+                            rest = cut_chain(right, width);
+                            last = merge_chains(last, left, right, comp);
+                        }
+                    }
+                }
+                catch(...) // put the chains not merged yet back at the end
+                {
+                    while(last->next)
+                        last = last->next;
+                    last->next = rest;
+                    while(last->next)
+                        last = last->next;
+                    tail_ = static_cast<Node*>(last);
+                    throw;
+                }
+                tail_ = static_cast<Node*>(last);
+                check_ends();
+            }
+            /*!
+             * \brief Sort the container (using `operator<`).
+             *
+             * The sort is stable: equivalent elements keep their relative order.
+             *
+             * \note Bottom-up merge sort in O(n log(n)) time and constant extra memory.
+             * The nodes are relinked, the values are neither copied nor moved and the iterators remain valid.
+             */
+            void sort()
+            {
+                sort([](const T & lhs, const T & rhs){ return lhs < rhs; });
+            }
+            /*!
+             * \brief Remove the consecutive duplicates.
+             * \param[in] pred The equality predicate
+             * \return The number of removed elements
+             *
+             * Each element equal (according to \p pred) to the first element of its group is removed.
+             *
+             * \note Linear time, only the removed nodes are destroyed.
+             */
+            template <typename BinaryPredicate>
+            size_t unique(BinaryPredicate pred)
+            {
+                size_t count = 0;
+                for(Node * current = head_.next; current && current->next;)
+                {
+                    if(pred(current->value, current->next->value))
+                    {
+                        erase_node_after(current);
+                        ++count;
+                    }
+                    else
+                        current = current->next;
+                }
+                return count;
+            }
+            /*!
+             * \brief Remove the consecutive duplicates (using `operator==`).
+             * \return The number of removed elements
+             *
+             * \note Linear time, only the removed nodes are destroyed.
+             */
+            size_t unique()
+            {
+                return unique([](const T & lhs, const T & rhs){ return lhs == rhs; });
+            }
+            /*!
+             * \brief Remove the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass: each node is unlinked and destroyed as soon as it is found.
+             * If \p pred throws, the elements already removed stay removed.
+             */
+            template <typename UnaryPredicate>
+            size_t remove_if(UnaryPredicate pred)
+            {
+                size_t removed = 0;
+                for(Link * current = &head_; current->next;)
+                {
+                    if(pred(current->next->value))
+                    {
+                        erase_node_after(current);
+                        ++removed;
+                    }
+                    else
+                        current = current->next;
+                }
+                return removed;
+            }
+            /*!
+             * \brief Remove the elements equal to a value.
+             * \param[in] val The value to remove (can be an element of the container)
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass. (remove() removes by position.)
+             */
+            size_t remove_value(const T & val)
+            {
+                Link * self = nullptr; // the link preceding the node of val (removed last) if val is an element
+                size_t removed = 0;
+                for(Link * current = &head_; current->next;)
+                {
+                    if(std::addressof(current->next->value) == std::addressof(val))
+                    {
+                        self = current;
+                        current = current->next;
+                    }
+                    else if(current->next->value == val)
+                    {
+                        erase_node_after(current);
+                        ++removed;
+                    }
+                    else
+                        current = current->next;
+                }
+                if(self)
+                {
+                    erase_node_after(self);
+                    ++removed;
+                }
+                return removed;
+            }
+            /*!
+             * \brief Reverse the order of the elements.
+             *
+             * \note Linear time, the nodes are relinked and the iterators remain valid.
+             */
+            void reverse() noexcept
+            {
+                index_.invalidate();
+                Node * previous = nullptr;
+                Node * current = head_.next;
+                tail_ = current;
+                while(current)
+                {
+                    Node * next = current->next;
+                    current->next = previous;
+                    previous = current;
+                    current = next;
+                }
+                head_.next = previous;
+                check_ends();
+            }
+
             // Iterator conversions
             /*!
              * \brief Iterator conversion.
@@ -824,10 +2379,40 @@ namespace manual
                 static_assert((std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::LinkedList::iterator_cast - Forbidden template type provided.");
 
                 IT_type res;
+                static_cast<Position &>(res) = it;
                 res.node = it.node;
                 return res;
             }
+
+        protected:
+            /*!
+             * \brief Get the link an iterator refers to (for the containers built on a LinkedList).
+             * \param[in] cit The iterator
+             * \return The link of the element (`&head_` for before_begin(), `nullptr` for end())
+             */
+            static Link * link_of(const ConstIterator & cit) noexcept
+            {
+                return cit.node;
+            }
     };
+
+#ifdef MANUAL_HAS_PMR
+    namespace pmr
+    {
+        template <typename T> using LinkedList = manual::LinkedList<T, std::pmr::polymorphic_allocator<T>>; /*!< LinkedList using a `std::pmr::memory_resource` */
+    }
+#endif
+
+    // The moves do not throw: a std::vector of lists relocates them by move
+    static_assert(std::is_nothrow_move_constructible<LinkedList<int>>::value && std::is_nothrow_move_assignable<LinkedList<int>>::value, "manual::LinkedList - The moves may throw.");
+    static_assert(std::is_nothrow_move_constructible<LinkedList<int, std::allocator<int>, CheckpointIndex>>::value, "manual::LinkedList - The move constructor may throw (with an index).");
+    static_assert(std::is_nothrow_default_constructible<LinkedList<int>>::value, "manual::LinkedList - The default constructor may throw.");
+
+#ifdef __cpp_lib_ranges
+    // The container models the standard range concepts (C++20)
+    static_assert(std::ranges::forward_range<LinkedList<int>> && std::ranges::sized_range<LinkedList<int>>, "manual::LinkedList - Not a forward_range.");
+    static_assert(std::ranges::forward_range<const LinkedList<int>>, "manual::LinkedList - Not a `const` forward_range.");
+#endif
 }
 
 #endif // MANUAL_LINKEDLIST_H
@@ -0,0 +1,150 @@
+#ifndef MANUAL_LINKEDQUEUE_H
+#define MANUAL_LINKEDQUEUE_H
+
+/*!
+ * \file linkedqueue.h
+ * \brief A queue adaptor of the linked list (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include "linkedlist.h"
+
+namespace manual
+{
+    /*!
+     * \class LinkedQueue
+     * \brief A FIFO container built on a LinkedList.
+     *
+     * The values are pushed at the tail and popped from the head of the list, so that all the operations are performed in constant time
+     * (unlike LinkedList::pop_back() which has to find the node preceding the tail).
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class LinkedQueue
+    {
+        protected:
+            // data members
+            LinkedList<T, Allocator> list_; /*!< The underlying list (its head is the front) */
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty queue.
+             */
+            LinkedQueue() : list_()
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates an empty queue.
+             */
+            explicit LinkedQueue(const Allocator & alloc) : list_(alloc)
+            {}
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const
+            {
+                return list_.size();
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the queue is empty, `false` otherwise
+             */
+            bool empty() const
+            {
+                return list_.empty();
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the next element to be popped.
+             * \return A direct reference to the front value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & front()
+            {
+                return list_.front();
+            }
+            /*!
+             * \brief Get the next element to be popped.
+             * \return A direct `const` reference to the front value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return list_.front();
+            }
+            /*!
+             * \brief Get the last pushed element.
+             * \return A direct reference to the back value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & back()
+            {
+                return list_.back();
+            }
+            /*!
+             * \brief Get the last pushed element.
+             * \return A direct `const` reference to the back value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & back() const
+            {
+                return list_.back();
+            }
+
+            // Modifiers
+            /*!
+             * \brief Add a value at the back of the container.
+             * \param[in] val The value to push
+             */
+            void push(const T & val)
+            {
+                list_.push_back(val);
+            }
+            /*!
+             * \brief Add a value at the back of the container.
+             * \param[in,out] val The value to push (moved)
+             */
+            void push(T && val)
+            {
+                list_.push_back(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the back of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace(Args &&... args)
+            {
+                return list_.emplace_back(std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the front value of the container (if any).
+             */
+            void pop()
+            {
+                list_.pop_front();
+            }
+            /*!
+             * \brief Clear the container.
+             */
+            void clear()
+            {
+                list_.clear();
+            }
+    };
+}
+
+#endif // MANUAL_LINKEDQUEUE_H
@@ -0,0 +1,130 @@
+#ifndef MANUAL_LINKEDSTACK_H
+#define MANUAL_LINKEDSTACK_H
+
+/*!
+ * \file linkedstack.h
+ * \brief A stack adaptor of the linked list (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include "linkedlist.h"
+
+namespace manual
+{
+    /*!
+     * \class LinkedStack
+     * \brief A LIFO container built on a LinkedList.
+     *
+     * All the operations work on the head of the list, so that they are all performed in constant time
+     * (unlike LinkedList::pop_back() which has to find the node preceding the tail).
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class LinkedStack
+    {
+        protected:
+            // data members
+            LinkedList<T, Allocator> list_; /*!< The underlying list (its head is the top) */
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty stack.
+             */
+            LinkedStack() : list_()
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates an empty stack.
+             */
+            explicit LinkedStack(const Allocator & alloc) : list_(alloc)
+            {}
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const
+            {
+                return list_.size();
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the stack is empty, `false` otherwise
+             */
+            bool empty() const
+            {
+                return list_.empty();
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the top element.
+             * \return A direct reference to the top value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & top()
+            {
+                return list_.front();
+            }
+            /*!
+             * \brief Get the top element.
+             * \return A direct `const` reference to the top value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & top() const
+            {
+                return list_.front();
+            }
+
+            // Modifiers
+            /*!
+             * \brief Add a value on the top of the container.
+             * \param[in] val The value to push
+             */
+            void push(const T & val)
+            {
+                list_.push_front(val);
+            }
+            /*!
+             * \brief Add a value on the top of the container.
+             * \param[in,out] val The value to push (moved)
+             */
+            void push(T && val)
+            {
+                list_.push_front(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place on the top of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             */
+            template <typename... Args>
+            T & emplace(Args &&... args)
+            {
+                return list_.emplace_front(std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the top value of the container (if any).
+             */
+            void pop()
+            {
+                list_.pop_front();
+            }
+            /*!
+             * \brief Clear the container.
+             */
+            void clear()
+            {
+                list_.clear();
+            }
+    };
+}
+
+#endif // MANUAL_LINKEDSTACK_H
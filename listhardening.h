@@ -0,0 +1,157 @@
+#ifndef MANUAL_LISTHARDENING_H
+#define MANUAL_LISTHARDENING_H
+
+/*!
+ * \file listhardening.h
+ * \brief The hardened mode of the linked lists: cheap checks of the invariants and of the iterators (proposal).
+ * \author Raphaël Lefèvre
+ *
+ * Define `MANUAL_HARDENED` (before including any header of the library) to enable the checks:
+ * - the bounds of `operator[]`, and `front()` / `back()` of an empty list,
+ * - the iterators: each node gets a stamp when it is created and loses it when it is destroyed, an iterator keeps the stamp of its node
+ *   and any use of a stale iterator (its element was erased, even if the memory was reused by a new node) fails,
+ * - the consistency of the head, the tail and the size after the modifications (and of the `previous` links around the modified nodes).
+ *
+ * All the checks are constant time. A failed check calls `MANUAL_HARDENED_FAILURE(message)`,
+ * which prints the message and aborts by default (define it to a function or a `throw` expression to handle the failures).
+ *
+ * \note Without `MANUAL_HARDENED`, the macros expand to nothing and the containers and their iterators are unchanged.
+ * \warning Throwing from `MANUAL_HARDENED_FAILURE` in a `noexcept` function (e.g. `pop_back()`) terminates the program.
+ */
+
+#ifdef MANUAL_HARDENED
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <type_traits>
+#endif
+
+#ifdef MANUAL_HARDENED
+#ifndef MANUAL_HARDENED_FAILURE
+#define MANUAL_HARDENED_FAILURE(message) ::manual::hardened_abort(message, __FILE__, __LINE__)
+#endif
+#define MANUAL_HARDENED_CHECK(condition, message) ((condition) ? static_cast<void>(0) : MANUAL_HARDENED_FAILURE(message))
+#define MANUAL_HARDENED_ONLY(...) __VA_ARGS__
+#else
+#define MANUAL_HARDENED_CHECK(condition, message) static_cast<void>(0)
+#define MANUAL_HARDENED_ONLY(...)
+#endif
+
+namespace manual
+{
+#ifdef MANUAL_HARDENED
+    constexpr bool hardened_mode = true; /*!< `true` if the hardened checks are enabled (`MANUAL_HARDENED`) */
+
+    /*!
+     * \brief The default handler of a failed check: print the message and abort.
+     * \param[in] message The failed check
+     * \param[in] file The file of the check
+     * \param[in] line The line of the check
+     */
+    [[noreturn]] inline void hardened_abort(const char * message, const char * file, int line) noexcept
+    {
+        std::fprintf(stderr, "[Hardened check failed] - %s (%s:%d)\n", message, file, line);
+        std::abort();
+    }
+
+    /*!
+     * \brief Get the first stamp of a new list.
+     * \return A stamp no other list started from
+     *
+     * \note Each list stamps its nodes from its own range of 2^32 stamps, so that a stamp is never given twice
+     * (unless a list creates more than 2^32 nodes).
+     */
+    inline std::uint64_t hardened_stamp_base() noexcept
+    {
+        static std::atomic<std::uint64_t> next(std::uint64_t(1) << 32);
+        return next.fetch_add(std::uint64_t(1) << 32, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \class CheckedLink
+     * \brief The link of an iterator to its node, with the stamp of the node (hardened mode).
+     * \tparam Link The type of the node (or of the link preceding the head)
+     *
+     * The link converts to a `Link *` as the plain pointer it replaces: the conversion checks that the node still has the stamp
+     * it had when the link was set (it does not if the node was destroyed, or reused by a new node).
+     * A `nullptr` link is never checked.
+     */
+    template <typename Link>
+    class CheckedLink final
+    {
+        protected:
+            Link * link_;         /*!< The node */
+            std::uint64_t stamp_; /*!< The stamp of the node when the link was set */
+
+        public:
+            /*!
+             * \brief Pointer constructor.
+             * \param[in] link The node (can be `nullptr`)
+             */
+            CheckedLink(Link * link = nullptr) noexcept : link_(link), stamp_(link ? link->stamp : 0)
+            {}
+            /*!
+             * \brief Assignment operator.
+             * \param[in] link The node (can be `nullptr`)
+             * \return A reference to `*this`
+             */
+            CheckedLink & operator=(Link * link) noexcept
+            {
+                link_ = link;
+                stamp_ = link ? link->stamp : 0;
+                return *this;
+            }
+            /*!
+             * \brief Get the node.
+             * \return The node, checked
+             */
+            Link * get() const noexcept
+            {
+                MANUAL_HARDENED_CHECK(!link_ || link_->stamp == stamp_, "manual - Use of an invalidated iterator (its element was erased).");
+                return link_;
+            }
+            /*!
+             * \brief Conversion operator.
+             * \return The node, checked
+             */
+            operator Link*() const noexcept
+            {
+                return get();
+            }
+            /*!
+             * \brief Conversion operator to a derived node type (`static_cast<Node*>(link)`).
+             * \return The node, checked
+             */
+            template <typename Derived, typename = typename std::enable_if<std::is_base_of<Link, Derived>::value && !std::is_same<Link, Derived>::value>::type>
+            explicit operator Derived*() const noexcept
+            {
+                return static_cast<Derived*>(get());
+            }
+            /*!
+             * \brief Member of pointer operator.
+             * \return The node, checked
+             */
+            Link * operator->() const noexcept
+            {
+                return get();
+            }
+    };
+
+    /*!
+     * \brief The link type of the iterators: a CheckedLink in hardened mode, a plain pointer otherwise.
+     */
+    template <typename Link>
+    using iterator_link_t = CheckedLink<Link>;
+#else
+    constexpr bool hardened_mode = false; /*!< `true` if the hardened checks are enabled (`MANUAL_HARDENED`) */
+
+    /*!
+     * \brief The link type of the iterators: a CheckedLink in hardened mode, a plain pointer otherwise.
+     */
+    template <typename Link>
+    using iterator_link_t = Link *;
+#endif
+}
+
+#endif // MANUAL_LISTHARDENING_H
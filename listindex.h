@@ -0,0 +1,422 @@
+#ifndef MANUAL_LISTINDEX_H
+#define MANUAL_LISTINDEX_H
+
+/*!
+ * \file listindex.h
+ * \brief Index policies for the positional access of the linked lists (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace manual
+{
+    /*!
+     * \struct NoIndex
+     * \brief The default index policy: no index at all.
+     *
+     * The positional access walks the list. The policy is empty and all its hooks are no-ops, so that the list keeps its plain footprint.
+     */
+    struct NoIndex final
+    {
+        /*!
+         * \class Index
+         * \brief The (empty) index of a list of \p Node.
+         */
+        template <typename Node>
+        class Index final
+        {
+            public:
+                /*!
+                 * \brief Find a node to start walking from.
+                 * \return Always `false` (walk from the head)
+                 */
+                bool nearest(size_t, Node *, size_t, Node *&, size_t &) const noexcept
+                {
+                    return false;
+                }
+                /*!
+                 * \brief Get the minimal distance of an iterator jump worth looking the target up.
+                 * \return Always the maximal `size_t` (the iterators walk)
+                 */
+                size_t jump_distance() const noexcept
+                {
+                    return static_cast<size_t>(-1);
+                }
+                /*!
+                 * \brief Notify an insertion at a known position (no-op).
+                 */
+                void on_insert(size_t, size_t) noexcept
+                {}
+                /*!
+                 * \brief Notify a removal at a known position (no-op).
+                 */
+                void on_erase(size_t, Node *) noexcept
+                {}
+                /*!
+                 * \brief Notify the container was cleared (no-op).
+                 */
+                void on_clear() noexcept
+                {}
+                /*!
+                 * \brief Notify an unknown change of the layout (no-op).
+                 */
+                void invalidate() noexcept
+                {}
+        };
+    };
+
+    /*!
+     * \struct CheckpointIndex
+     * \brief An index policy keeping a sparse array of checkpoints (position, node).
+     *
+     * The checkpoints are about `sqrt(n)` nodes apart, so that the positional access costs a binary search plus a walk of `O(sqrt(n))` nodes.
+     * - The index-based modifiers (`push_*()`, `pop_*()`, `insert()`, `emplace()`, `remove()`) update the checkpoints in `O(sqrt(n))`.
+     * - The other modifiers (iterator-based, splice, sort...) only mark the index as stale: it is rebuilt in linear time by the next positional access.
+     *
+     * \note The checkpoints are stored in a `std::vector` (they do not use the allocator of the list).
+     * \warning A positional access may rebuild the index, even on a `const` container: concurrent reads are not thread-safe.
+     */
+    struct CheckpointIndex final
+    {
+        /*!
+         * \class Index
+         * \brief The index of a list of \p Node.
+         */
+        template <typename Node>
+        class Index final
+        {
+            private:
+                /*!
+                 * \struct Checkpoint
+                 * \brief A node and its position in the list.
+                 */
+                struct Checkpoint final
+                {
+                    size_t position; /*!< The position of the node */
+                    Node * node;     /*!< The node */
+                };
+
+                // data members
+                mutable std::vector<Checkpoint> checkpoints_; /*!< The checkpoints (sorted by position) */
+                mutable size_t stride_;                       /*!< The distance between the checkpoints at the last rebuild */
+                mutable size_t built_size_;                   /*!< The size of the container at the last rebuild */
+                mutable bool stale_;                          /*!< Whether the index must be rebuilt before use */
+
+                /*!
+                 * \brief Rebuild all the checkpoints.
+                 * \param[in] first The first node of the list
+                 * \param[in] size The size of the list
+                 */
+                void rebuild(Node * first, size_t size) const
+                {
+                    stride_ = 8;
+                    while(stride_ * stride_ < size)
+                        stride_ *= 2;
+
+                    checkpoints_.clear();
+                    size_t position = 0;
+                    for(Node * current = first; current; current = current->next, ++position)
+                    {
+                        if(position % stride_ == 0)
+                            checkpoints_.push_back(Checkpoint{position, current});
+                    }
+                    built_size_ = size;
+                    stale_ = false;
+                }
+                /*!
+                 * \brief Find the first checkpoint at or after a position.
+                 * \param[in] position The position to look for
+                 * \return An iterator to the checkpoint (end if none)
+                 */
+                typename std::vector<Checkpoint>::iterator first_from(size_t position) const
+                {
+                    return std::lower_bound(checkpoints_.begin(), checkpoints_.end(), position, [](const Checkpoint & cp, size_t pos){ return cp.position < pos; });
+                }
+
+            public:
+                // Constructors
+                /*!
+                 * \brief Default constructor.
+                 *
+                 * Creates a stale (empty) index.
+                 */
+                Index() noexcept : checkpoints_(), stride_(0), built_size_(0), stale_(true)
+                {}
+                /*!
+                 * \brief Copy constructor.
+                 *
+                 * Creates a stale index: the checkpoints refer to the nodes of another list.
+                 */
+                Index(const Index &) noexcept : Index()
+                {}
+                /*!
+                 * \brief Move constructor.
+                 * \param[in,out] other The Index to move from (left stale)
+                 */
+                Index(Index && other) noexcept : checkpoints_(std::move(other.checkpoints_)),
+                                                 stride_(other.stride_),
+                                                 built_size_(other.built_size_),
+                                                 stale_(std::exchange(other.stale_, true))
+                {}
+                /*!
+                 * \brief Copy assignment operator.
+                 * \return A reference to `*this` (stale)
+                 */
+                Index & operator=(const Index &) noexcept
+                {
+                    invalidate();
+                    return *this;
+                }
+                /*!
+                 * \brief Move assignment operator.
+                 * \param[in,out] other The Index to move from (left stale)
+                 * \return A reference to `*this`
+                 */
+                Index & operator=(Index && other) noexcept
+                {
+                    if(this != &other)
+                    {
+                        checkpoints_ = std::move(other.checkpoints_);
+                        stride_ = other.stride_;
+                        built_size_ = other.built_size_;
+                        stale_ = std::exchange(other.stale_, true);
+                    }
+                    return *this;
+                }
+
+                /*!
+                 * \brief Find a node to start walking from.
+                 * \param[in] index The position to reach
+                 * \param[in] first The first node of the list
+                 * \param[in] size The size of the list
+                 * \param[out] node The closest checkpointed node at or before \p index
+                 * \param[out] position The position of \p node
+                 * \return `true` if a checkpoint was found, `false` otherwise (walk from the head)
+                 *
+                 * \note If the checkpoints cannot be rebuilt (out of memory), the index stays stale and the walk starts from the head.
+                 */
+                bool nearest(size_t index, Node * first, size_t size, Node *& node, size_t & position) const noexcept
+                {
+                    if(stale_ || 2 * size < built_size_)
+                    {
+                        try
+                        {
+                            rebuild(first, size);
+                        }
+                        catch(...)
+                        {
+                            checkpoints_.clear();
+                            stale_ = true;
+                            return false;
+                        }
+                    }
+
+                    typename std::vector<Checkpoint>::iterator it = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), index, [](size_t pos, const Checkpoint & cp){ return pos < cp.position; });
+                    if(it == checkpoints_.begin())
+                        return false;
+                    --it;
+                    node = it->node;
+                    position = it->position;
+                    return true;
+                }
+                /*!
+                 * \brief Get the minimal distance of an iterator jump worth looking the target up.
+                 * \return Twice the stride: a jump walks up to a stride twice (to check the position of the iterator, then to reach the target)
+                 */
+                size_t jump_distance() const noexcept
+                {
+                    return stride_ ? 2 * stride_ : 16;
+                }
+                /*!
+                 * \brief Notify an insertion at a known position.
+                 * \param[in] index The position of the inserted node
+                 * \param[in] size The size of the list after the insertion
+                 *
+                 * \note The index becomes stale when the gap holding the new node grows beyond twice the stride.
+                 */
+                void on_insert(size_t index, size_t size) noexcept
+                {
+                    if(stale_)
+                        return;
+
+                    typename std::vector<Checkpoint>::iterator it = first_from(index);
+                    size_t gap_begin = (it == checkpoints_.begin()) ? 0 : (it-1)->position;
+                    for(typename std::vector<Checkpoint>::iterator cp = it; cp != checkpoints_.end(); ++cp)
+                        ++cp->position;
+                    size_t gap_end = (it == checkpoints_.end()) ? size : it->position;
+                    if(gap_end - gap_begin > 2 * stride_)
+                        stale_ = true;
+                }
+                /*!
+                 * \brief Notify a removal at a known position.
+                 * \param[in] index The position of the removed node
+                 * \param[in] next The node following the removed one (`nullptr` if none)
+                 *
+                 * \note Must be called before the node is destroyed, a removed checkpoint is moved to \p next.
+                 */
+                void on_erase(size_t index, Node * next) noexcept
+                {
+                    if(stale_)
+                        return;
+
+                    typename std::vector<Checkpoint>::iterator it = first_from(index);
+                    if(it != checkpoints_.end() && it->position == index) // the removed node is a checkpoint
+                    {
+                        typename std::vector<Checkpoint>::iterator after = it+1;
+                        if(!next || (after != checkpoints_.end() && after->node == next))
+                            it = checkpoints_.erase(it);
+                        else
+                        {
+                            it->node = next;
+                            ++it;
+                        }
+                    }
+                    for(; it != checkpoints_.end(); ++it)
+                        --it->position;
+                }
+                /*!
+                 * \brief Notify the container was cleared.
+                 */
+                void on_clear() noexcept
+                {
+                    checkpoints_.clear();
+                    stale_ = true;
+                }
+                /*!
+                 * \brief Notify an unknown change of the layout.
+                 *
+                 * The index will be rebuilt by the next positional access.
+                 */
+                void invalidate() noexcept
+                {
+                    stale_ = true;
+                }
+        };
+    };
+
+    /*!
+     * \class IteratorPosition
+     * \brief The position cached by an iterator of an indexed list, for the fast jumps (`operator+=`, `operator-=`, `next()`, `prev()`).
+     *
+     * The iterators returned by `begin()`, `end()`... know their position, which the increments and decrements keep up to date.
+     * Before a jump, the list checks with its index that the element is still at this position (the list may have changed since),
+     * then looks the target up with the index: `O(log(n) + sqrt(n))` instead of `O(distance)` with manual::CheckpointIndex.<br/>
+     * The other iterators (returned by the modifiers, or whose check failed) walk as without an index.
+     */
+    template <typename List, bool Indexed>
+    class IteratorPosition
+    {
+        protected:
+            const List * list_; /*!< The list of the element (`nullptr` if the position is unknown) */
+            size_t position_;   /*!< The position of the element */
+
+        public:
+            /*!
+             * \brief Default constructor.
+             *
+             * The position is unknown.
+             */
+            IteratorPosition() noexcept : list_(nullptr), position_(0)
+            {}
+            /*!
+             * \brief Set the position.
+             * \param[in] list The list of the element
+             * \param[in] position The position of the element
+             */
+            void remember(const List * list, size_t position) noexcept
+            {
+                list_ = list;
+                position_ = position;
+            }
+            /*!
+             * \brief Mark the position as unknown.
+             */
+            void forget() noexcept
+            {
+                list_ = nullptr;
+            }
+            /*!
+             * \brief Follow an increment of the position.
+             */
+            void step_forward() noexcept
+            {
+                ++position_;
+            }
+            /*!
+             * \brief Follow a decrement of the position.
+             */
+            void step_backward() noexcept
+            {
+                --position_;
+            }
+            /*!
+             * \brief Get the list the position is known in.
+             * \return The list (`nullptr` if the position is unknown)
+             */
+            const List * indexed_list() const noexcept
+            {
+                return list_;
+            }
+            /*!
+             * \brief Get the cached position.
+             * \return A reference to the position (meaningful only if indexed_list() is not `nullptr`)
+             */
+            size_t & cached_position() noexcept
+            {
+                return position_;
+            }
+    };
+
+    /*!
+     * \class IteratorPosition
+     * \brief No cached position: an iterator of a list without index always walks (the class is empty).
+     */
+    template <typename List>
+    class IteratorPosition<List, false>
+    {
+        public:
+            /*!
+             * \brief Set the position (no-op).
+             */
+            void remember(const List *, size_t) noexcept
+            {}
+            /*!
+             * \brief Mark the position as unknown (no-op).
+             */
+            void forget() noexcept
+            {}
+            /*!
+             * \brief Follow an increment of the position (no-op).
+             */
+            void step_forward() noexcept
+            {}
+            /*!
+             * \brief Follow a decrement of the position (no-op).
+             */
+            void step_backward() noexcept
+            {}
+            /*!
+             * \brief Get the list the position is known in.
+             * \return Always `nullptr` (walk)
+             */
+            const List * indexed_list() const noexcept
+            {
+                return nullptr;
+            }
+            /*!
+             * \brief Get the cached position (never used).
+             * \return A reference to a dummy position
+             */
+            size_t & cached_position() noexcept
+            {
+                static size_t dummy = 0;
+                return dummy;
+            }
+    };
+}
+
+#endif // MANUAL_LISTINDEX_H
@@ -0,0 +1,346 @@
+#ifndef MANUAL_LISTSCAN_H
+#define MANUAL_LISTSCAN_H
+
+/*!
+ * \file listscan.h
+ * \brief Comparison kernels scanning the contiguous storage of the lists (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// The vector kernels need the GCC/Clang builtins, and the instruction set enabled at compile time (e.g. `-mavx2`)
+#if !defined(MANUAL_NO_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MANUAL_SIMD_AVX2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define MANUAL_SIMD_NEON
+#endif
+#endif
+
+namespace manual
+{
+    /*!
+     * \struct ScanKernel
+     * \brief The search of a value in a contiguous range, one element at a time.
+     * \tparam T The type of the values
+     *
+     * It is the kernel of the types without a vector comparison (see the specialization for the arithmetic types).
+     */
+    template <typename T, typename = void>
+    struct ScanKernel final
+    {
+        /*!
+         * \brief Find the first element equal to a value.
+         * \param[in] first The first element of the range
+         * \param[in] count The number of elements of the range
+         * \param[in] val The value to look for
+         * \return The position of the first element equal to \p val, \p count if there is none
+         */
+        static size_t find(const T * first, size_t count, const T & val)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                if(first[i] == val)
+                    return i;
+            }
+            return count;
+        }
+        /*!
+         * \brief Count the elements equal to a value.
+         * \param[in] first The first element of the range
+         * \param[in] count The number of elements of the range
+         * \param[in] val The value to look for
+         * \return The number of elements equal to \p val
+         */
+        static size_t count(const T * first, size_t count, const T & val)
+        {
+            size_t res = 0;
+            for(size_t i = 0; i < count; ++i)
+            {
+                if(first[i] == val)
+                    ++res;
+            }
+            return res;
+        }
+    };
+
+#if defined(MANUAL_SIMD_AVX2) || defined(MANUAL_SIMD_NEON)
+    /*!
+     * \struct SimdCompare
+     * \brief The vector comparison of a block of values with a value.
+     *
+     * `mask(p, val)` compares the `bytes / sizeof(T)` values at \p p with \p val,
+     * and returns a mask holding `bits_per_byte` set bits for each byte of the equal values.
+     */
+    struct SimdCompare final
+    {
+#if defined(MANUAL_SIMD_AVX2)
+        typedef uint32_t Mask;                         /*!< The type of the comparison masks */
+        static constexpr size_t bytes = 32;            /*!< The number of bytes compared at once */
+        static constexpr unsigned bits_per_byte = 1;   /*!< The number of mask bits of a byte */
+
+        /*!
+         * \brief Compare 8-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint8_t val) noexcept
+        {
+            return static_cast<Mask>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(static_cast<const __m256i*>(p)), _mm256_set1_epi8(static_cast<char>(val)))));
+        }
+        /*!
+         * \brief Compare 16-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint16_t val) noexcept
+        {
+            return static_cast<Mask>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_loadu_si256(static_cast<const __m256i*>(p)), _mm256_set1_epi16(static_cast<short>(val)))));
+        }
+        /*!
+         * \brief Compare 32-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint32_t val) noexcept
+        {
+            return static_cast<Mask>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256(static_cast<const __m256i*>(p)), _mm256_set1_epi32(static_cast<int>(val)))));
+        }
+        /*!
+         * \brief Compare 64-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint64_t val) noexcept
+        {
+            return static_cast<Mask>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(_mm256_loadu_si256(static_cast<const __m256i*>(p)), _mm256_set1_epi64x(static_cast<long long>(val)))));
+        }
+        /*!
+         * \brief Compare `float` lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, float val) noexcept
+        {
+            return static_cast<Mask>(_mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_loadu_ps(static_cast<const float*>(p)), _mm256_set1_ps(val), _CMP_EQ_OQ))));
+        }
+        /*!
+         * \brief Compare `double` lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, double val) noexcept
+        {
+            return static_cast<Mask>(_mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_loadu_pd(static_cast<const double*>(p)), _mm256_set1_pd(val), _CMP_EQ_OQ))));
+        }
+        /*!
+         * \brief Get the position of the lowest set bit.
+         * \param[in] mask A comparison mask (not zero)
+         * \return The position of the bit
+         */
+        static unsigned first_bit(Mask mask) noexcept
+        {
+            return static_cast<unsigned>(__builtin_ctz(mask));
+        }
+        /*!
+         * \brief Count the set bits.
+         * \param[in] mask A comparison mask
+         * \return The number of set bits
+         */
+        static unsigned bit_count(Mask mask) noexcept
+        {
+            return static_cast<unsigned>(__builtin_popcount(mask));
+        }
+#else
+        typedef uint64_t Mask;                         /*!< The type of the comparison masks */
+        static constexpr size_t bytes = 16;            /*!< The number of bytes compared at once */
+        static constexpr unsigned bits_per_byte = 4;   /*!< The number of mask bits of a byte */
+
+        /*!
+         * \brief Narrow each byte of a comparison to a nibble (the NEON equivalent of a movemask).
+         * \param[in] equal The comparison
+         * \return The comparison mask
+         */
+        static Mask narrow(uint8x16_t equal) noexcept
+        {
+            return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+        }
+        /*!
+         * \brief Compare 8-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint8_t val) noexcept
+        {
+            return narrow(vceqq_u8(vld1q_u8(static_cast<const uint8_t*>(p)), vdupq_n_u8(val)));
+        }
+        /*!
+         * \brief Compare 16-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint16_t val) noexcept
+        {
+            return narrow(vreinterpretq_u8_u16(vceqq_u16(vld1q_u16(static_cast<const uint16_t*>(p)), vdupq_n_u16(val))));
+        }
+        /*!
+         * \brief Compare 32-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint32_t val) noexcept
+        {
+            return narrow(vreinterpretq_u8_u32(vceqq_u32(vld1q_u32(static_cast<const uint32_t*>(p)), vdupq_n_u32(val))));
+        }
+        /*!
+         * \brief Compare 64-bit lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, uint64_t val) noexcept
+        {
+            return narrow(vreinterpretq_u8_u64(vceqq_u64(vld1q_u64(static_cast<const uint64_t*>(p)), vdupq_n_u64(val))));
+        }
+        /*!
+         * \brief Compare `float` lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, float val) noexcept
+        {
+            return narrow(vreinterpretq_u8_u32(vceqq_f32(vld1q_f32(static_cast<const float*>(p)), vdupq_n_f32(val))));
+        }
+        /*!
+         * \brief Compare `double` lanes.
+         * \param[in] p The block of values (unaligned)
+         * \param[in] val The value to compare with
+         * \return The comparison mask
+         */
+        static Mask mask(const void * p, double val) noexcept
+        {
+            return narrow(vreinterpretq_u8_u64(vceqq_f64(vld1q_f64(static_cast<const double*>(p)), vdupq_n_f64(val))));
+        }
+        /*!
+         * \brief Get the position of the lowest set bit.
+         * \param[in] mask A comparison mask (not zero)
+         * \return The position of the bit
+         */
+        static unsigned first_bit(Mask mask) noexcept
+        {
+            return static_cast<unsigned>(__builtin_ctzll(mask));
+        }
+        /*!
+         * \brief Count the set bits.
+         * \param[in] mask A comparison mask
+         * \return The number of set bits
+         */
+        static unsigned bit_count(Mask mask) noexcept
+        {
+            return static_cast<unsigned>(__builtin_popcountll(mask));
+        }
+#endif
+    };
+
+    /*!
+     * \struct ScanKernel
+     * \brief The search of a value in a contiguous range of arithmetic values, one vector at a time (AVX2 or NEON).
+     * \tparam T The type of the values (an integer, `float` or `double`)
+     *
+     * The integers are compared bitwise and the floating-point values with the semantics of `operator==` (`NaN` is never found, `-0.0` equals `0.0`).
+     */
+    template <typename T>
+    struct ScanKernel<T, typename std::enable_if<(std::is_integral<T>::value && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+                                                 || std::is_same<T, float>::value || std::is_same<T, double>::value>::type> final
+    {
+        private:
+            /*!
+             * \brief The type of the value given to the comparison (an unsigned integer of the same size, or the floating-point type itself).
+             */
+            typedef typename std::conditional<std::is_floating_point<T>::value, T,
+                    typename std::conditional<sizeof(T) == 1, uint8_t,
+                    typename std::conditional<sizeof(T) == 2, uint16_t,
+                    typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type>::type>::type Lane;
+
+            static constexpr size_t lanes = SimdCompare::bytes / sizeof(T);                /*!< The number of values compared at once */
+            static constexpr unsigned bits_per_lane = SimdCompare::bits_per_byte * sizeof(T); /*!< The number of mask bits of a value */
+
+            /*!
+             * \brief Get the bits of a value as a Lane.
+             * \param[in] val The value
+             * \return The value given to the comparison
+             */
+            static Lane lane(const T & val) noexcept
+            {
+                Lane res;
+                std::memcpy(&res, &val, sizeof(T));
+                return res;
+            }
+
+        public:
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] first The first element of the range
+             * \param[in] count The number of elements of the range
+             * \param[in] val The value to look for
+             * \return The position of the first element equal to \p val, \p count if there is none
+             */
+            static size_t find(const T * first, size_t count, const T & val) noexcept
+            {
+                const Lane needle = lane(val);
+                size_t i = 0;
+                for(; i + lanes <= count; i += lanes)
+                {
+                    SimdCompare::Mask mask = SimdCompare::mask(first + i, needle);
+                    if(mask)
+                        return i + SimdCompare::first_bit(mask) / bits_per_lane;
+                }
+                for(; i < count; ++i)
+                {
+                    if(first[i] == val)
+                        return i;
+                }
+                return count;
+            }
+            /*!
+             * \brief Count the elements equal to a value.
+             * \param[in] first The first element of the range
+             * \param[in] count The number of elements of the range
+             * \param[in] val The value to look for
+             * \return The number of elements equal to \p val
+             */
+            static size_t count(const T * first, size_t count, const T & val) noexcept
+            {
+                const Lane needle = lane(val);
+                size_t res = 0;
+                size_t i = 0;
+                for(; i + lanes <= count; i += lanes)
+                    res += SimdCompare::bit_count(SimdCompare::mask(first + i, needle)) / bits_per_lane;
+                for(; i < count; ++i)
+                {
+                    if(first[i] == val)
+                        ++res;
+                }
+                return res;
+            }
+    };
+#endif
+}
+
+#endif // MANUAL_LISTSCAN_H
@@ -0,0 +1,132 @@
+#ifndef MANUAL_LISTSTATS_H
+#define MANUAL_LISTSTATS_H
+
+/*!
+ * \file liststats.h
+ * \brief Statistics policies for the instrumentation of the linked lists (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+
+namespace manual
+{
+    /*!
+     * \struct ListStats
+     * \brief The counters of a list, as returned by `stats()`.
+     */
+    struct ListStats final
+    {
+        size_t allocations = 0;   /*!< The number of nodes obtained from the allocator */
+        size_t deallocations = 0; /*!< The number of nodes given back to the allocator */
+        size_t walks = 0;         /*!< The number of operations which walked the list to reach a position */
+        size_t hops = 0;          /*!< The total number of links followed by these walks */
+        size_t longest_walk = 0;  /*!< The largest number of links followed by a single walk */
+    };
+
+    /*!
+     * \struct NoStats
+     * \brief The default statistics policy: nothing is counted.
+     *
+     * The policy is empty and all its hooks are no-ops, so that the list keeps its plain footprint and its hot paths are unchanged.
+     */
+    struct NoStats final
+    {
+        /*!
+         * \brief Notify a node allocation (no-op).
+         */
+        void on_allocate() noexcept
+        {}
+        /*!
+         * \brief Notify a node deallocation (no-op).
+         */
+        void on_deallocate() noexcept
+        {}
+        /*!
+         * \brief Notify the deallocation of several nodes at once (no-op).
+         */
+        void on_deallocate(size_t) noexcept
+        {}
+        /*!
+         * \brief Notify a walk through the list (no-op).
+         */
+        void on_walk(size_t) noexcept
+        {}
+        /*!
+         * \brief Get the counters.
+         * \return Zeroed counters
+         */
+        ListStats get() const noexcept
+        {
+            return ListStats();
+        }
+        /*!
+         * \brief Reset the counters (no-op).
+         */
+        void reset() noexcept
+        {}
+    };
+
+    /*!
+     * \struct CountingStats
+     * \brief A statistics policy counting the node allocations and the links followed by the positional access.
+     *
+     * Meant to find the excess allocations and the linear positional accesses of a workload without attaching a profiler.
+     * \note The counters are plain integers: they are not synchronized, like the list itself.
+     */
+    struct CountingStats final
+    {
+        ListStats counters; /*!< The counters */
+
+        /*!
+         * \brief Notify a node allocation.
+         */
+        void on_allocate() noexcept
+        {
+            ++counters.allocations;
+        }
+        /*!
+         * \brief Notify a node deallocation.
+         */
+        void on_deallocate() noexcept
+        {
+            ++counters.deallocations;
+        }
+        /*!
+         * \brief Notify the deallocation of several nodes at once.
+         * \param[in] count The number of nodes
+         */
+        void on_deallocate(size_t count) noexcept
+        {
+            counters.deallocations += count;
+        }
+        /*!
+         * \brief Notify a walk through the list.
+         * \param[in] hops The number of links followed
+         */
+        void on_walk(size_t hops) noexcept
+        {
+            ++counters.walks;
+            counters.hops += hops;
+            if(hops > counters.longest_walk)
+                counters.longest_walk = hops;
+        }
+        /*!
+         * \brief Get the counters.
+         * \return The counters
+         */
+        ListStats get() const noexcept
+        {
+            return counters;
+        }
+        /*!
+         * \brief Reset the counters.
+         */
+        void reset() noexcept
+        {
+            counters = ListStats();
+        }
+    };
+}
+
+#endif // MANUAL_LISTSTATS_H
@@ -0,0 +1,378 @@
+#ifndef MANUAL_LISTVIEW_H
+#define MANUAL_LISTVIEW_H
+
+/*!
+ * \file listview.h
+ * \brief Flat binary dump of the lists, and a view iterating a dump in place (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace manual
+{
+    /*!
+     * \struct ListDumpHeader
+     * \brief The header of a list dump, followed by the values (contiguous, aligned as \p T).
+     *
+     * A dump is a raw copy of the values in the byte order and layout of the machine which wrote it.
+     */
+    struct ListDumpHeader final
+    {
+        std::uint32_t magic;       /*!< list_dump_magic */
+        std::uint16_t version;     /*!< list_dump_version */
+        std::uint16_t value_align; /*!< The alignment of the values */
+        std::uint64_t value_size;  /*!< The size of a value */
+        std::uint64_t count;       /*!< The number of values */
+        std::uint64_t offset;      /*!< The offset of the first value from the beginning of the dump */
+    };
+
+    constexpr std::uint32_t list_dump_magic = 0x54534c4d; /*!< The magic number of a list dump ("MLST" in little endian) */
+    constexpr std::uint16_t list_dump_version = 1;        /*!< The version of the dump format */
+
+    /*!
+     * \brief Get the offset of the values in a dump.
+     * \return The size of the header, rounded up to the alignment of \p T
+     */
+    template <typename T>
+    constexpr size_t list_dump_offset()
+    {
+        return (sizeof(ListDumpHeader) + alignof(T) - 1) / alignof(T) * alignof(T);
+    }
+
+    /*!
+     * \brief Get the size of the dump of a list.
+     * \param[in] list The list (LinkedList, DoublyLinkedList, UnrolledList...)
+     * \return The number of bytes written by write_to() and serialize()
+     */
+    template <typename List>
+    size_t serialized_size(const List & list)
+    {
+        return list_dump_offset<typename List::value_type>() + list.size() * sizeof(typename List::value_type);
+    }
+
+    /*!
+     * \brief Fill the header of the dump of a list.
+     * \param[in] count The number of values
+     * \return The header
+     */
+    template <typename T>
+    ListDumpHeader list_dump_header(size_t count)
+    {
+        ListDumpHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = list_dump_magic;
+        header.version = list_dump_version;
+        header.value_align = static_cast<std::uint16_t>(alignof(T));
+        header.value_size = sizeof(T);
+        header.count = count;
+        header.offset = list_dump_offset<T>();
+        return header;
+    }
+
+    /*!
+     * \brief Write the dump of a list into a buffer.
+     * \param[in] list The list (LinkedList, DoublyLinkedList, UnrolledList...) of trivially copyable values
+     * \param[out] buffer The buffer to write into (e.g. a memory-mapped file)
+     * \param[in] size The size of \p buffer
+     * \return The number of bytes written (serialized_size())
+     * \throw std::length_error if \p buffer is too small
+     *
+     * \note The dump can be iterated in place by a ListView if \p buffer is aligned as the values.
+     */
+    template <typename List>
+    size_t write_to(const List & list, void * buffer, size_t size)
+    {
+        typedef typename List::value_type T;
+        static_assert(std::is_trivially_copyable<T>::value, "manual::write_to - The values must be trivially copyable.");
+
+        size_t needed = serialized_size(list);
+        if(size < needed)
+            throw std::length_error(std::string("[Length error] - manual::write_to() - (buffer size: ") + std::to_string(size) + ", needed: " + std::to_string(needed) + ").");
+
+        unsigned char * out = static_cast<unsigned char*>(buffer);
+        ListDumpHeader header = list_dump_header<T>(list.size());
+        std::memset(out, 0, list_dump_offset<T>());
+        std::memcpy(out, &header, sizeof(header));
+        out += list_dump_offset<T>();
+        for(const T & val : list)
+        {
+            std::memcpy(out, &val, sizeof(T));
+            out += sizeof(T);
+        }
+        return needed;
+    }
+
+    /*!
+     * \brief Write the dump of a list to a stream.
+     * \param[in] list The list (LinkedList, DoublyLinkedList, UnrolledList...) of trivially copyable values
+     * \param[in,out] os The output stream (opened in binary mode)
+     *
+     * The values are copied into a small buffer and written by blocks, not one by one.
+     * \note Check the state of \p os for the errors.
+     */
+    template <typename List>
+    void serialize(const List & list, std::ostream & os)
+    {
+        typedef typename List::value_type T;
+        static_assert(std::is_trivially_copyable<T>::value, "manual::serialize - The values must be trivially copyable.");
+
+        unsigned char prefix[list_dump_offset<T>()] = {};
+        ListDumpHeader header = list_dump_header<T>(list.size());
+        std::memcpy(prefix, &header, sizeof(header));
+        if(!os.write(reinterpret_cast<const char*>(prefix), sizeof(prefix)))
+            return;
+
+        constexpr size_t block_count = (4096 + sizeof(T) - 1) / sizeof(T);
+        std::vector<unsigned char> block(block_count * sizeof(T));
+        size_t used = 0;
+        for(const T & val : list)
+        {
+            std::memcpy(block.data() + used, &val, sizeof(T));
+            used += sizeof(T);
+            if(used == block.size())
+            {
+                if(!os.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(used)))
+                    return;
+                used = 0;
+            }
+        }
+        os.write(reinterpret_cast<const char*>(block.data()), static_cast<std::streamsize>(used));
+    }
+
+    /*!
+     * \class ListView
+     * \brief A read-only view of a list dump (see write_to() and serialize()), iterated in place.
+     *
+     * The values are contiguous: the view is just a pointer and a size, nothing is allocated nor copied.
+     * A list is only built on demand by materialize().
+     * \warning The dump must outlive the view.
+     */
+    template <typename T>
+    class ListView
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "manual::ListView - The values must be trivially copyable.");
+
+        protected:
+            // data members
+            const T * data_; /*!< The first value */
+            size_t size_;    /*!< The number of values */
+
+        public:
+            // Standard container types
+            typedef T value_type;                   /*!< The type of the elements */
+            typedef size_t size_type;               /*!< The type of the size */
+            typedef std::ptrdiff_t difference_type; /*!< The type of the distance between two iterators */
+            typedef const T & reference;            /*!< The type of a reference to an element */
+            typedef const T & const_reference;      /*!< The type of a `const` reference to an element */
+            typedef const T * iterator;             /*!< The iterator type (read-only) */
+            typedef const T * const_iterator;       /*!< The `const` iterator type */
+
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty view.
+             */
+            ListView() noexcept : data_(nullptr), size_(0)
+            {}
+            /*!
+             * \brief Dump constructor.
+             * \param[in] dump The beginning of the dump (aligned as \p T, e.g. a memory-mapped file)
+             * \param[in] size The size of the dump in bytes
+             * \throw std::invalid_argument if the dump is truncated, misaligned or was not written for \p T
+             *
+             * Only the header is read: `O(1)`.
+             */
+            ListView(const void * dump, size_t size) : data_(nullptr), size_(0)
+            {
+                ListDumpHeader header;
+                if(size < sizeof(header))
+                    throw std::invalid_argument("[Invalid argument] - manual::ListView - The dump is truncated (no header).");
+                std::memcpy(&header, dump, sizeof(header));
+                if(header.magic != list_dump_magic || header.version != list_dump_version)
+                    throw std::invalid_argument("[Invalid argument] - manual::ListView - Not a list dump (or unsupported version).");
+                if(header.value_size != sizeof(T) || header.value_align != alignof(T) || header.offset != list_dump_offset<T>())
+                    throw std::invalid_argument(std::string("[Invalid argument] - manual::ListView - The dump was not written for this type (value size: ") + std::to_string(header.value_size) + ", expected: " + std::to_string(sizeof(T)) + ").");
+                if(reinterpret_cast<std::uintptr_t>(dump) % alignof(T))
+                    throw std::invalid_argument("[Invalid argument] - manual::ListView - The dump is misaligned.");
+                if(size < header.offset || header.count > (size - header.offset) / sizeof(T))
+                    throw std::invalid_argument(std::string("[Invalid argument] - manual::ListView - The dump is truncated (count: ") + std::to_string(header.count) + ", size: " + std::to_string(size) + ").");
+
+                data_ = reinterpret_cast<const T*>(static_cast<const unsigned char*>(dump) + header.offset);
+                size_ = static_cast<size_t>(header.count);
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the size of the view.
+             * \return The number of values
+             */
+            size_t size() const noexcept
+            {
+                return size_;
+            }
+            /*!
+             * \brief Check if the view is empty.
+             * \return `true` if the view is empty, `false` otherwise
+             */
+            bool empty() const noexcept
+            {
+                return size_ == 0;
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the values.
+             * \return A pointer to the first value
+             */
+            const T * data() const noexcept
+            {
+                return data_;
+            }
+            /*!
+             * \brief Get the first element.
+             * \return A `const` reference to the first value
+             *
+             * \warning Never call this function on an empty view (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return data_[0];
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A `const` reference to the last value
+             *
+             * \warning Never call this function on an empty view (Undefined Behaviour).
+             */
+            const T & back() const
+            {
+                return data_[size_-1];
+            }
+            /*!
+             * \brief Get the element at the given index, in constant time.
+             * \param[in] index The position of the element (lower than the size)
+             * \return A `const` reference to the value
+             *
+             * \warning Out-of-bound access is Undefined Behaviour, use at() for a checked access.
+             */
+            const T & operator[](size_t index) const
+            {
+                return data_[index];
+            }
+            /*!
+             * \brief Get the element at the given index, with a bound check.
+             * \param[in] index The position of the element
+             * \return A `const` reference to the value
+             * \throw std::out_of_range if \p index is out of range
+             */
+            const T & at(size_t index) const
+            {
+                if(index >= size_)
+                    throw std::out_of_range(std::string("[Out of range error] - manual::ListView::at() - (index: ") + std::to_string(index) + ", size: " + std::to_string(size_) + ").");
+                return data_[index];
+            }
+
+            // Iterator
+            /*!
+             * \brief Get an iterator referring to the first element.
+             * \return A pointer to the first value
+             */
+            const T * begin() const noexcept
+            {
+                return data_;
+            }
+            /*!
+             * \brief Get an iterator referring to the _past-the-end_ element.
+             * \return A pointer past the last value
+             */
+            const T * end() const noexcept
+            {
+                return data_ + size_;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A pointer to the first value
+             */
+            const T * cbegin() const noexcept
+            {
+                return begin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A pointer past the last value
+             */
+            const T * cend() const noexcept
+            {
+                return end();
+            }
+
+            // Operations
+            /*!
+             * \brief Build a list of the values.
+             * \param[in] alloc The allocator to get the nodes from (\p List needs a range constructor: LinkedList, DoublyLinkedList, CompactDoublyLinkedList)
+             * \return The list
+             *
+             * The list is built by its range constructor: its size is known, so that an allocator providing `reserve()` gives all the nodes
+             * from one block (e.g. `PoolDList<T>`, or the table of a CompactDoublyLinkedList).
+             */
+            template <typename List>
+            List materialize(const typename List::allocator_type & alloc = typename List::allocator_type()) const
+            {
+                return List(begin(), end(), alloc);
+            }
+    };
+
+    /*!
+     * \brief Read a list from the dump written by serialize().
+     * \param[in,out] is The input stream (opened in binary mode)
+     * \param[in] alloc The allocator to get the nodes from (\p List needs `emplace_back()`: LinkedList, DoublyLinkedList, CompactDoublyLinkedList, UnrolledList)
+     * \return The list
+     * \throw std::invalid_argument if the dump cannot be read, is truncated or was not written for the value type of \p List
+     *
+     * The values are read in blocks of at most `64 KiB` and appended as they come, so that the memory used follows the bytes actually read
+     * (the count of the header is not trusted to size anything).
+     * \note A memory-mapped dump is better iterated in place by a ListView, without reading nor allocating.
+     */
+    template <typename List>
+    List deserialize(std::istream & is, const typename List::allocator_type & alloc = typename List::allocator_type())
+    {
+        typedef typename List::value_type T;
+        static_assert(std::is_trivially_copyable<T>::value, "manual::deserialize - The values must be trivially copyable.");
+        ListDumpHeader header;
+        if(!is.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            throw std::invalid_argument("[Invalid argument] - manual::deserialize() - The dump is truncated (no header).");
+        if(header.magic != list_dump_magic || header.version != list_dump_version || header.value_size != sizeof(T) || header.value_align != alignof(T) || header.offset != list_dump_offset<T>())
+            throw std::invalid_argument("[Invalid argument] - manual::deserialize() - Not a list dump of this type.");
+        char padding[alignof(T)];
+        if(!is.read(padding, static_cast<std::streamsize>(header.offset - sizeof(header))))
+            throw std::invalid_argument("[Invalid argument] - manual::deserialize() - The dump is truncated (no values).");
+
+        // T-typed storage, so that the values are aligned
+        constexpr size_t block_size = (65536 / sizeof(T)) ? 65536 / sizeof(T) : 1;
+        std::vector<typename std::aligned_storage<sizeof(T), alignof(T)>::type> block(header.count < block_size ? static_cast<size_t>(header.count) : block_size);
+        const T * values = reinterpret_cast<const T*>(block.data());
+        List list(alloc);
+        for(std::uint64_t remaining = header.count; remaining;)
+        {
+            size_t count = remaining < block_size ? static_cast<size_t>(remaining) : block_size;
+            if(!is.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(count * sizeof(T))))
+                throw std::invalid_argument(std::string("[Invalid argument] - manual::deserialize() - The dump is truncated (count: ") + std::to_string(header.count) + ").");
+            for(size_t i = 0; i < count; ++i)
+                list.emplace_back(values[i]);
+            remaining -= count;
+        }
+        return list;
+    }
+}
+
+#endif // MANUAL_LISTVIEW_H
@@ -0,0 +1,1111 @@
+#ifndef MANUAL_LISTVIEWS_H
+#define MANUAL_LISTVIEWS_H
+
+/*!
+ * \file listviews.h
+ * \brief Lazy views over the lists (map, filter, take, zip) and a generator (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__has_include)
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+#include <coroutine>
+#define MANUAL_HAS_COROUTINES
+#endif
+#endif
+
+namespace manual
+{
+    /*!
+     * \namespace manual::views
+     * \brief Lazy views: the elements are computed while iterating, a pipeline of views creates no intermediate container.
+     *
+     * A view is built from a container (kept by reference, it must outlive the view; a temporary is moved into the view)
+     * or from another view (kept by value):
+     * `list | views::filter(pred) | views::map(f) | views::take(n)` iterates \p list once, and `append_range()`
+     * (or the range constructor) of a list materializes the result in the same pass: the iterators of the views
+     * are input iterators, so that no consumer walks the view first to size its result (calling the functions twice).
+     *
+     * \note The iterators of a view refer to it: a view must outlive its iterators (and not be moved while iterating).
+     */
+    namespace views
+    {
+        /*!
+         * \struct ViewBase
+         * \brief The base of the views (a view is kept by value in a pipeline, a container by reference).
+         */
+        struct ViewBase
+        {};
+
+        /*!
+         * \brief The iterator type of a range.
+         */
+        template <typename Range>
+        using iterator_t = decltype(std::declval<const Range &>().begin());
+
+        /*!
+         * \class RefView
+         * \brief A view of all the elements of a container (kept by reference).
+         */
+        template <typename Range>
+        class RefView final : public ViewBase
+        {
+            protected:
+                Range * range_; /*!< The container */
+
+            public:
+                /*!
+                 * \brief Container constructor.
+                 * \param[in] range The container to view (it must outlive the view)
+                 */
+                explicit RefView(Range & range) : range_(std::addressof(range))
+                {}
+
+                /*!
+                 * \brief Get an iterator referring to the first element.
+                 * \return An iterator of the container
+                 */
+                auto begin() const -> decltype(std::begin(std::declval<Range &>()))
+                {
+                    return std::begin(*range_);
+                }
+                /*!
+                 * \brief Get an iterator referring to the _past-the-end_ element.
+                 * \return An iterator of the container
+                 */
+                auto end() const -> decltype(std::end(std::declval<Range &>()))
+                {
+                    return std::end(*range_);
+                }
+        };
+
+        /*!
+         * \class OwningView
+         * \brief A view owning a container (or a Generator) moved into it.
+         *
+         * \note The view is move-only if the container is.
+         */
+        template <typename Range>
+        class OwningView final : public ViewBase
+        {
+            protected:
+                Range range_; /*!< The container */
+
+            public:
+                /*!
+                 * \brief Container constructor.
+                 * \param[in,out] range The container to own (moved)
+                 */
+                explicit OwningView(Range && range) : range_(std::move(range))
+                {}
+
+                /*!
+                 * \brief Get an iterator referring to the first element.
+                 * \return A `const` iterator of the container
+                 */
+                auto begin() const -> decltype(std::begin(std::declval<const Range &>()))
+                {
+                    return std::begin(range_);
+                }
+                /*!
+                 * \brief Get an iterator referring to the _past-the-end_ element.
+                 * \return A `const` iterator of the container
+                 */
+                auto end() const -> decltype(std::end(std::declval<const Range &>()))
+                {
+                    return std::end(range_);
+                }
+        };
+
+        /*!
+         * \brief Get the view of a container (by reference).
+         * \param[in] range The container (it must outlive the view)
+         * \return A RefView of \p range
+         */
+        template <typename Range, typename std::enable_if<!std::is_base_of<ViewBase, typename std::decay<Range>::type>::value, int>::type = 0>
+        RefView<Range> all(Range & range)
+        {
+            return RefView<Range>(range);
+        }
+        /*!
+         * \brief Get the view of a temporary container (moved into the view).
+         * \param[in,out] range The container (moved)
+         * \return An OwningView of \p range
+         */
+        template <typename Range, typename std::enable_if<!std::is_lvalue_reference<Range>::value && !std::is_base_of<ViewBase, typename std::decay<Range>::type>::value, int>::type = 0>
+        OwningView<typename std::decay<Range>::type> all(Range && range)
+        {
+            return OwningView<typename std::decay<Range>::type>(std::move(range));
+        }
+        /*!
+         * \brief Get a view (by value).
+         * \param[in] view The view
+         * \return A copy of \p view (moved if it is a temporary)
+         */
+        template <typename View, typename std::enable_if<std::is_base_of<ViewBase, typename std::decay<View>::type>::value, int>::type = 0>
+        typename std::decay<View>::type all(View && view)
+        {
+            return std::forward<View>(view);
+        }
+
+        /*!
+         * \brief The view type of a range (RefView of a container, OwningView of a temporary one, the view itself otherwise).
+         */
+        template <typename Range>
+        using all_t = decltype(all(std::declval<Range>()));
+
+        /*!
+         * \class MapView
+         * \brief A view of the results of a function applied to the elements of a range.
+         *
+         * \note The function is called at each dereference: its result is not cached.
+         */
+        template <typename Base, typename F>
+        class MapView final : public ViewBase
+        {
+            protected:
+                typedef iterator_t<Base> BaseIterator; /*!< The iterator of the underlying range */
+
+                // data members
+                Base base_; /*!< The underlying range */
+                F f_;       /*!< The function */
+
+            public:
+                /*!
+                 * \class Iterator
+                 * \brief An input iterator applying the function on the fly
+                 */
+                class Iterator final
+                {
+                    friend class MapView;
+
+                    private:
+                        BaseIterator current;
+                        const MapView * view;
+
+                    public:
+                        typedef std::input_iterator_tag iterator_category;                                                 /*!< The iterator category */
+                        typedef decltype(std::declval<const F &>()(*std::declval<BaseIterator &>())) reference;            /*!< The result of the function */
+                        typedef typename std::remove_cv<typename std::remove_reference<reference>::type>::type value_type; /*!< The type of the results */
+                        typedef std::ptrdiff_t difference_type;                                                            /*!< The type of the distance between two iterators */
+                        typedef void pointer;                                                                              /*!< No pointer to a result */
+
+                        /*!
+                         * \brief Default constructor.
+                         *
+                         * \warning Should not be dereferenced (Undefined Behaviour).
+                         */
+                        Iterator() : current(), view(nullptr)
+                        {}
+                        /*!
+                         * \brief Equality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if equality, `false` otherwise
+                         */
+                        friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return lhs.current == rhs.current;
+                        }
+                        /*!
+                         * \brief Inequality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if inequality, `false` otherwise
+                         */
+                        friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return !(lhs == rhs);
+                        }
+                        /*!
+                         * \brief Indirection (dereference) operator.
+                         * \return The result of the function applied to the pointed element
+                         */
+                        reference operator*() const
+                        {
+                            return view->f_(*current);
+                        }
+                        /*!
+                         * \brief Prefix increment operator.
+                         * \return A reference to the incremented `*this`
+                         */
+                        Iterator & operator++() //prefix
+                        {
+                            ++current;
+                            return *this;
+                        }
+                        /*!
+                         * \brief Postfix increment operator.
+                         * \return The before-increment Iterator
+                         */
+                        Iterator operator++(int) //postfix
+                        {
+                            Iterator tmp(*this);
+                            ++(*this);
+                            return tmp;
+                        }
+                };
+
+                typedef Iterator iterator;       /*!< The iterator type */
+                typedef Iterator const_iterator; /*!< The `const` iterator type */
+
+                /*!
+                 * \brief Range constructor.
+                 * \param[in] base The underlying range
+                 * \param[in] f The function
+                 */
+                MapView(Base base, F f) : base_(std::move(base)), f_(std::move(f))
+                {}
+
+                /*!
+                 * \brief Get an iterator referring to the first result.
+                 * \return An iterator
+                 */
+                Iterator begin() const
+                {
+                    Iterator it;
+                    it.current = base_.begin();
+                    it.view = this;
+                    return it;
+                }
+                /*!
+                 * \brief Get an iterator referring to the _past-the-end_ result.
+                 * \return An iterator
+                 */
+                Iterator end() const
+                {
+                    Iterator it;
+                    it.current = base_.end();
+                    it.view = this;
+                    return it;
+                }
+        };
+
+        /*!
+         * \class FilterView
+         * \brief A view of the elements of a range satisfying a predicate.
+         *
+         * \note begin() looks for the first element satisfying the predicate (it is not cached).
+         */
+        template <typename Base, typename Pred>
+        class FilterView final : public ViewBase
+        {
+            protected:
+                typedef iterator_t<Base> BaseIterator; /*!< The iterator of the underlying range */
+
+                // data members
+                Base base_; /*!< The underlying range */
+                Pred pred_; /*!< The predicate */
+
+            public:
+                /*!
+                 * \class Iterator
+                 * \brief An input iterator skipping the elements not satisfying the predicate
+                 */
+                class Iterator final
+                {
+                    friend class FilterView;
+
+                    private:
+                        BaseIterator current;
+                        BaseIterator last;
+                        const FilterView * view;
+
+                        /*!
+                         * \brief Skip the elements not satisfying the predicate.
+                         */
+                        void satisfy()
+                        {
+                            while(current != last && !view->pred_(*current))
+                                ++current;
+                        }
+
+                    public:
+                        typedef std::input_iterator_tag iterator_category;                                  /*!< The iterator category (single pass) */
+                        typedef typename std::iterator_traits<BaseIterator>::value_type value_type;         /*!< The type of the pointed values */
+                        typedef typename std::iterator_traits<BaseIterator>::difference_type difference_type; /*!< The type of the distance between two iterators */
+                        typedef typename std::iterator_traits<BaseIterator>::pointer pointer;               /*!< The pointer to a pointed value */
+                        typedef typename std::iterator_traits<BaseIterator>::reference reference;           /*!< The reference to a pointed value */
+
+                        /*!
+                         * \brief Default constructor.
+                         *
+                         * \warning Should not be dereferenced (Undefined Behaviour).
+                         */
+                        Iterator() : current(), last(), view(nullptr)
+                        {}
+                        /*!
+                         * \brief Equality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if equality, `false` otherwise
+                         */
+                        friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return lhs.current == rhs.current;
+                        }
+                        /*!
+                         * \brief Inequality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if inequality, `false` otherwise
+                         */
+                        friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return !(lhs == rhs);
+                        }
+                        /*!
+                         * \brief Indirection (dereference) operator.
+                         * \return The pointed element
+                         */
+                        reference operator*() const
+                        {
+                            return *current;
+                        }
+                        /*!
+                         * \brief Member of pointer (dereference) operator.
+                         * \return The address of the pointed element
+                         */
+                        pointer operator->() const
+                        {
+                            return std::addressof(*current);
+                        }
+                        /*!
+                         * \brief Prefix increment operator.
+                         * \return A reference to the incremented `*this`
+                         *
+                         * Shift to the next element satisfying the predicate.
+                         */
+                        Iterator & operator++() //prefix
+                        {
+                            ++current;
+                            satisfy();
+                            return *this;
+                        }
+                        /*!
+                         * \brief Postfix increment operator.
+                         * \return The before-increment Iterator
+                         */
+                        Iterator operator++(int) //postfix
+                        {
+                            Iterator tmp(*this);
+                            ++(*this);
+                            return tmp;
+                        }
+                };
+
+                typedef Iterator iterator;       /*!< The iterator type */
+                typedef Iterator const_iterator; /*!< The `const` iterator type */
+
+                /*!
+                 * \brief Range constructor.
+                 * \param[in] base The underlying range
+                 * \param[in] pred The predicate
+                 */
+                FilterView(Base base, Pred pred) : base_(std::move(base)), pred_(std::move(pred))
+                {}
+
+                /*!
+                 * \brief Get an iterator referring to the first element satisfying the predicate.
+                 * \return An iterator
+                 *
+                 * \note Linear time (up to the first element satisfying the predicate).
+                 */
+                Iterator begin() const
+                {
+                    Iterator it;
+                    it.current = base_.begin();
+                    it.last = base_.end();
+                    it.view = this;
+                    it.satisfy();
+                    return it;
+                }
+                /*!
+                 * \brief Get an iterator referring to the _past-the-end_ element.
+                 * \return An iterator
+                 */
+                Iterator end() const
+                {
+                    Iterator it;
+                    it.current = base_.end();
+                    it.last = it.current;
+                    it.view = this;
+                    return it;
+                }
+        };
+
+        /*!
+         * \class TakeView
+         * \brief A view of the first elements of a range.
+         *
+         * \note The underlying range is not iterated past the last taken element: a take of an endless range (e.g. a Generator) ends.
+         */
+        template <typename Base>
+        class TakeView final : public ViewBase
+        {
+            protected:
+                typedef iterator_t<Base> BaseIterator; /*!< The iterator of the underlying range */
+
+                // data members
+                Base base_;   /*!< The underlying range */
+                size_t count_; /*!< The maximal number of elements */
+
+            public:
+                /*!
+                 * \class Iterator
+                 * \brief An input iterator counting down the elements left to take
+                 */
+                class Iterator final
+                {
+                    friend class TakeView;
+
+                    private:
+                        BaseIterator current;
+                        size_t remaining;
+
+                    public:
+                        typedef std::input_iterator_tag iterator_category;                                  /*!< The iterator category (single pass) */
+                        typedef typename std::iterator_traits<BaseIterator>::value_type value_type;         /*!< The type of the pointed values */
+                        typedef typename std::iterator_traits<BaseIterator>::difference_type difference_type; /*!< The type of the distance between two iterators */
+                        typedef typename std::iterator_traits<BaseIterator>::pointer pointer;               /*!< The pointer to a pointed value */
+                        typedef typename std::iterator_traits<BaseIterator>::reference reference;           /*!< The reference to a pointed value */
+
+                        /*!
+                         * \brief Default constructor.
+                         *
+                         * \warning Should not be dereferenced (Undefined Behaviour).
+                         */
+                        Iterator() : current(), remaining(0)
+                        {}
+                        /*!
+                         * \brief Equality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if equality, `false` otherwise
+                         *
+                         * \note The end is reached with the end of the underlying range or when no element is left to take.
+                         */
+                        friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return lhs.remaining == rhs.remaining || lhs.current == rhs.current;
+                        }
+                        /*!
+                         * \brief Inequality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if inequality, `false` otherwise
+                         */
+                        friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return !(lhs == rhs);
+                        }
+                        /*!
+                         * \brief Indirection (dereference) operator.
+                         * \return The pointed element
+                         */
+                        reference operator*() const
+                        {
+                            return *current;
+                        }
+                        /*!
+                         * \brief Member of pointer (dereference) operator.
+                         * \return The address of the pointed element
+                         */
+                        pointer operator->() const
+                        {
+                            return std::addressof(*current);
+                        }
+                        /*!
+                         * \brief Prefix increment operator.
+                         * \return A reference to the incremented `*this`
+                         *
+                         * \note The underlying iterator is not incremented past the last taken element.
+                         */
+                        Iterator & operator++() //prefix
+                        {
+                            if(--remaining)
+                                ++current;
+                            return *this;
+                        }
+                        /*!
+                         * \brief Postfix increment operator.
+                         * \return The before-increment Iterator
+                         */
+                        Iterator operator++(int) //postfix
+                        {
+                            Iterator tmp(*this);
+                            ++(*this);
+                            return tmp;
+                        }
+                };
+
+                typedef Iterator iterator;       /*!< The iterator type */
+                typedef Iterator const_iterator; /*!< The `const` iterator type */
+
+                /*!
+                 * \brief Range constructor.
+                 * \param[in] base The underlying range
+                 * \param[in] count The maximal number of elements
+                 */
+                TakeView(Base base, size_t count) : base_(std::move(base)), count_(count)
+                {}
+
+                /*!
+                 * \brief Get an iterator referring to the first element.
+                 * \return An iterator
+                 */
+                Iterator begin() const
+                {
+                    Iterator it;
+                    it.current = base_.begin();
+                    it.remaining = count_;
+                    return it;
+                }
+                /*!
+                 * \brief Get an iterator referring to the _past-the-end_ element.
+                 * \return An iterator
+                 */
+                Iterator end() const
+                {
+                    Iterator it;
+                    it.current = base_.end();
+                    it.remaining = 0;
+                    return it;
+                }
+        };
+
+        /*!
+         * \class ZipView
+         * \brief A view of the pairs of the elements of two ranges, at the same positions.
+         *
+         * \note The view ends with the shortest range.
+         */
+        template <typename Base1, typename Base2>
+        class ZipView final : public ViewBase
+        {
+            protected:
+                typedef iterator_t<Base1> BaseIterator1; /*!< The iterator of the first range */
+                typedef iterator_t<Base2> BaseIterator2; /*!< The iterator of the second range */
+
+                // data members
+                Base1 first_;  /*!< The first range */
+                Base2 second_; /*!< The second range */
+
+            public:
+                /*!
+                 * \class Iterator
+                 * \brief An input iterator on the two ranges at once
+                 */
+                class Iterator final
+                {
+                    friend class ZipView;
+
+                    private:
+                        BaseIterator1 first;
+                        BaseIterator2 second;
+
+                    public:
+                        typedef std::input_iterator_tag iterator_category;                                                                          /*!< The iterator category */
+                        typedef std::pair<typename std::iterator_traits<BaseIterator1>::value_type, typename std::iterator_traits<BaseIterator2>::value_type> value_type; /*!< The type of the pairs of values */
+                        typedef std::pair<typename std::iterator_traits<BaseIterator1>::reference, typename std::iterator_traits<BaseIterator2>::reference> reference;    /*!< The pair of the references to the elements */
+                        typedef std::ptrdiff_t difference_type;                                                                                     /*!< The type of the distance between two iterators */
+                        typedef void pointer;                                                                                                       /*!< No pointer to a pair */
+
+                        /*!
+                         * \brief Default constructor.
+                         *
+                         * \warning Should not be dereferenced (Undefined Behaviour).
+                         */
+                        Iterator() : first(), second()
+                        {}
+                        /*!
+                         * \brief Equality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if equality, `false` otherwise
+                         *
+                         * \note The end is reached with the end of either range.
+                         */
+                        friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return lhs.first == rhs.first || lhs.second == rhs.second;
+                        }
+                        /*!
+                         * \brief Inequality operator.
+                         * \param[in] lhs The left-hand side
+                         * \param[in] rhs The right-hand side
+                         * \return `true` if inequality, `false` otherwise
+                         */
+                        friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                        {
+                            return !(lhs == rhs);
+                        }
+                        /*!
+                         * \brief Indirection (dereference) operator.
+                         * \return The pair of the references to the pointed elements
+                         */
+                        reference operator*() const
+                        {
+                            return reference(*first, *second);
+                        }
+                        /*!
+                         * \brief Prefix increment operator.
+                         * \return A reference to the incremented `*this`
+                         */
+                        Iterator & operator++() //prefix
+                        {
+                            ++first;
+                            ++second;
+                            return *this;
+                        }
+                        /*!
+                         * \brief Postfix increment operator.
+                         * \return The before-increment Iterator
+                         */
+                        Iterator operator++(int) //postfix
+                        {
+                            Iterator tmp(*this);
+                            ++(*this);
+                            return tmp;
+                        }
+                };
+
+                typedef Iterator iterator;       /*!< The iterator type */
+                typedef Iterator const_iterator; /*!< The `const` iterator type */
+
+                /*!
+                 * \brief Ranges constructor.
+                 * \param[in] first The first range
+                 * \param[in] second The second range
+                 */
+                ZipView(Base1 first, Base2 second) : first_(std::move(first)), second_(std::move(second))
+                {}
+
+                /*!
+                 * \brief Get an iterator referring to the first pair.
+                 * \return An iterator
+                 */
+                Iterator begin() const
+                {
+                    Iterator it;
+                    it.first = first_.begin();
+                    it.second = second_.begin();
+                    return it;
+                }
+                /*!
+                 * \brief Get an iterator referring to the _past-the-end_ pair.
+                 * \return An iterator
+                 */
+                Iterator end() const
+                {
+                    Iterator it;
+                    it.first = first_.end();
+                    it.second = second_.end();
+                    return it;
+                }
+        };
+
+        /*!
+         * \struct MapAdaptor
+         * \brief The right-hand side of `range | views::map(f)`.
+         */
+        template <typename F>
+        struct MapAdaptor final
+        {
+            F f; /*!< The function */
+        };
+        /*!
+         * \struct FilterAdaptor
+         * \brief The right-hand side of `range | views::filter(pred)`.
+         */
+        template <typename Pred>
+        struct FilterAdaptor final
+        {
+            Pred pred; /*!< The predicate */
+        };
+        /*!
+         * \struct TakeAdaptor
+         * \brief The right-hand side of `range | views::take(count)`.
+         */
+        struct TakeAdaptor final
+        {
+            size_t count; /*!< The maximal number of elements */
+        };
+
+        /*!
+         * \brief Map a range.
+         * \param[in] range The range (a container is kept by reference, a temporary or a view by value)
+         * \param[in] f The function to apply to the elements
+         * \return A MapView
+         */
+        template <typename Range, typename F>
+        MapView<all_t<Range>, typename std::decay<F>::type> map(Range && range, F && f)
+        {
+            return MapView<all_t<Range>, typename std::decay<F>::type>(all(std::forward<Range>(range)), std::forward<F>(f));
+        }
+        /*!
+         * \brief Get the adaptor mapping a range.
+         * \param[in] f The function to apply to the elements
+         * \return The adaptor (to use as `range | views::map(f)`)
+         */
+        template <typename F>
+        MapAdaptor<typename std::decay<F>::type> map(F && f)
+        {
+            return MapAdaptor<typename std::decay<F>::type>{std::forward<F>(f)};
+        }
+        /*!
+         * \brief Filter a range.
+         * \param[in] range The range (a container is kept by reference, a temporary or a view by value)
+         * \param[in] pred The predicate the elements have to satisfy
+         * \return A FilterView
+         */
+        template <typename Range, typename Pred>
+        FilterView<all_t<Range>, typename std::decay<Pred>::type> filter(Range && range, Pred && pred)
+        {
+            return FilterView<all_t<Range>, typename std::decay<Pred>::type>(all(std::forward<Range>(range)), std::forward<Pred>(pred));
+        }
+        /*!
+         * \brief Get the adaptor filtering a range.
+         * \param[in] pred The predicate the elements have to satisfy
+         * \return The adaptor (to use as `range | views::filter(pred)`)
+         */
+        template <typename Pred>
+        FilterAdaptor<typename std::decay<Pred>::type> filter(Pred && pred)
+        {
+            return FilterAdaptor<typename std::decay<Pred>::type>{std::forward<Pred>(pred)};
+        }
+        /*!
+         * \brief Take the first elements of a range.
+         * \param[in] range The range (a container is kept by reference, a temporary or a view by value)
+         * \param[in] count The maximal number of elements
+         * \return A TakeView
+         */
+        template <typename Range>
+        TakeView<all_t<Range>> take(Range && range, size_t count)
+        {
+            return TakeView<all_t<Range>>(all(std::forward<Range>(range)), count);
+        }
+        /*!
+         * \brief Get the adaptor taking the first elements of a range.
+         * \param[in] count The maximal number of elements
+         * \return The adaptor (to use as `range | views::take(count)`)
+         */
+        inline TakeAdaptor take(size_t count)
+        {
+            return TakeAdaptor{count};
+        }
+        /*!
+         * \brief Zip two ranges.
+         * \param[in] first The first range (a container is kept by reference, a temporary or a view by value)
+         * \param[in] second The second range (a container is kept by reference, a temporary or a view by value)
+         * \return A ZipView
+         */
+        template <typename Range1, typename Range2>
+        ZipView<all_t<Range1>, all_t<Range2>> zip(Range1 && first, Range2 && second)
+        {
+            return ZipView<all_t<Range1>, all_t<Range2>>(all(std::forward<Range1>(first)), all(std::forward<Range2>(second)));
+        }
+
+        /*!
+         * \brief Pipe operator.
+         * \param[in] range The range (a container is kept by reference, a temporary or a view by value)
+         * \param[in] adaptor The adaptor
+         * \return A MapView
+         */
+        template <typename Range, typename F>
+        MapView<all_t<Range>, F> operator|(Range && range, MapAdaptor<F> adaptor)
+        {
+            return MapView<all_t<Range>, F>(all(std::forward<Range>(range)), std::move(adaptor.f));
+        }
+        /*!
+         * \brief Pipe operator.
+         * \param[in] range The range (a container is kept by reference, a temporary or a view by value)
+         * \param[in] adaptor The adaptor
+         * \return A FilterView
+         */
+        template <typename Range, typename Pred>
+        FilterView<all_t<Range>, Pred> operator|(Range && range, FilterAdaptor<Pred> adaptor)
+        {
+            return FilterView<all_t<Range>, Pred>(all(std::forward<Range>(range)), std::move(adaptor.pred));
+        }
+        /*!
+         * \brief Pipe operator.
+         * \param[in] range The range (a container is kept by reference, a temporary or a view by value)
+         * \param[in] adaptor The adaptor
+         * \return A TakeView
+         */
+        template <typename Range>
+        TakeView<all_t<Range>> operator|(Range && range, TakeAdaptor adaptor)
+        {
+            return TakeView<all_t<Range>>(all(std::forward<Range>(range)), adaptor.count);
+        }
+    }
+
+#ifdef MANUAL_HAS_COROUTINES
+    /*!
+     * \class Generator
+     * \brief A coroutine producing values on demand (`co_yield`), iterable once as an input range.
+     * \tparam T The type of the values
+     *
+     * The coroutine runs until its next `co_yield` each time the iterator is incremented: a list filled from a Generator
+     * (`list.append_range(gen)`, or through views) gets the values one by one, without an intermediate container.
+     *
+     * \note An exception thrown by the coroutine is rethrown by the iterator (begin() or the increment).
+     * \warning The yielded value lives until the coroutine is resumed: copy it to keep it.
+     */
+    template <typename T>
+    class Generator final
+    {
+        public:
+            /*!
+             * \struct promise_type
+             * \brief The promise of the coroutine.
+             */
+            struct promise_type final
+            {
+                const T * value = nullptr;          /*!< The last yielded value */
+                std::exception_ptr exception;       /*!< The exception thrown by the coroutine */
+
+                /*!
+                 * \brief Create the Generator of the coroutine.
+                 * \return The Generator
+                 */
+                Generator get_return_object() noexcept
+                {
+                    return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+                /*!
+                 * \brief The coroutine waits for begin().
+                 * \return An awaitable suspending the coroutine
+                 */
+                std::suspend_always initial_suspend() const noexcept
+                {
+                    return {};
+                }
+                /*!
+                 * \brief The coroutine stays suspended at its end (the Generator destroys it).
+                 * \return An awaitable suspending the coroutine
+                 */
+                std::suspend_always final_suspend() const noexcept
+                {
+                    return {};
+                }
+                /*!
+                 * \brief Yield a value.
+                 * \param[in] val The value (it lives until the coroutine is resumed)
+                 * \return An awaitable suspending the coroutine
+                 */
+                std::suspend_always yield_value(const T & val) noexcept
+                {
+                    value = std::addressof(val);
+                    return {};
+                }
+                /*!
+                 * \brief End of the coroutine.
+                 */
+                void return_void() const noexcept
+                {}
+                /*!
+                 * \brief Keep the exception thrown by the coroutine (rethrown by the iterator).
+                 */
+                void unhandled_exception() noexcept
+                {
+                    exception = std::current_exception();
+                }
+                /*!
+                 * \brief A Generator only yields (no `co_await`).
+                 */
+                template <typename U>
+                std::suspend_never await_transform(U &&) = delete;
+            };
+
+            /*!
+             * \class Iterator
+             * \brief An input iterator resuming the coroutine
+             */
+            class Iterator final
+            {
+                friend class Generator;
+
+                private:
+                    std::coroutine_handle<promise_type> handle;
+
+                    /*!
+                     * \brief Resume the coroutine until its next value (or its end).
+                     * \throw The exception thrown by the coroutine
+                     */
+                    void resume()
+                    {
+                        handle.resume();
+                        if(handle.done())
+                        {
+                            std::exception_ptr exception = std::exchange(handle.promise().exception, nullptr);
+                            handle = nullptr;
+                            if(exception)
+                                std::rethrow_exception(exception);
+                        }
+                    }
+
+                public:
+                    typedef std::input_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                              /*!< The type of the values */
+                    typedef std::ptrdiff_t difference_type;            /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                         /*!< The pointer to a value */
+                    typedef const T & reference;                       /*!< The reference to a value */
+
+                    /*!
+                     * \brief Default constructor (the end of the values).
+                     */
+                    Iterator() : handle(nullptr)
+                    {}
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return lhs.handle == rhs.handle;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the current value
+                     */
+                    const T & operator*() const
+                    {
+                        return *handle.promise().value;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the current value
+                     */
+                    const T * operator->() const
+                    {
+                        return handle.promise().value;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Resume the coroutine until its next value.
+                     */
+                    Iterator & operator++() //prefix
+                    {
+                        resume();
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     *
+                     * \note The previous value is gone once the coroutine is resumed: nothing is returned.
+                     */
+                    void operator++(int) //postfix
+                    {
+                        ++(*this);
+                    }
+            };
+
+            typedef T value_type;            /*!< The type of the values */
+            typedef Iterator iterator;       /*!< The iterator type */
+            typedef Iterator const_iterator; /*!< The `const` iterator type */
+
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The Generator to move (left without coroutine)
+             */
+            Generator(Generator && other) noexcept : handle_(std::exchange(other.handle_, nullptr))
+            {}
+            /*!
+             * \brief Move assignment operator.
+             * \param[in,out] other The Generator to move (left without coroutine)
+             * \return A reference to `*this`
+             */
+            Generator & operator=(Generator && other) noexcept
+            {
+                if(this != &other)
+                {
+                    if(handle_)
+                        handle_.destroy();
+                    handle_ = std::exchange(other.handle_, nullptr);
+                }
+                return *this;
+            }
+            /*!
+             * \brief Destructor.
+             *
+             * \note The coroutine is destroyed, even if it did not reach its end.
+             */
+            ~Generator()
+            {
+                if(handle_)
+                    handle_.destroy();
+            }
+
+            /*!
+             * \brief Start the coroutine.
+             * \return An iterator referring to the first value
+             * \throw The exception thrown by the coroutine
+             *
+             * \warning A Generator is iterated once: call begin() only once.
+             */
+            Iterator begin() const
+            {
+                Iterator it;
+                if(handle_ && !handle_.done())
+                {
+                    it.handle = handle_;
+                    it.resume();
+                }
+                return it;
+            }
+            /*!
+             * \brief Get an iterator referring to the end of the values.
+             * \return An iterator
+             */
+            Iterator end() const noexcept
+            {
+                return Iterator();
+            }
+
+        protected:
+            std::coroutine_handle<promise_type> handle_; /*!< The coroutine */
+
+            /*!
+             * \brief Coroutine constructor.
+             * \param[in] handle The coroutine
+             */
+            explicit Generator(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle)
+            {}
+    };
+#endif
+
+#ifdef __cpp_lib_ranges
+    // The views model the standard range concepts (C++20)
+    static_assert(std::ranges::input_range<views::MapView<views::RefView<const int[4]>, int(*)(int)>>, "manual::views::MapView - Not an input_range.");
+    static_assert(std::ranges::input_range<views::FilterView<views::RefView<const int[4]>, bool(*)(int)>>, "manual::views::FilterView - Not an input_range.");
+    static_assert(std::ranges::input_range<views::TakeView<views::RefView<const int[4]>>>, "manual::views::TakeView - Not an input_range.");
+#ifdef MANUAL_HAS_COROUTINES
+    static_assert(std::ranges::input_range<Generator<int>>, "manual::Generator - Not an input_range.");
+#endif
+#endif
+}
+
+#endif // MANUAL_LISTVIEWS_H
@@ -7,8 +7,28 @@
  * \author Raphaël Lefèvre
  */
 
+#include "compactdoublylinkedlist.h"
+#include "concurrentlinkedqueue.h"
+#include "cowlist.h"
 #include "linkedlist.h"
 #include "doublylinkedlist.h"
+#include "intrusivelist.h"
+#include "intrusivedlist.h"
+#include "linkedhashmap.h"
+#include "linkedqueue.h"
+#include "linkedstack.h"
+#include "parallel.h"
+#include "persistentlist.h"
+#include "listhardening.h"
+#include "listindex.h"
+#include "listscan.h"
+#include "liststats.h"
+#include "listview.h"
+#include "listviews.h"
+#include "poolallocator.h"
+#include "shardedlist.h"
+#include "smalllist.h"
+#include "unrolledlist.h"
 
 /*!
  * \namespace manual
@@ -17,8 +37,31 @@
 namespace manual
 {
     // Convenience typedefs
-    template <typename T> using List = LinkedList<T>;        /*!< Convenience `typedef` of LinkedList */
-    template <typename T> using DList = DoublyLinkedList<T>; /*!< Convenience `typedef` of DoublyLinkedList */
+    template <typename T, typename Allocator = std::allocator<T>> using List = LinkedList<T, Allocator>;        /*!< Convenience `typedef` of LinkedList */
+    template <typename T, typename Allocator = std::allocator<T>> using DList = DoublyLinkedList<T, Allocator>; /*!< Convenience `typedef` of DoublyLinkedList */
+    template <typename T, typename Allocator = std::allocator<T>> using Stack = LinkedStack<T, Allocator>;      /*!< Convenience `typedef` of LinkedStack */
+    template <typename T, typename Allocator = std::allocator<T>> using Queue = LinkedQueue<T, Allocator>;      /*!< Convenience `typedef` of LinkedQueue */
+    template <typename T> using PoolList = LinkedList<T, PoolAllocator<T>>;                                     /*!< Convenience `typedef` of LinkedList using a PoolAllocator */
+    template <typename T> using PoolDList = DoublyLinkedList<T, PoolAllocator<T>>;                              /*!< Convenience `typedef` of DoublyLinkedList using a PoolAllocator */
+    template <typename T, typename Allocator = std::allocator<T>> using IndexedList = LinkedList<T, Allocator, CheckpointIndex>;        /*!< Convenience `typedef` of LinkedList with an index for the positional access */
+    template <typename T, typename Allocator = std::allocator<T>> using IndexedDList = DoublyLinkedList<T, Allocator, CheckpointIndex>; /*!< Convenience `typedef` of DoublyLinkedList with an index for the positional access */
+    template <typename T, typename Allocator = std::allocator<T>> using CountedList = LinkedList<T, Allocator, NoIndex, CountingStats>;        /*!< Convenience `typedef` of LinkedList counting its allocations and walks */
+    template <typename T, typename Allocator = std::allocator<T>> using CountedDList = DoublyLinkedList<T, Allocator, NoIndex, CountingStats>; /*!< Convenience `typedef` of DoublyLinkedList counting its allocations and walks */
+    template <typename T, size_t N = 8> using SmallList = SmallLinkedList<T, N>;                                 /*!< Convenience `typedef` of SmallLinkedList */
+    template <typename T, size_t N = 8> using SmallDList = SmallDoublyLinkedList<T, N>;                          /*!< Convenience `typedef` of SmallDoublyLinkedList */
+    template <typename T, size_t N = unrolled_chunk_size<T>(), typename Allocator = std::allocator<T>> using UList = UnrolledList<T, N, Allocator>; /*!< Convenience `typedef` of UnrolledList */
+    template <typename T, typename Allocator = std::allocator<T>> using CompactDList = CompactDoublyLinkedList<T, Allocator>; /*!< Convenience `typedef` of CompactDoublyLinkedList */
+    template <typename T, typename Allocator = std::allocator<T>> using CowDList = CopyOnWriteList<T, Allocator>;            /*!< Convenience `typedef` of CopyOnWriteList */
+
+#ifdef MANUAL_HAS_PMR
+    namespace pmr
+    {
+        template <typename T> using List = LinkedList<T>;        /*!< Convenience `typedef` of pmr::LinkedList */
+        template <typename T> using DList = DoublyLinkedList<T>; /*!< Convenience `typedef` of pmr::DoublyLinkedList */
+        template <typename T, size_t N = unrolled_chunk_size<T>()> using UList = UnrolledList<T, N>; /*!< Convenience `typedef` of pmr::UnrolledList */
+        template <typename T> using CompactDList = CompactDoublyLinkedList<T>; /*!< Convenience `typedef` of pmr::CompactDoublyLinkedList */
+    }
+#endif
 }
 
 /*!
@@ -31,6 +74,9 @@ namespace manual
  *
  * - To include the whole library, it is possible to include the all-in-one header manual.h.<br/>
  * Moreover it provides some convenience `typedef`.
+ *
+ * - Defining `MANUAL_HARDENED` before including the library enables constant time checks in manual::LinkedList and manual::DoublyLinkedList
+ * (bounds, empty containers, invalidated iterators and consistency of the ends after the modifications), see listhardening.h.
  */
 
 #endif // MANUAL_H
@@ -0,0 +1,168 @@
+#ifndef MANUAL_PARALLEL_H
+#define MANUAL_PARALLEL_H
+
+/*!
+ * \file parallel.h
+ * \brief Parallel traversal of the lists, segment by segment (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace manual
+{
+    /*!
+     * \brief The minimal number of elements handled by a thread of parallel_for_each() and parallel_reduce().
+     */
+    constexpr size_t parallel_grain_size = 4096;
+
+    /*!
+     * \brief Get the number of segments to split a traversal into.
+     * \param[in] size The number of elements
+     * \param[in] threads The requested number of threads (`0` for one per hardware thread)
+     * \return The number of segments (at least `1`)
+     */
+    inline size_t parallel_segment_count(size_t size, size_t threads)
+    {
+        if(!threads)
+            threads = std::thread::hardware_concurrency();
+        size_t max_segments = size / parallel_grain_size;
+        if(threads > max_segments)
+            threads = max_segments;
+        return threads ? threads : 1;
+    }
+
+    /*!
+     * \brief Run a task on consecutive segments of a range, one thread per segment.
+     * \param[in] first The first element of the range
+     * \param[in] size The number of elements of the range
+     * \param[in] segments The number of segments (at least `1`)
+     * \param[in,out] task The function object called as `task(index, first, count)` for each segment
+     *
+     * The split points are found in a single pass with `operator+=` (which skips whole chunks of an UnrolledList),
+     * each segment being started as soon as its end is known; the last segment runs on the calling thread.
+     * \note The first exception thrown by a task is rethrown once all the threads have joined.
+     * If the split itself throws (other than `std::system_error` from a thread creation), the started threads are joined before the exception propagates.
+     */
+    template <typename Iterator, typename Task>
+    void parallel_segments(Iterator first, size_t size, size_t segments, Task & task)
+    {
+        struct JoinGuard // joins the started threads even if the split throws (e.g. `std::bad_alloc` from `std::thread`)
+        {
+            std::vector<std::thread> threads;
+            ~JoinGuard()
+            {
+                for(std::thread & thread : threads)
+                {
+                    if(thread.joinable())
+                        thread.join();
+                }
+            }
+        };
+        std::vector<std::exception_ptr> errors(segments);
+        JoinGuard guard;
+        std::vector<std::thread> & threads = guard.threads;
+        threads.reserve(segments - 1);
+        auto run = [&task, &errors](size_t index, Iterator it, size_t count)
+        {
+            try
+            {
+                task(index, it, count);
+            }
+            catch(...)
+            {
+                errors[index] = std::current_exception();
+            }
+        };
+
+        size_t step = size / segments;
+        for(size_t i = 0; i + 1 < segments; ++i)
+        {
+            Iterator last = first;
+            last += step;
+            try
+            {
+                threads.emplace_back(run, i, first, step);
+            }
+            catch(const std::system_error &) // no more threads: run the segment here
+            {
+                run(i, first, step);
+            }
+            first = last;
+            size -= step;
+        }
+        run(segments - 1, first, size);
+
+        for(std::thread & thread : threads)
+            thread.join();
+        for(const std::exception_ptr & error : errors)
+        {
+            if(error)
+                std::rethrow_exception(error);
+        }
+    }
+
+    /*!
+     * \brief Apply a function to every element of a list, in parallel.
+     * \param[in,out] list The list (LinkedList, DoublyLinkedList, UnrolledList...)
+     * \param[in] f The function object called with a reference to each element (must be safe to call concurrently)
+     * \param[in] threads The maximal number of threads (`0` for one per hardware thread)
+     *
+     * The list is split into roughly equal segments of consecutive elements, traversed by different threads.
+     * \note Small lists (less than parallel_grain_size elements per thread) use fewer threads, down to the calling thread only.
+     * \warning The list must not be modified during the call.
+     */
+    template <typename List, typename Function>
+    void parallel_for_each(List & list, Function f, size_t threads = 0)
+    {
+        auto task = [&f](size_t, typename List::iterator it, size_t count)
+        {
+            for(; count; --count, ++it)
+                f(*it);
+        };
+        parallel_segments(list.begin(), list.size(), parallel_segment_count(list.size(), threads), task);
+    }
+
+    /*!
+     * \brief Fold all the elements of a list with a binary operation, in parallel.
+     * \param[in] list The list (LinkedList, DoublyLinkedList, UnrolledList...)
+     * \param[in] init The initial value
+     * \param[in] op The binary operation (must be associative and safe to call concurrently, the elements must be convertible to \p T)
+     * \param[in] threads The maximal number of threads (`0` for one per hardware thread)
+     * \return `op(...op(op(init, a0), a1)..., an)`, the elements being grouped by segment
+     *
+     * Each thread folds a segment of consecutive elements, then the partial results are folded into \p init in the order of the segments
+     * (\p op does not need to be commutative).
+     * \note Small lists (less than parallel_grain_size elements per thread) use fewer threads, down to the calling thread only.
+     * \warning The list must not be modified during the call.
+     */
+    template <typename List, typename T, typename BinaryOperation>
+    T parallel_reduce(const List & list, T init, BinaryOperation op, size_t threads = 0)
+    {
+        if(list.empty())
+            return init;
+
+        size_t segments = parallel_segment_count(list.size(), threads);
+        std::vector<T> partials(segments, init);
+
+        auto task = [&op, &partials](size_t index, typename List::const_iterator it, size_t count)
+        {
+            T acc = T(*it);
+            for(++it, --count; count; --count, ++it)
+                acc = op(std::move(acc), *it);
+            partials[index] = std::move(acc);
+        };
+        parallel_segments(list.cbegin(), list.size(), segments, task);
+
+        for(T & partial : partials)
+            init = op(std::move(init), std::move(partial));
+        return init;
+    }
+}
+
+#endif // MANUAL_PARALLEL_H
@@ -0,0 +1,662 @@
+#ifndef MANUAL_PERSISTENTLIST_H
+#define MANUAL_PERSISTENTLIST_H
+
+/*!
+ * \file persistentlist.h
+ * \brief An immutable linked list sharing its tails between copies (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#include <memory_resource>
+#define MANUAL_HAS_PMR
+#endif
+#endif
+
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(no_unique_address)
+#define MANUAL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+#endif
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#define MANUAL_NO_UNIQUE_ADDRESS
+#endif
+#endif
+
+namespace manual
+{
+    /*!
+     * \class PersistentList
+     * \brief An immutable singly linked list whose nodes are shared (reference-counted) between the copies.
+     * \tparam T The type of the elements
+     * \tparam Allocator The allocator of the nodes
+     *
+     * A PersistentList is a handle on a chain of nodes which are never modified once linked: push_front() links a new node
+     * in front of the shared chain and pop_front() (or tail()) only moves the handle, so that the copies, push_front(),
+     * pop_front() and tail() are all constant time and leave the other lists untouched.<br/>
+     * A node is destroyed with the last list it belongs to.
+     *
+     * \note The reference counts are atomic: two lists sharing nodes can be used (and destroyed) by two threads
+     * without synchronization, a snapshot is a copy. A same list used by two threads has to be synchronized.
+     * \warning The lists sharing nodes use copies of the same allocator (the one of the list they were copied from).
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class PersistentList
+    {
+        protected:
+            /*!
+             * \struct Node
+             * \brief Internal representation of a node.
+             */
+            struct Node final
+            {
+                /*!
+                 * \brief Value constructor.
+                 * \param[in] next_node The node to link after (already acquired)
+                 * \param[in] args The arguments to construct the value from
+                 */
+                template <typename... Args>
+                explicit Node(Node * next_node, Args &&... args) : refs(1), next(next_node), value(std::forward<Args>(args)...)
+                {}
+
+                std::atomic<size_t> refs; /*!< The number of lists and nodes referring to the node */
+                Node * next;              /*!< Link to the next node */
+                const T value;            /*!< The value */
+            };
+
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator; /*!< The allocator rebound to the node type */
+            typedef std::allocator_traits<NodeAllocator> NodeAllocatorTraits;                             /*!< The node allocator traits */
+
+            // data members
+            Node * head_;                                     /*!< Pointer to the head (shared) */
+            size_t size_;                                     /*!< The size */
+            MANUAL_NO_UNIQUE_ADDRESS NodeAllocator allocator_; /*!< The node allocator */
+
+            // Node management
+            /*!
+             * \brief Allocate and construct a node.
+             * \param[in] next The node to link after (already acquired)
+             * \param[in] args The arguments to construct the value from
+             * \return The new node (referred once)
+             *
+             * \note The node is given back if the value constructor throws (\p next stays acquired).
+             */
+            template <typename... Args>
+            Node * create_node(Node * next, Args &&... args)
+            {
+                Node * node = NodeAllocatorTraits::allocate(allocator_, 1);
+                try
+                {
+                    NodeAllocatorTraits::construct(allocator_, node, next, std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    NodeAllocatorTraits::deallocate(allocator_, node, 1);
+                    throw;
+                }
+                return node;
+            }
+            /*!
+             * \brief Refer once more to a node.
+             * \param[in,out] node The node (can be `nullptr`)
+             * \return \p node
+             */
+            static Node * acquire(Node * node) noexcept
+            {
+                if(node)
+                    node->refs.fetch_add(1, std::memory_order_relaxed);
+                return node;
+            }
+            /*!
+             * \brief Drop a reference to a node, destroy the nodes which are no longer referred.
+             * \param[in,out] node The node (can be `nullptr`)
+             *
+             * \note The chain is released in a loop (no recursion): destroying a long list does not overflow the stack.
+             */
+            void release(Node * node) noexcept
+            {
+                while(node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    Node * next = node->next;
+                    NodeAllocatorTraits::destroy(allocator_, node);
+                    NodeAllocatorTraits::deallocate(allocator_, node, 1);
+                    node = next;
+                }
+            }
+            /*!
+             * \brief Create a chain from a range, in the same order.
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the last one of the range
+             *
+             * \warning The container must be empty.
+             * \note The chain is built from the head (the nodes are not shared yet): the range is read once.
+             */
+            template <typename InputIt>
+            void assign_range(InputIt first, InputIt last)
+            {
+                Node ** link = &head_;
+                try
+                {
+                    for(; first != last; ++first)
+                    {
+                        *link = create_node(nullptr, *first);
+                        link = &(*link)->next;
+                        ++size_;
+                    }
+                }
+                catch(...)
+                {
+                    release(head_);
+                    head_ = nullptr;
+                    size_ = 0;
+                    throw;
+                }
+            }
+            /*!
+             * \brief Share the nodes of \p other, and its allocator (the allocator follows the copied content).
+             * \param[in] other The PersistentList to copy
+             */
+            void copy_from(const PersistentList<T, Allocator> & other, std::true_type) noexcept
+            {
+                Node * old = head_;
+                head_ = acquire(other.head_);
+                release(old); // after the acquisition (other may be a tail of this list), with the former allocator
+                size_ = other.size_;
+                allocator_ = other.allocator_;
+            }
+            /*!
+             * \brief Share the nodes of \p other if both allocators are equal, copy its values otherwise (the allocator stays).
+             * \param[in] other The PersistentList to copy
+             */
+            void copy_from(const PersistentList<T, Allocator> & other, std::false_type)
+            {
+                if(NodeAllocatorTraits::is_always_equal::value || allocator_ == other.allocator_)
+                {
+                    Node * old = head_;
+                    head_ = acquire(other.head_);
+                    release(old); // after the acquisition: other may be a tail of this list
+                    size_ = other.size_;
+                }
+                else
+                {
+                    PersistentList<T, Allocator> tmp(other.cbegin(), other.cend(), Allocator(allocator_));
+                    std::swap(head_, tmp.head_);
+                    std::swap(size_, tmp.size_);
+                }
+            }
+            /*!
+             * \brief Steal the nodes of \p other, and its allocator (the allocator follows the moved content).
+             * \param[in,out] other The PersistentList to move (left empty)
+             */
+            void move_from(PersistentList<T, Allocator> & other, std::true_type) noexcept
+            {
+                release(head_);
+                head_ = std::exchange(other.head_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                allocator_ = std::move(other.allocator_);
+            }
+            /*!
+             * \brief Steal the nodes of \p other if both allocators are equal, copy its values otherwise (the allocator stays).
+             * \param[in,out] other The PersistentList to move (left empty)
+             */
+            void move_from(PersistentList<T, Allocator> & other, std::false_type)
+            {
+                if(NodeAllocatorTraits::is_always_equal::value || allocator_ == other.allocator_)
+                {
+                    release(head_);
+                    head_ = std::exchange(other.head_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                }
+                else
+                {
+                    copy_from(other, std::false_type());
+                    other.clear();
+                }
+            }
+            /*!
+             * \brief Swap the allocators (they follow the swapped content).
+             * \param[in,out] other The PersistentList to swap with
+             */
+            void swap_allocator(PersistentList<T, Allocator> & other, std::true_type) noexcept
+            {
+                using std::swap;
+                swap(allocator_, other.allocator_);
+            }
+            /*!
+             * \brief Keep the allocators (they do not follow the swapped content).
+             */
+            void swap_allocator(PersistentList<T, Allocator> &, std::false_type) noexcept
+            {}
+            /*!
+             * \brief Create a list from a chain.
+             * \param[in] head The head of the chain (already acquired)
+             * \param[in] size The size of the chain
+             * \param[in] alloc The allocator of the chain
+             */
+            PersistentList(Node * head, size_t size, const NodeAllocator & alloc) noexcept : head_(head), size_(size), allocator_(alloc)
+            {}
+
+        public:
+            class ConstIterator;
+
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            PersistentList() : head_(nullptr), size_(0), allocator_()
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates an empty list.
+             */
+            explicit PersistentList(const Allocator & alloc) : head_(nullptr), size_(0), allocator_(alloc)
+            {}
+            /*!
+             * \brief Range constructor.
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the last one of the range
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates a list holding a copy of the range, in the same order.
+             */
+            template <typename InputIt, typename = typename std::enable_if<std::is_convertible<typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>::value>::type>
+            PersistentList(InputIt first, InputIt last, const Allocator & alloc = Allocator()) : head_(nullptr), size_(0), allocator_(alloc)
+            {
+                assign_range(first, last);
+            }
+            /*!
+             * \brief Initializer list constructor.
+             * \param[in] init The initializer list
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates a list holding a copy of the initializer list, in the same order.
+             */
+            PersistentList(std::initializer_list<T> init, const Allocator & alloc = Allocator()) : head_(nullptr), size_(0), allocator_(alloc)
+            {
+                assign_range(init.begin(), init.end());
+            }
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The PersistentList to copy
+             *
+             * Creates a list sharing all the nodes of \p other.
+             *
+             * \note Constant time (no copy of the elements), the allocator is copied with the nodes.
+             */
+            PersistentList(const PersistentList<T, Allocator> & other) noexcept : head_(acquire(other.head_)), size_(other.size_), allocator_(other.allocator_)
+            {}
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The PersistentList to move (left empty)
+             */
+            PersistentList(PersistentList<T, Allocator> && other) noexcept : head_(std::exchange(other.head_, nullptr)), size_(std::exchange(other.size_, 0)), allocator_(other.allocator_)
+            {}
+            /*!
+             * \brief Destructor.
+             *
+             * \note The nodes only referred by this list are destroyed.
+             */
+            ~PersistentList()
+            {
+                release(head_);
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const noexcept
+            {
+                return size_;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the list is empty, `false` otherwise
+             */
+            bool empty() const noexcept
+            {
+                return !head_;
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the first element.
+             * \return A direct `const` reference to the first value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return head_->value;
+            }
+            /*!
+             * \brief Get the list without its first element.
+             * \return A list sharing all the nodes but the head
+             *
+             * \note Constant time.
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            PersistentList<T, Allocator> tail() const
+            {
+                return PersistentList<T, Allocator>(acquire(head_->next), size_-1, allocator_);
+            }
+            /*!
+             * \brief Get the number of lists and nodes sharing the head.
+             * \return The reference count of the head, 0 if the list is empty
+             *
+             * \note 1 means that no other list refers to the nodes of this list (push_front() extends an unshared chain).
+             * The count is only a hint when another thread holds a list sharing the head.
+             */
+            size_t use_count() const noexcept
+            {
+                return head_ ? head_->refs.load(std::memory_order_relaxed) : 0;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Add a value at the beginning of the list.
+             * \param[in] val The value to add
+             *
+             * \note Constant time, the lists sharing the nodes are not affected.
+             */
+            void push_front(const T & val)
+            {
+                emplace_front(val);
+            }
+            /*!
+             * \brief Add a value at the beginning of the list.
+             * \param[in,out] val The value to add (moved)
+             *
+             * \note Constant time, the lists sharing the nodes are not affected.
+             */
+            void push_front(T && val)
+            {
+                emplace_front(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the beginning of the list.
+             * \param[in] args The arguments to construct the value from
+             * \return A `const` reference to the new value
+             *
+             * \note Constant time, the lists sharing the nodes are not affected.
+             */
+            template <typename... Args>
+            const T & emplace_front(Args &&... args)
+            {
+                head_ = create_node(head_, std::forward<Args>(args)...); // the reference of this list moves to the new node
+                ++size_;
+                return head_->value;
+            }
+            /*!
+             * \brief Remove the first value of the list (if any).
+             *
+             * \note Constant time, the node is only destroyed if no other list refers to it.
+             */
+            void pop_front() noexcept
+            {
+                if(head_)
+                {
+                    Node * old = head_;
+                    head_ = acquire(old->next);
+                    --size_;
+                    release(old);
+                }
+            }
+            /*!
+             * \brief Clear the container.
+             *
+             * \note The nodes only referred by this list are destroyed.
+             */
+            void clear() noexcept
+            {
+                release(std::exchange(head_, nullptr));
+                size_ = 0;
+            }
+            /*!
+             * \brief Swap the content of two PersistentList.
+             * \param[in,out] other The PersistentList to swap with
+             *
+             * \warning If the allocators do not follow the swapped content, both allocators must compare equal (Undefined Behaviour).
+             */
+            void swap(PersistentList<T, Allocator> & other) noexcept
+            {
+                std::swap(head_, other.head_);
+                std::swap(size_, other.size_);
+                swap_allocator(other, typename NodeAllocatorTraits::propagate_on_container_swap());
+            }
+
+            // Operators
+            /*!
+             * \brief Assignment operator.
+             * \param[in] other The PersistentList to copy
+             * \return A reference to `*this`
+             *
+             * \note Constant time (the nodes of \p other are shared), the allocator is copied with the nodes if it follows the copied content.
+             * Otherwise the nodes are only shared if both allocators are equal, the values are copied with the current allocator if they are not.
+             */
+            PersistentList<T, Allocator> & operator=(const PersistentList<T, Allocator> & other) noexcept(NodeAllocatorTraits::propagate_on_container_copy_assignment::value || NodeAllocatorTraits::is_always_equal::value)
+            {
+                if(this != &other)
+                    copy_from(other, typename NodeAllocatorTraits::propagate_on_container_copy_assignment());
+                return *this;
+            }
+            /*!
+             * \brief Move assignment operator.
+             * \param[in,out] other The PersistentList to move (left empty)
+             * \return A reference to `*this`
+             *
+             * \note If the allocator does not follow the moved content and both allocators are not equal, the values are copied.
+             */
+            PersistentList<T, Allocator> & operator=(PersistentList<T, Allocator> && other) noexcept(NodeAllocatorTraits::propagate_on_container_move_assignment::value || NodeAllocatorTraits::is_always_equal::value)
+            {
+                if(this != &other)
+                    move_from(other, typename NodeAllocatorTraits::propagate_on_container_move_assignment());
+                return *this;
+            }
+            /*!
+             * \brief Equality operator.
+             * \param[in] lhs The left-hand side
+             * \param[in] rhs The right-hand side
+             * \return `true` if both lists hold equal elements in the same order, `false` otherwise
+             *
+             * \note The comparison stops at the first shared node (the rest is the same chain).
+             */
+            friend bool operator==(const PersistentList<T, Allocator> & lhs, const PersistentList<T, Allocator> & rhs)
+            {
+                if(lhs.size_ != rhs.size_)
+                    return false;
+                for(const Node * l = lhs.head_, * r = rhs.head_; l != r; l = l->next, r = r->next)
+                {
+                    if(!(l->value == r->value))
+                        return false;
+                }
+                return true;
+            }
+            /*!
+             * \brief Inequality operator.
+             * \param[in] lhs The left-hand side
+             * \param[in] rhs The right-hand side
+             * \return `true` if the lists differ, `false` otherwise
+             */
+            friend bool operator!=(const PersistentList<T, Allocator> & lhs, const PersistentList<T, Allocator> & rhs)
+            {
+                return !(lhs == rhs);
+            }
+
+            // Iterator
+            /*!
+             * \class ConstIterator
+             * \brief A `const` iterator implementation (the elements are immutable)
+             *
+             * \note An iterator stays valid as long as a list refers to its node.
+             */
+            class ConstIterator final
+            {
+                friend class PersistentList;
+
+                private:
+                    const Node * node;
+
+                public:
+                    typedef std::forward_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;              /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                           /*!< The pointer to a pointed value */
+                    typedef const T & reference;                         /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstIterator() : node(nullptr)
+                    {}
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return lhs.node == rhs.node;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return node->value;
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value as `const`
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return &(node->value);
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator & operator++() //prefix
+                    {
+                        if(node)
+                            node = node->next;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator operator++(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+            };
+
+            // Standard container types
+            typedef T value_type;                   /*!< The type of the elements */
+            typedef Allocator allocator_type;       /*!< The type of the allocator */
+            typedef size_t size_type;               /*!< The type of the size */
+            typedef std::ptrdiff_t difference_type; /*!< The type of the distance between two iterators */
+            typedef const T & reference;            /*!< The reference to an element (immutable) */
+            typedef const T & const_reference;      /*!< The `const` reference to an element */
+            typedef ConstIterator iterator;         /*!< The iterator type (immutable) */
+            typedef ConstIterator const_iterator;   /*!< The `const` iterator type */
+
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator begin() const
+            {
+                return cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator end() const
+            {
+                return cend();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator cbegin() const
+            {
+                ConstIterator cit;
+                cit.node = head_;
+                return cit;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator cend() const
+            {
+                return ConstIterator();
+            }
+
+            /*!
+             * \brief Swap two PersistentList.
+             * \param[in,out] lhs The first list
+             * \param[in,out] rhs The second list
+             */
+            friend void swap(PersistentList<T, Allocator> & lhs, PersistentList<T, Allocator> & rhs) noexcept
+            {
+                lhs.swap(rhs);
+            }
+    };
+
+#ifdef MANUAL_HAS_PMR
+    namespace pmr
+    {
+        template <typename T> using PersistentList = manual::PersistentList<T, std::pmr::polymorphic_allocator<T>>; /*!< PersistentList using a `std::pmr::memory_resource` */
+    }
+#endif
+
+    // The copies and the moves do not throw: a snapshot never fails
+    static_assert(std::is_nothrow_copy_constructible<PersistentList<int>>::value && std::is_nothrow_move_constructible<PersistentList<int>>::value, "manual::PersistentList - The copies may throw.");
+}
+
+#endif // MANUAL_PERSISTENTLIST_H
@@ -0,0 +1,475 @@
+#ifndef MANUAL_POOLALLOCATOR_H
+#define MANUAL_POOLALLOCATOR_H
+
+/*!
+ * \file poolallocator.h
+ * \brief A fixed-size node pool and its allocator (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace manual
+{
+    /*!
+     * \class NodePool
+     * \brief A fixed-size block pool.
+     *
+     * Memory is requested from the global heap by _slabs_ of several blocks.
+     * Freed blocks are kept in a free list and reused by the next allocations, so that a container
+     * which keeps inserting and removing elements does not go back to the global heap.
+     *
+     * \note The memory is only given back to the global heap by release() or by the destructor.
+     * \warning Not thread-safe.
+     */
+    class NodePool final
+    {
+        private:
+            /*!
+             * \struct FreeBlock
+             * \brief Internal representation of a free block.
+             */
+            struct FreeBlock final
+            {
+                FreeBlock * next; /*!< Link to the next free block */
+            };
+            /*!
+             * \struct Slab
+             * \brief Header stored at the beginning of each slab.
+             */
+            struct Slab final
+            {
+                Slab * next;  /*!< Link to the previously allocated slab */
+                size_t bytes; /*!< The size of the slab (header included) */
+            };
+
+            // data members
+            size_t block_size_;        /*!< The size of a block (rounded up to the alignment) */
+            size_t header_size_;       /*!< The size of a slab header (rounded up to the alignment) */
+            size_t blocks_per_slab_;   /*!< The number of blocks carved from each slab */
+            FreeBlock * free_list_;    /*!< The blocks given back by deallocate() */
+            Slab * slabs_;             /*!< The slabs allocated so far */
+            unsigned char * cursor_;   /*!< The next never-used block of the current slab */
+            unsigned char * last_;     /*!< The end of the current slab */
+            size_t reserved_;          /*!< The number of next allocations served from the current slab before the free list (set by reserve()) */
+            Slab * recycled_;          /*!< The next slab to carve again (set by recycle()) */
+
+            static size_t round_up(size_t size, size_t align)
+            {
+                return (size + align - 1) / align * align;
+            }
+            /*!
+             * \brief Request a slab from the global heap.
+             * \param[in] blocks The number of blocks of the slab
+             * \return The new slab (already in the list of the slabs)
+             */
+            Slab * new_slab(size_t blocks)
+            {
+                size_t bytes = header_size_ + block_size_ * blocks;
+                Slab * slab = static_cast<Slab*>(::operator new(bytes));
+                slab->next = slabs_;
+                slab->bytes = bytes;
+                slabs_ = slab;
+                return slab;
+            }
+            /*!
+             * \brief Carve the next blocks from a slab.
+             * \param[in] slab The slab
+             */
+            void use_slab(Slab * slab) noexcept
+            {
+                cursor_ = reinterpret_cast<unsigned char*>(slab) + header_size_;
+                last_ = reinterpret_cast<unsigned char*>(slab) + slab->bytes;
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Constructor.
+             * \param[in] block_size The size of the blocks to provide
+             * \param[in] block_align The alignment of the blocks to provide
+             * \param[in] blocks_per_slab The number of blocks to request from the global heap at once
+             *
+             * \note \p block_align cannot exceed `alignof(std::max_align_t)`.
+             */
+            NodePool(size_t block_size, size_t block_align, size_t blocks_per_slab = 256) : block_size_(0), header_size_(0), blocks_per_slab_(blocks_per_slab ? blocks_per_slab : 1), free_list_(nullptr), slabs_(nullptr), cursor_(nullptr), last_(nullptr), reserved_(0), recycled_(nullptr)
+            {
+                if(block_align < alignof(FreeBlock))
+                    block_align = alignof(FreeBlock);
+                if(block_size < sizeof(FreeBlock))
+                    block_size = sizeof(FreeBlock);
+
+                block_size_ = round_up(block_size, block_align);
+                header_size_ = round_up(sizeof(Slab), block_align);
+            }
+            NodePool(const NodePool &) = delete;
+            NodePool & operator=(const NodePool &) = delete;
+            ~NodePool()
+            {
+                release();
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the size of the provided blocks.
+             * \return The block size
+             */
+            size_t block_size() const
+            {
+                return block_size_;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Get a block.
+             * \return The address of an uninitialized block of block_size() bytes
+             *
+             * \throws std::bad_alloc If a new slab is needed and the global heap is exhausted.
+             */
+            void * allocate()
+            {
+                if(free_list_ && !reserved_)
+                {
+                    FreeBlock * block = free_list_;
+                    free_list_ = block->next;
+                    return block;
+                }
+                if(cursor_ == last_)
+                {
+                    if(recycled_)
+                    {
+                        use_slab(recycled_);
+                        recycled_ = recycled_->next;
+                    }
+                    else
+                        use_slab(new_slab(blocks_per_slab_));
+                }
+                if(reserved_)
+                    --reserved_;
+                void * block = cursor_;
+                cursor_ += block_size_;
+                return block;
+            }
+            /*!
+             * \brief Make room for a given number of allocations in the current slab.
+             * \param[in] count The number of blocks about to be allocated
+             *
+             * If the current slab has not enough never-used blocks left, one slab of at least \p count blocks is requested from the global heap
+             * (the blocks left in the previous slab are moved to the free list).<br/>
+             * The next \p count allocations are then served from the current slab before the free list: they are contiguous, in allocation order.
+             * \throws std::bad_alloc If the global heap is exhausted.
+             */
+            void reserve(size_t count)
+            {
+                if(static_cast<size_t>(last_ - cursor_) / block_size_ >= count)
+                {
+                    reserved_ = count;
+                    return;
+                }
+
+                Slab * slab = nullptr;
+                if(recycled_ && (recycled_->bytes - header_size_) / block_size_ >= count)
+                {
+                    slab = recycled_;
+                    recycled_ = recycled_->next;
+                }
+                else
+                    slab = new_slab(count > blocks_per_slab_ ? count : blocks_per_slab_);
+                for(; cursor_ != last_; cursor_ += block_size_)
+                    deallocate(cursor_);
+                use_slab(slab);
+                reserved_ = count;
+            }
+            /*!
+             * \brief Give a block back to the pool.
+             * \param[in] block A block previously obtained by allocate()
+             */
+            void deallocate(void * block) noexcept
+            {
+                FreeBlock * tmp = static_cast<FreeBlock*>(block);
+                tmp->next = free_list_;
+                free_list_ = tmp;
+            }
+            /*!
+             * \brief Give all the slabs back to the global heap.
+             *
+             * \warning Every block obtained from this pool becomes invalid.
+             */
+            void release() noexcept
+            {
+                while(slabs_)
+                {
+                    Slab * tmp = slabs_->next;
+                    ::operator delete(slabs_);
+                    slabs_ = tmp;
+                }
+                free_list_ = nullptr;
+                cursor_ = nullptr;
+                last_ = nullptr;
+                reserved_ = 0;
+                recycled_ = nullptr;
+            }
+            /*!
+             * \brief Make all the blocks available again, keeping the slabs.
+             *
+             * Constant time: the slabs are carved again, one after the other, by the next allocations (the free list is emptied).
+             * \warning Every block obtained from this pool becomes invalid.
+             */
+            void recycle() noexcept
+            {
+                free_list_ = nullptr;
+                cursor_ = nullptr;
+                last_ = nullptr;
+                reserved_ = 0;
+                recycled_ = slabs_;
+            }
+    };
+
+    /*!
+     * \class PoolResource
+     * \brief A set of NodePool, one per requested block size.
+     *
+     * It is the memory shared by a PoolAllocator and all its copies (including the rebound ones).
+     *
+     * \warning Not thread-safe.
+     */
+    class PoolResource final
+    {
+        private:
+            /*!
+             * \struct Entry
+             * \brief Internal association between a block layout and its pool.
+             */
+            struct Entry final
+            {
+                size_t size;                    /*!< The requested block size */
+                size_t align;                   /*!< The requested block alignment */
+                std::unique_ptr<NodePool> pool; /*!< The pool serving this layout */
+            };
+
+            // data members
+            std::vector<Entry> pools_; /*!< The pools created so far */
+            size_t blocks_per_slab_;   /*!< The number of blocks per slab given to the pools */
+
+        public:
+            // Constructors
+            /*!
+             * \brief Constructor.
+             * \param[in] blocks_per_slab The number of blocks each pool requests from the global heap at once
+             */
+            explicit PoolResource(size_t blocks_per_slab = 256) : blocks_per_slab_(blocks_per_slab)
+            {}
+            PoolResource(const PoolResource &) = delete;
+            PoolResource & operator=(const PoolResource &) = delete;
+
+            // Element Access
+            /*!
+             * \brief Get the pool serving a given block layout (created if needed).
+             * \param[in] size The block size
+             * \param[in] align The block alignment
+             * \return A reference to the pool
+             */
+            NodePool & pool(size_t size, size_t align)
+            {
+                for(Entry & entry : pools_)
+                {
+                    if(entry.size == size && entry.align == align)
+                        return *entry.pool;
+                }
+                std::unique_ptr<NodePool> tmp(new NodePool(size, align, blocks_per_slab_));
+                pools_.push_back(Entry{size, align, std::move(tmp)});
+                return *pools_.back().pool;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Give all the slabs of all the pools back to the global heap.
+             *
+             * \warning Every block obtained from this resource becomes invalid.
+             */
+            void release() noexcept
+            {
+                for(Entry & entry : pools_)
+                    entry.pool->release();
+            }
+    };
+
+    /*!
+     * \class PoolAllocator
+     * \brief A `std::allocator` compatible allocator backed by a PoolResource.
+     *
+     * Single object allocations are served by the NodePool of the matching size, bigger requests go to the global heap.<br/>
+     * The copies of an allocator (and the rebound ones) share the same PoolResource and compare equal.
+     *
+     * \warning Not thread-safe.
+     */
+    template <typename T>
+    class PoolAllocator
+    {
+        template <typename U> friend class PoolAllocator;
+
+        static_assert(alignof(T) <= alignof(std::max_align_t), "manual::PoolAllocator - Over-aligned types are not supported.");
+
+        private:
+            std::shared_ptr<PoolResource> resource_; /*!< The shared memory */
+            NodePool * pool_;                        /*!< The pool of `sizeof(T)` blocks within the resource */
+
+        public:
+            typedef T value_type; /*!< The allocated type */
+            typedef std::true_type propagate_on_container_copy_assignment; /*!< The allocator follows the copied content */
+            typedef std::true_type propagate_on_container_move_assignment; /*!< The allocator follows the moved content */
+            typedef std::true_type propagate_on_container_swap;            /*!< The allocator follows the swapped content */
+
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates a new PoolResource.
+             */
+            PoolAllocator() : resource_(std::make_shared<PoolResource>()), pool_(&resource_->pool(sizeof(T), alignof(T)))
+            {}
+            /*!
+             * \brief Constructor.
+             * \param[in] resource The PoolResource to allocate from
+             */
+            explicit PoolAllocator(std::shared_ptr<PoolResource> resource) : resource_(std::move(resource)), pool_(&resource_->pool(sizeof(T), alignof(T)))
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The PoolAllocator to copy
+             *
+             * \note There is no move constructor so that a moved PoolAllocator keeps its resource.
+             */
+            PoolAllocator(const PoolAllocator<T> & other) noexcept = default;
+            /*!
+             * \brief Rebinding constructor.
+             * \param[in] other The PoolAllocator to share the resource with
+             */
+            template <typename U>
+            PoolAllocator(const PoolAllocator<U> & other) : resource_(other.resource_), pool_(&resource_->pool(sizeof(T), alignof(T)))
+            {}
+            PoolAllocator<T> & operator=(const PoolAllocator<T> & other) noexcept = default;
+
+            /*!
+             * \brief Get the shared resource.
+             * \return The PoolResource this allocator allocates from
+             */
+            const std::shared_ptr<PoolResource> & resource() const
+            {
+                return resource_;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Allocate uninitialized storage.
+             * \param[in] n The number of objects
+             * \return A pointer to the storage
+             *
+             * \throws std::bad_alloc If the memory is exhausted.
+             */
+            T * allocate(size_t n)
+            {
+                if(n == 1)
+                    return static_cast<T*>(pool_->allocate());
+                return static_cast<T*>(::operator new(n * sizeof(T)));
+            }
+            /*!
+             * \brief Make room for a given number of single object allocations.
+             * \param[in] n The number of objects about to be allocated one by one
+             *
+             * \note The next \p n single object allocations need at most one allocation from the global heap, and are contiguous (see NodePool::reserve()).
+             */
+            void reserve(size_t n)
+            {
+                pool_->reserve(n);
+            }
+            /*!
+             * \brief Deallocate storage.
+             * \param[in] p The pointer obtained from allocate()
+             * \param[in] n The number of objects given to allocate()
+             */
+            void deallocate(T * p, size_t n) noexcept
+            {
+                if(n == 1)
+                    pool_->deallocate(p);
+                else
+                    ::operator delete(p);
+            }
+            /*!
+             * \brief Make all the blocks of the pool available again, if no other allocator shares the resource (see NodePool::recycle()).
+             * \return `true` if the blocks were recycled, `false` otherwise (nothing is done)
+             *
+             * \note Lets a container drop all its nodes in constant time instead of deallocating them one by one.
+             * \warning Every block obtained from this allocator becomes invalid when `true` is returned.
+             */
+            bool recycle_if_unique() noexcept
+            {
+                if(resource_.use_count() != 1)
+                    return false;
+                pool_->recycle();
+                return true;
+            }
+    };
+
+    /*!
+     * \struct allocator_has_reserve
+     * \brief Check if an allocator can prepare a given number of single object allocations (e.g. manual::PoolAllocator).
+     *
+     * The containers call `alloc.reserve(n)` before creating \p n nodes at once when the allocator provides it.
+     */
+    template <typename Allocator, typename = void>
+    struct allocator_has_reserve : std::false_type
+    {};
+    /*!
+     * \brief Specialization for the allocators providing `reserve(size_t)`.
+     */
+    template <typename Allocator>
+    struct allocator_has_reserve<Allocator, decltype(std::declval<Allocator&>().reserve(size_t()), void())> : std::true_type
+    {};
+
+    /*!
+     * \struct allocator_has_recycle
+     * \brief Check if an allocator can take all its blocks back at once (e.g. manual::PoolAllocator).
+     *
+     * The containers call `alloc.recycle_if_unique()` to drop trivially destructible nodes without visiting them.
+     */
+    template <typename Allocator, typename = void>
+    struct allocator_has_recycle : std::false_type
+    {};
+    /*!
+     * \brief Specialization for the allocators providing `recycle_if_unique()`.
+     */
+    template <typename Allocator>
+    struct allocator_has_recycle<Allocator, decltype(static_cast<bool>(std::declval<Allocator&>().recycle_if_unique()), void())> : std::true_type
+    {};
+
+    /*!
+     * \brief Equality operator.
+     * \param[in] lhs The left-hand side
+     * \param[in] rhs The right-hand side
+     * \return `true` if both allocators share the same resource, `false` otherwise
+     */
+    template <typename T, typename U>
+    bool operator==(const PoolAllocator<T> & lhs, const PoolAllocator<U> & rhs)
+    {
+        return lhs.resource() == rhs.resource();
+    }
+    /*!
+     * \brief Inequality operator.
+     * \param[in] lhs The left-hand side
+     * \param[in] rhs The right-hand side
+     * \return `true` if the allocators do not share the same resource, `false` otherwise
+     */
+    template <typename T, typename U>
+    bool operator!=(const PoolAllocator<T> & lhs, const PoolAllocator<U> & rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
+
+#endif // MANUAL_POOLALLOCATOR_H
@@ -0,0 +1,241 @@
+#ifndef MANUAL_SHARDEDLIST_H
+#define MANUAL_SHARDEDLIST_H
+
+/*!
+ * \file shardedlist.h
+ * \brief A list split into per-thread shards for the parallel append (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "concurrentlinkedqueue.h" // cache_line_size
+#include "doublylinkedlist.h"
+
+namespace manual
+{
+    /*!
+     * \class ShardedList
+     * \brief A DoublyLinkedList split into shards, so that several threads can append without contending.
+     *
+     * Each thread appends to its own shard (the threads are dealt the shards in turn, the first time they append), and collect()
+     * splices all the shards into one DoublyLinkedList in `O(#shards)`: the nodes are relinked, never copied.<br/>
+     * Each shard is guarded by its own mutex, which is only ever contended when more threads than shards append at once.
+     *
+     * \note The order of the elements is kept within a shard (i.e. per thread), collect() concatenates the shards in order.
+     * \warning The shards share copies of \p Allocator: the copies must compare equal (for the splice) and be thread-safe.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class ShardedList
+    {
+        protected:
+            /*!
+             * \struct Shard
+             * \brief A list and the mutex guarding it.
+             */
+            struct Shard final
+            {
+                std::mutex mutex;                    /*!< The mutex guarding the list */
+                DoublyLinkedList<T, Allocator> list; /*!< The elements appended to the shard */
+                char padding[cache_line_size];       /*!< Keep the shards on different cache lines */
+
+                /*!
+                 * \brief Allocator constructor.
+                 * \param[in] alloc The allocator to get the nodes from
+                 */
+                explicit Shard(const Allocator & alloc) : mutex(), list(alloc), padding()
+                {}
+            };
+
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Shard> ShardAllocator; /*!< The allocator rebound to the shard type */
+            typedef std::allocator_traits<ShardAllocator> ShardAllocatorTraits;                             /*!< The shard allocator traits */
+
+            // data members
+            Shard * shards_;           /*!< The shards */
+            size_t shard_count_;       /*!< The number of shards */
+            ShardAllocator allocator_; /*!< The shard allocator */
+
+            /*!
+             * \brief Get the shard of the calling thread.
+             * \return A reference to the shard
+             */
+            Shard & local_shard()
+            {
+                static std::atomic<size_t> next_slot{0};
+                static thread_local size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+                return shards_[slot % shard_count_];
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list with one shard per hardware thread.
+             */
+            ShardedList() : ShardedList(std::thread::hardware_concurrency())
+            {}
+            /*!
+             * \brief Shard count constructor.
+             * \param[in] shard_count The number of shards (`0` is treated as `1`)
+             * \param[in] alloc The allocator to get the nodes from
+             *
+             * Creates an empty list.
+             */
+            explicit ShardedList(size_t shard_count, const Allocator & alloc = Allocator()) : shards_(nullptr), shard_count_(shard_count ? shard_count : 1), allocator_(alloc)
+            {
+                shards_ = ShardAllocatorTraits::allocate(allocator_, shard_count_);
+                size_t i = 0;
+                try
+                {
+                    for(; i < shard_count_; ++i)
+                        ShardAllocatorTraits::construct(allocator_, shards_ + i, alloc);
+                }
+                catch(...)
+                {
+                    while(i)
+                        ShardAllocatorTraits::destroy(allocator_, shards_ + --i);
+                    ShardAllocatorTraits::deallocate(allocator_, shards_, shard_count_);
+                    throw;
+                }
+            }
+            /*!
+             * \brief Copy constructor (deleted).
+             *
+             * A sharded list cannot be copied, collect() its content instead.
+             */
+            ShardedList(const ShardedList<T, Allocator> &) = delete;
+            /*!
+             * \brief Destructor.
+             *
+             * \warning No thread must be using the list.
+             */
+            ~ShardedList()
+            {
+                for(size_t i = shard_count_; i > 0; --i)
+                    ShardAllocatorTraits::destroy(allocator_, shards_ + (i-1));
+                ShardAllocatorTraits::deallocate(allocator_, shards_, shard_count_);
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the number of shards.
+             * \return The number of shards
+             */
+            size_t shard_count() const
+            {
+                return shard_count_;
+            }
+            /*!
+             * \brief Get the size of the container.
+             * \return The total size of the shards
+             *
+             * \note Each shard is locked in turn: the result may be outdated if other threads are appending.
+             */
+            size_t size()
+            {
+                size_t res = 0;
+                for(size_t i = 0; i < shard_count_; ++i)
+                {
+                    std::lock_guard<std::mutex> lock(shards_[i].mutex);
+                    res += shards_[i].list.size();
+                }
+                return res;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if all the shards are empty, `false` otherwise
+             *
+             * \note Each shard is locked in turn: the result may be outdated if other threads are appending.
+             */
+            bool empty()
+            {
+                return size() == 0;
+            }
+
+            // Modifiers
+            /*!
+             * \brief Add a value at the end of the shard of the calling thread.
+             * \param[in] val The value to push
+             */
+            void push_back(const T & val)
+            {
+                emplace_back(val);
+            }
+            /*!
+             * \brief Add a value at the end of the shard of the calling thread.
+             * \param[in,out] val The value to push (moved)
+             */
+            void push_back(T && val)
+            {
+                emplace_back(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the end of the shard of the calling thread.
+             * \param[in] args The arguments to construct the value from
+             *
+             * \note Thread-safe, only contended by the other threads dealt the same shard.
+             */
+            template <typename... Args>
+            void emplace_back(Args &&... args)
+            {
+                Shard & shard = local_shard();
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.list.emplace_back(std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Move all the elements to the end of a given list.
+             * \param[in,out] out The list receiving the elements (its allocator must compare equal to the one of the shards)
+             *
+             * \note Thread-safe, `O(#shards)`: each shard is locked in turn and spliced (the nodes are relinked, no copy, no allocation).
+             */
+            void collect(DoublyLinkedList<T, Allocator> & out)
+            {
+                for(size_t i = 0; i < shard_count_; ++i)
+                {
+                    std::lock_guard<std::mutex> lock(shards_[i].mutex);
+                    out.splice(out.cend(), shards_[i].list);
+                }
+            }
+            /*!
+             * \brief Move all the elements into a new list.
+             * \return The list of all the elements (shard after shard)
+             *
+             * \note Thread-safe, `O(#shards)`: each shard is locked in turn and spliced (the nodes are relinked, no copy, no allocation).
+             */
+            DoublyLinkedList<T, Allocator> collect()
+            {
+                DoublyLinkedList<T, Allocator> res(shards_[0].list.get_allocator());
+                collect(res);
+                return res;
+            }
+            /*!
+             * \brief Clear the container.
+             *
+             * \note Thread-safe, each shard is locked in turn.
+             */
+            void clear()
+            {
+                for(size_t i = 0; i < shard_count_; ++i)
+                {
+                    std::lock_guard<std::mutex> lock(shards_[i].mutex);
+                    shards_[i].list.clear();
+                }
+            }
+
+            // Operators
+            /*!
+             * \brief Copy assignment operator (deleted).
+             *
+             * A sharded list cannot be copied, collect() its content instead.
+             */
+            ShardedList<T, Allocator> & operator=(const ShardedList<T, Allocator> &) = delete;
+    };
+}
+
+#endif // MANUAL_SHARDEDLIST_H
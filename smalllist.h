@@ -0,0 +1,1311 @@
+#ifndef MANUAL_SMALLLIST_H
+#define MANUAL_SMALLLIST_H
+
+/*!
+ * \file smalllist.h
+ * \brief Linked lists storing their first nodes inside the container object (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "doublylinkedlist.h"
+#include "linkedlist.h"
+
+namespace manual
+{
+    /*!
+     * \class NodeArena
+     * \brief A fixed number of node slots provided by an external storage (the storage of an InlineNodeArena).
+     *
+     * Slots are carved in order from the storage, then the freed ones are reused first.
+     *
+     * \warning Not thread-safe.
+     */
+    class NodeArena
+    {
+        private:
+            /*!
+             * \struct FreeSlot
+             * \brief Internal representation of a free slot.
+             */
+            struct FreeSlot final
+            {
+                FreeSlot * next; /*!< Link to the next free slot */
+            };
+
+            // data members
+            unsigned char * first_;  /*!< The beginning of the storage */
+            unsigned char * cursor_; /*!< The next never-used slot */
+            unsigned char * last_;   /*!< The end of the storage */
+            FreeSlot * free_;        /*!< The slots given back by deallocate() */
+            size_t slot_size_;       /*!< The size of a slot */
+            size_t slot_align_;      /*!< The alignment of the slots */
+            size_t used_;            /*!< The number of slots currently allocated */
+
+        protected:
+            /*!
+             * \brief Constructor.
+             * \param[in] storage The storage to carve the slots from (suitably aligned)
+             * \param[in] slot_size The size of a slot (a multiple of \p slot_align, at least `sizeof(void*)`)
+             * \param[in] slot_align The alignment of the slots
+             * \param[in] count The number of slots
+             */
+            NodeArena(void * storage, size_t slot_size, size_t slot_align, size_t count) noexcept : first_(static_cast<unsigned char*>(storage)), cursor_(first_), last_(first_ + slot_size * count),
+                                                                                                    free_(nullptr), slot_size_(slot_size), slot_align_(slot_align), used_(0)
+            {}
+
+        public:
+            NodeArena(const NodeArena &) = delete;
+            NodeArena & operator=(const NodeArena &) = delete;
+
+            // Capacity
+            /*!
+             * \brief Get the number of slots.
+             * \return The number of slots
+             */
+            size_t capacity() const noexcept
+            {
+                return static_cast<size_t>(last_ - first_) / slot_size_;
+            }
+            /*!
+             * \brief Get the number of slots currently allocated.
+             * \return The number of allocated slots
+             */
+            size_t used() const noexcept
+            {
+                return used_;
+            }
+
+            // Operations
+            /*!
+             * \brief Check if a pointer designates a slot of the arena.
+             * \param[in] p The pointer to check
+             * \return `true` if \p p is within the storage, `false` otherwise
+             */
+            bool owns(const void * p) const noexcept
+            {
+                const unsigned char * tmp = static_cast<const unsigned char*>(p);
+                return !std::less<const unsigned char*>()(tmp, first_) && std::less<const unsigned char*>()(tmp, last_);
+            }
+
+            // Modifiers
+            /*!
+             * \brief Allocate a slot.
+             * \param[in] size The size of the object to store
+             * \param[in] align The alignment of the object to store
+             * \return A pointer to the slot, `nullptr` if the arena is full or if the object does not fit in a slot
+             */
+            void * allocate(size_t size, size_t align) noexcept
+            {
+                if(size > slot_size_ || align > slot_align_)
+                    return nullptr;
+                void * res = nullptr;
+                if(free_)
+                {
+                    res = free_;
+                    free_ = free_->next;
+                }
+                else if(cursor_ != last_)
+                {
+                    res = cursor_;
+                    cursor_ += slot_size_;
+                }
+                else
+                    return nullptr;
+                ++used_;
+                return res;
+            }
+            /*!
+             * \brief Deallocate a slot.
+             * \param[in] p The pointer to give back
+             * \return `true` if \p p was a slot of the arena (and is now free), `false` otherwise (nothing is done)
+             */
+            bool deallocate(void * p) noexcept
+            {
+                if(!owns(p))
+                    return false;
+                free_ = ::new(p) FreeSlot{free_};
+                --used_;
+                return true;
+            }
+    };
+
+    /*!
+     * \class InlineNodeArena
+     * \brief A NodeArena whose storage is a member (it lives wherever the arena object lives).
+     * \tparam SlotSize The size of the objects to store
+     * \tparam SlotAlign The alignment of the objects to store
+     * \tparam N The number of slots
+     */
+    template <size_t SlotSize, size_t SlotAlign, size_t N>
+    class InlineNodeArena final : public NodeArena
+    {
+        static_assert(N > 0, "manual::InlineNodeArena - The arena must have at least one slot.");
+
+        private:
+            static constexpr size_t slot_align = (SlotAlign < alignof(void*)) ? alignof(void*) : SlotAlign;                                     /*!< The alignment of a slot (it can hold a free link) */
+            static constexpr size_t slot_size = ((SlotSize < sizeof(void*) ? sizeof(void*) : SlotSize) + slot_align - 1) / slot_align * slot_align; /*!< The size of a slot */
+
+            // data members
+            alignas(slot_align) unsigned char storage_[slot_size * N]; /*!< The storage of the slots */
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an arena with all its slots free.
+             */
+            InlineNodeArena() noexcept : NodeArena(storage_, slot_size, slot_align, N)
+            {}
+    };
+
+    /*!
+     * \class SmallNodeAllocator
+     * \brief A `std::allocator` compatible allocator serving the single object allocations from a NodeArena first.
+     *
+     * When the arena is full (or when there is no arena), the allocations go to the global heap.<br/>
+     * The copies of an allocator (and the rebound ones) share the same arena and compare equal.
+     *
+     * \note The allocator does not follow the content of a container (copy, move or swap): the arena belongs to its container.
+     */
+    template <typename T>
+    class SmallNodeAllocator
+    {
+        template <typename U> friend class SmallNodeAllocator;
+
+        private:
+            NodeArena * arena_; /*!< The arena (`nullptr` to allocate from the global heap only) */
+
+        public:
+            typedef T value_type; /*!< The allocated type */
+            typedef std::false_type propagate_on_container_copy_assignment; /*!< The allocator stays with its container */
+            typedef std::false_type propagate_on_container_move_assignment; /*!< The allocator stays with its container */
+            typedef std::false_type propagate_on_container_swap;            /*!< The allocator stays with its container */
+            typedef std::false_type is_always_equal;                        /*!< The allocators of two containers are not interchangeable */
+
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an allocator without arena (the global heap is used).
+             */
+            SmallNodeAllocator() noexcept : arena_(nullptr)
+            {}
+            /*!
+             * \brief Constructor.
+             * \param[in] arena The arena to allocate from first
+             */
+            explicit SmallNodeAllocator(NodeArena * arena) noexcept : arena_(arena)
+            {}
+            /*!
+             * \brief Rebinding constructor.
+             * \param[in] other The SmallNodeAllocator to share the arena with
+             */
+            template <typename U>
+            SmallNodeAllocator(const SmallNodeAllocator<U> & other) noexcept : arena_(other.arena_)
+            {}
+
+            /*!
+             * \brief Get the arena.
+             * \return The arena this allocator allocated from first (`nullptr` if there is none)
+             */
+            NodeArena * arena() const noexcept
+            {
+                return arena_;
+            }
+            /*!
+             * \brief Get the allocator of a copied container.
+             * \return An allocator without arena (the arena stays with the original container)
+             */
+            SmallNodeAllocator<T> select_on_container_copy_construction() const noexcept
+            {
+                return SmallNodeAllocator<T>();
+            }
+
+            // Modifiers
+            /*!
+             * \brief Allocate uninitialized storage.
+             * \param[in] n The number of objects
+             * \return A pointer to the storage
+             *
+             * \throws std::bad_alloc If the arena is full and the memory is exhausted.
+             */
+            T * allocate(size_t n)
+            {
+                if(n == 1 && arena_)
+                {
+                    if(void * p = arena_->allocate(sizeof(T), alignof(T)))
+                        return static_cast<T*>(p);
+                }
+                return std::allocator<T>().allocate(n);
+            }
+            /*!
+             * \brief Deallocate storage.
+             * \param[in] p The pointer obtained from allocate()
+             * \param[in] n The number of objects given to allocate()
+             */
+            void deallocate(T * p, size_t n) noexcept
+            {
+                if(n == 1 && arena_ && arena_->deallocate(p))
+                    return;
+                std::allocator<T>().deallocate(p, n);
+            }
+    };
+
+    /*!
+     * \brief Equality operator.
+     * \param[in] lhs The left-hand side
+     * \param[in] rhs The right-hand side
+     * \return `true` if both allocators share the same arena, `false` otherwise
+     */
+    template <typename T, typename U>
+    bool operator==(const SmallNodeAllocator<T> & lhs, const SmallNodeAllocator<U> & rhs) noexcept
+    {
+        return lhs.arena() == rhs.arena();
+    }
+    /*!
+     * \brief Inequality operator.
+     * \param[in] lhs The left-hand side
+     * \param[in] rhs The right-hand side
+     * \return `true` if the allocators do not share the same arena, `false` otherwise
+     */
+    template <typename T, typename U>
+    bool operator!=(const SmallNodeAllocator<T> & lhs, const SmallNodeAllocator<U> & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /*!
+     * \class SmallLinkedList
+     * \brief A LinkedList whose first \p N nodes are stored inside the container object.
+     * \tparam T The type of the values
+     * \tparam N The number of nodes stored inline
+     *
+     * A list which never holds more than \p N values does not allocate at all. The next nodes come from the global heap,
+     * and the inline slots are reused as soon as they are freed.
+     *
+     * \note A move steals the heap nodes and only moves the values of the inline nodes, one by one (at most \p N of them):
+     * it walks the list up to the last inline node, i.e. through the first \p N nodes when the list grew at its back.
+     * \note The LinkedList is a private base, so that its nodes cannot be stolen through a `LinkedList &`: the operations moving
+     * nodes to or from another list (splice_after(), splice_back(), merge(), split_after()) first move the values of the inline nodes
+     * leaving the container into heap nodes, and only accept a SmallLinkedList or a heap_list_type.
+     * Their allocators do not compare equal, but a heap node is given back to the global heap by any SmallNodeAllocator.
+     */
+    template <typename T, size_t N = 8>
+    class SmallLinkedList : private LinkedList<T, SmallNodeAllocator<T>>
+    {
+        private:
+            typedef LinkedList<T, SmallNodeAllocator<T>> Base;
+            typedef typename Base::Link Link;
+            typedef typename Base::Node Node;
+            typedef typename Base::NodeAllocator NodeAllocator;
+            typedef typename Base::NodeAllocatorTraits NodeAllocatorTraits;
+
+            // data members
+            InlineNodeArena<sizeof(Node), alignof(Node), N> arena_; /*!< The inline nodes */
+
+        public:
+            typedef Base heap_list_type; /*!< The type of the lists exchanging nodes with a SmallLinkedList (heap nodes only, e.g. the result of split_after()) */
+
+        private:
+            /*!
+             * \brief Check if a type can give its nodes to a SmallLinkedList.
+             */
+            template <typename List>
+            using RequireSource = typename std::enable_if<std::is_same<typename std::decay<List>::type, SmallLinkedList<T, N>>::value
+                                                          || std::is_same<typename std::decay<List>::type, heap_list_type>::value>::type;
+
+            /*!
+             * \brief Allocate and construct a node on the global heap, whatever the free inline slots.
+             * \param[in] args The arguments to construct the value from
+             * \return The new node (not linked)
+             */
+            template <typename... Args>
+            Node * create_heap_node(Args &&... args)
+            {
+                NodeAllocator heap; // no arena
+                Node * node = NodeAllocatorTraits::allocate(heap, 1);
+                this->stats_.on_allocate();
+                try
+                {
+                    NodeAllocatorTraits::construct(heap, node, std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    NodeAllocatorTraits::deallocate(heap, node, 1);
+                    this->stats_.on_deallocate();
+                    throw;
+                }
+                MANUAL_HARDENED_ONLY(node->stamp = this->next_stamp_++;)
+                return node;
+            }
+            /*!
+             * \brief Move the values of the inline nodes of a range into heap nodes, so that the range can leave the container.
+             * \param[in] prev The link preceding the range
+             * \param[in] last The node following the range (`nullptr` for the end)
+             *
+             * The iterators to the moved values are invalidated.
+             * \note If an exception is thrown, the nodes moved so far stay on the heap and the others are untouched (the values are only moved
+             * if their move constructor does not throw, copied otherwise).
+             */
+            void unload_inline(Link * prev, const Node * last)
+            {
+                if(!arena_.used())
+                    return;
+                for(Link * link = prev; link->next != last; link = link->next)
+                {
+                    Node * node = link->next;
+                    if(!arena_.owns(node))
+                        continue;
+                    Node * tmp = create_heap_node(std::move_if_noexcept(node->value));
+                    tmp->next = node->next;
+                    link->next = tmp;
+                    if(this->tail_ == node)
+                        this->tail_ = tmp;
+                    this->destroy_node(node);
+                }
+            }
+            /*!
+             * \brief Prepare a range of another SmallLinkedList to be moved.
+             * \param[in,out] other The SmallLinkedList holding the range
+             * \param[in] first The element preceding the range
+             * \param[in] last The element following the range (can be end())
+             * \return \p other, as a LinkedList
+             */
+            Base & source(SmallLinkedList<T, N> & other, typename Base::ConstIterator first, typename Base::ConstIterator last)
+            {
+                if(&other != this)
+                    other.unload_inline(Base::link_of(first), static_cast<const Node*>(Base::link_of(last)));
+                return other;
+            }
+            /*!
+             * \brief Prepare a range of a heap_list_type to be moved (nothing to do).
+             * \param[in,out] other The list holding the range
+             * \return \p other
+             */
+            static Base & source(heap_list_type & other, typename Base::ConstIterator, typename Base::ConstIterator) noexcept
+            {
+                return other;
+            }
+
+            /*!
+             * \brief Steal the nodes of \p other, and move the values of its inline nodes into the inline nodes of this container.
+             * \param[in,out] other The SmallLinkedList to move from
+             *
+             * \warning The container must be empty, without spare nodes.
+             */
+            void move_from(SmallLinkedList<T, N> & other, std::true_type) noexcept
+            {
+                other.release_spare_nodes();
+                size_t inline_count = other.arena_.used();
+                this->head_.next = std::exchange(other.head_.next, nullptr);
+                this->tail_ = std::exchange(other.tail_, nullptr);
+                this->size_ = std::exchange(other.size_, 0);
+                for(Link * link = &this->head_; inline_count; link = link->next)
+                {
+                    Node * node = link->next;
+                    if(!other.arena_.owns(node))
+                        continue;
+                    // The inline slots of this container are all free: the creation cannot fail
+                    Node * tmp = this->create_node(std::move(node->value));
+                    tmp->next = node->next;
+                    link->next = tmp;
+                    if(this->tail_ == node)
+                        this->tail_ = tmp;
+                    other.destroy_node(node);
+                    --inline_count;
+                }
+            }
+            /*!
+             * \brief Steal the nodes of \p other if they are all on the heap, move the values one by one otherwise.
+             * \param[in,out] other The SmallLinkedList to move from
+             *
+             * \warning The container must be empty, without spare nodes.
+             */
+            void move_from(SmallLinkedList<T, N> & other, std::false_type)
+            {
+                other.release_spare_nodes();
+                if(!other.arena_.used())
+                {
+                    this->head_.next = std::exchange(other.head_.next, nullptr);
+                    this->tail_ = std::exchange(other.tail_, nullptr);
+                    this->size_ = std::exchange(other.size_, 0);
+                    return;
+                }
+                this->append_values(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            SmallLinkedList() noexcept : Base(SmallNodeAllocator<T>(&arena_)), arena_()
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The SmallLinkedList to copy
+             */
+            SmallLinkedList(const SmallLinkedList<T, N> & other) : SmallLinkedList(other.cbegin(), other.cend())
+            {}
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The SmallLinkedList to move from
+             *
+             * \note The moved SmallLinkedList will be left empty but still valid.
+             */
+            SmallLinkedList(SmallLinkedList<T, N> && other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallLinkedList()
+            {
+                move_from(other, std::is_nothrow_move_constructible<T>());
+            }
+            /*!
+             * \brief Initialization constructor.
+             * \param[in] init_list An initializer list to copy
+             */
+            SmallLinkedList(const std::initializer_list<T> & init_list) : SmallLinkedList(init_list.begin(), init_list.end())
+            {}
+            /*!
+             * \brief Range constructor.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             */
+            template <typename InputIt, typename = typename Base::template RequireInputIterator<InputIt>>
+            SmallLinkedList(InputIt first, InputIt last) : SmallLinkedList()
+            {
+                this->append_values(first, last);
+            }
+            ~SmallLinkedList()
+            {
+                // The nodes are given back while the arena is still alive
+                this->clear();
+                this->release_spare_nodes();
+            }
+
+            // Standard container types (see LinkedList)
+            typedef typename Base::Iterator Iterator;
+            typedef typename Base::ConstIterator ConstIterator;
+            typedef typename Base::value_type value_type;
+            typedef typename Base::reference reference;
+            typedef typename Base::const_reference const_reference;
+            typedef typename Base::size_type size_type;
+            typedef typename Base::difference_type difference_type;
+            typedef typename Base::iterator iterator;
+            typedef typename Base::const_iterator const_iterator;
+            typedef typename Base::allocator_type allocator_type;
+
+            // Capacity (see LinkedList)
+            using Base::empty;
+            using Base::size;
+            using Base::capacity;
+            using Base::reserve;
+            using Base::shrink_to_fit;
+            using Base::get_allocator;
+            using Base::stats;
+            using Base::reset_stats;
+            using Base::validate;
+            /*!
+             * \brief Get the number of nodes stored inside the container object.
+             * \return \p N
+             */
+            static constexpr size_t inline_capacity() noexcept
+            {
+                return N;
+            }
+            /*!
+             * \brief Get the number of inline nodes in use (including the spare ones).
+             * \return The number of inline nodes in use
+             */
+            size_t inline_nodes() const noexcept
+            {
+                return arena_.used();
+            }
+
+            // Element Access (see LinkedList)
+            using Base::front;
+            using Base::back;
+            using Base::at;
+            using Base::operator[];
+
+            // Lookup (see LinkedList)
+            using Base::find;
+            using Base::find_if;
+            using Base::contains;
+            using Base::count;
+            using Base::count_if;
+
+            // Iterator (see LinkedList)
+            using Base::before_begin;
+            using Base::cbefore_begin;
+            using Base::begin;
+            using Base::cbegin;
+            using Base::end;
+            using Base::cend;
+
+            // Modifiers (see LinkedList)
+            using Base::clear;
+            using Base::assign;
+            using Base::push_back;
+            using Base::push_front;
+            using Base::emplace_back;
+            using Base::emplace_front;
+            using Base::pop_back;
+            using Base::pop_front;
+            using Base::insert;
+            using Base::insert_after;
+            using Base::insert_range_after;
+            using Base::append_range;
+            using Base::emplace;
+            using Base::emplace_after;
+            using Base::erase_after;
+            using Base::remove;
+            /*!
+             * \brief Swap the contents with another SmallLinkedList.
+             * \param[in,out] other The SmallLinkedList to swap with
+             *
+             * \note Done with three moves: see the move constructor.
+             */
+            void swap(SmallLinkedList<T, N> & other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                SmallLinkedList<T, N> tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+            }
+
+            // Operations (see LinkedList)
+            using Base::remove_if;
+            using Base::remove_value;
+            using Base::unique;
+            using Base::sort;
+            using Base::reverse;
+            /*!
+             * \brief Move all the elements of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The SmallLinkedList or heap_list_type to take the elements from (left empty)
+             *
+             * \warning \p other must not be `*this` (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice_after(ConstIterator pos, List && other)
+            {
+                Base::splice_after(pos, source(other, other.cbefore_begin(), other.cend()));
+            }
+            /*!
+             * \brief Move one element of another list after the given position.
+             * \param[in] pos The element after which to move the element (can be before_begin())
+             * \param[in,out] other The SmallLinkedList or heap_list_type to take the element from (can be `*this`)
+             * \param[in] it The element preceding the one to move
+             *
+             * \note The node is relinked. If it is an inline node of another container, its value is first moved into a heap node (its iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice_after(ConstIterator pos, List && other, ConstIterator it)
+            {
+                ConstIterator last = it;
+                ++last;
+                ++last;
+                Base::splice_after(pos, source(other, it, last), it);
+            }
+            /*!
+             * \brief Move the elements (first, last) of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The SmallLinkedList or heap_list_type to take the elements from (can be `*this`)
+             * \param[in] first The element preceding the first one to move (can be before_begin())
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning \p pos must not be in (first, last) (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of another container are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice_after(ConstIterator pos, List && other, ConstIterator first, ConstIterator last)
+            {
+                Base::splice_after(pos, source(other, first, last), first, last);
+            }
+            /*!
+             * \brief Move all the elements of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The SmallLinkedList or heap_list_type to take the elements from (left empty)
+             *
+             * \warning \p other must not be `*this` (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice_after(Iterator pos, List && other)
+            {
+                splice_after(Base::template iterator_cast<ConstIterator>(pos), other);
+            }
+            /*!
+             * \brief Move one element of another list after the given position.
+             * \param[in] pos The element after which to move the element (can be before_begin())
+             * \param[in,out] other The SmallLinkedList or heap_list_type to take the element from (can be `*this`)
+             * \param[in] it The element preceding the one to move
+             *
+             * \note The node is relinked. If it is an inline node of another container, its value is first moved into a heap node (its iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice_after(Iterator pos, List && other, Iterator it)
+            {
+                splice_after(Base::template iterator_cast<ConstIterator>(pos), other, Base::template iterator_cast<ConstIterator>(it));
+            }
+            /*!
+             * \brief Move the elements (first, last) of another list after the given position.
+             * \param[in] pos The element after which to move the elements (can be before_begin())
+             * \param[in,out] other The SmallLinkedList or heap_list_type to take the elements from (can be `*this`)
+             * \param[in] first The element preceding the first one to move (can be before_begin())
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning \p pos must not be in (first, last) (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of another container are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice_after(Iterator pos, List && other, Iterator first, Iterator last)
+            {
+                splice_after(Base::template iterator_cast<ConstIterator>(pos), other, Base::template iterator_cast<ConstIterator>(first), Base::template iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Move all the elements of another list at the end of the container.
+             * \param[in,out] other The SmallLinkedList or heap_list_type to take the elements from (left empty)
+             *
+             * \warning \p other must not be `*this` (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice_back(List && other)
+            {
+                Base::splice_back(source(other, other.cbefore_begin(), other.cend()));
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list.
+             * \param[in,out] other The SmallLinkedList or heap_list_type to merge (left empty)
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \note Linear time. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename Compare, typename = RequireSource<List>>
+            void merge(List && other, Compare comp)
+            {
+                if(&other != this)
+                    Base::merge(source(other, other.cbefore_begin(), other.cend()), comp);
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list (using `operator<`).
+             * \param[in,out] other The SmallLinkedList or heap_list_type to merge (left empty)
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \note Linear time. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void merge(List && other)
+            {
+                if(&other != this)
+                    Base::merge(source(other, other.cbefore_begin(), other.cend()));
+            }
+            /*!
+             * \brief Split the container in two after the given position.
+             * \param[in] pos The element preceding the first one to move to the new list (can be before_begin())
+             * \return A heap_list_type holding the elements (pos, end()), allocating from the global heap
+             *
+             * \note The heap nodes are relinked. The values of the inline nodes are first moved into heap nodes (their iterators are invalidated),
+             * so that the new list does not depend on this container.
+             */
+            heap_list_type split_after(ConstIterator pos)
+            {
+                unload_inline(Base::link_of(pos), nullptr);
+                heap_list_type res;
+                res.splice_after(res.cbefore_begin(), static_cast<Base &>(*this), pos, this->cend());
+                return res;
+            }
+            /*!
+             * \brief Split the container in two after the given position.
+             * \param[in] pos The element preceding the first one to move to the new list (can be before_begin())
+             * \return A heap_list_type holding the elements (pos, end()), allocating from the global heap
+             *
+             * \note The heap nodes are relinked. The values of the inline nodes are first moved into heap nodes (their iterators are invalidated),
+             * so that the new list does not depend on this container.
+             */
+            heap_list_type split_after(Iterator pos)
+            {
+                return split_after(Base::template iterator_cast<ConstIterator>(pos));
+            }
+
+            // Operators
+            /*!
+             * \brief Copy assignment operator.
+             * \param[in] other The SmallLinkedList to copy
+             * \return A reference to the current list
+             */
+            SmallLinkedList<T, N> & operator=(const SmallLinkedList<T, N> & other)
+            {
+                Base::operator=(other);
+                return *this;
+            }
+            /*!
+             * \brief Move assignment operator.
+             * \param[in,out] other The SmallLinkedList to move from
+             * \return A reference to the current list
+             *
+             * \note The moved SmallLinkedList will be left empty but still valid.
+             */
+            SmallLinkedList<T, N> & operator=(SmallLinkedList<T, N> && other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                if(this != &other)
+                {
+                    this->clear();
+                    this->release_spare_nodes();
+                    move_from(other, std::is_nothrow_move_constructible<T>());
+                }
+                return *this;
+            }
+
+            /*!
+             * \brief Swap two SmallLinkedList.
+             * \param[in,out] lhs The first list
+             * \param[in,out] rhs The second list
+             */
+            friend void swap(SmallLinkedList<T, N> & lhs, SmallLinkedList<T, N> & rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                lhs.swap(rhs);
+            }
+    };
+
+    /*!
+     * \class SmallDoublyLinkedList
+     * \brief A DoublyLinkedList whose first \p N nodes are stored inside the container object.
+     * \tparam T The type of the values
+     * \tparam N The number of nodes stored inline
+     *
+     * A list which never holds more than \p N values does not allocate at all. The next nodes come from the global heap,
+     * and the inline slots are reused as soon as they are freed.
+     *
+     * \note A move steals the heap nodes and only moves the values of the inline nodes, one by one (at most \p N of them):
+     * it walks the list up to the last inline node, i.e. through the first \p N nodes when the list grew at its back.
+     * \note The DoublyLinkedList is a private base, so that its nodes cannot be stolen through a `DoublyLinkedList &`: the operations moving
+     * nodes to or from another list (splice(), merge(), split_at()) first move the values of the inline nodes leaving the container
+     * into heap nodes, and only accept a SmallDoublyLinkedList or a heap_list_type.
+     * Their allocators do not compare equal, but a heap node is given back to the global heap by any SmallNodeAllocator.
+     */
+    template <typename T, size_t N = 8>
+    class SmallDoublyLinkedList : private DoublyLinkedList<T, SmallNodeAllocator<T>>
+    {
+        private:
+            typedef DoublyLinkedList<T, SmallNodeAllocator<T>> Base;
+            typedef typename Base::Node Node;
+            typedef typename Base::NodeAllocator NodeAllocator;
+            typedef typename Base::NodeAllocatorTraits NodeAllocatorTraits;
+
+            // data members
+            InlineNodeArena<sizeof(Node), alignof(Node), N> arena_; /*!< The inline nodes */
+
+        public:
+            typedef Base heap_list_type; /*!< The type of the lists exchanging nodes with a SmallDoublyLinkedList (heap nodes only, e.g. the result of split_at()) */
+
+        private:
+            /*!
+             * \brief Check if a type can give its nodes to a SmallDoublyLinkedList.
+             */
+            template <typename List>
+            using RequireSource = typename std::enable_if<std::is_same<typename std::decay<List>::type, SmallDoublyLinkedList<T, N>>::value
+                                                          || std::is_same<typename std::decay<List>::type, heap_list_type>::value>::type;
+
+            /*!
+             * \brief Allocate and construct a node on the global heap, whatever the free inline slots.
+             * \param[in] args The arguments to construct the value from
+             * \return The new node (not linked)
+             */
+            template <typename... Args>
+            Node * create_heap_node(Args &&... args)
+            {
+                NodeAllocator heap; // no arena
+                Node * node = NodeAllocatorTraits::allocate(heap, 1);
+                this->stats_.on_allocate();
+                try
+                {
+                    NodeAllocatorTraits::construct(heap, node, std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    NodeAllocatorTraits::deallocate(heap, node, 1);
+                    this->stats_.on_deallocate();
+                    throw;
+                }
+                MANUAL_HARDENED_ONLY(node->stamp = this->next_stamp_++;)
+                return node;
+            }
+            /*!
+             * \brief Move the values of the inline nodes of a range into heap nodes, so that the range can leave the container.
+             * \param[in] first The first element of the range
+             * \param[in] last The element following the range (can be end())
+             * \return The first element of the range (a new iterator if its node was moved)
+             *
+             * The iterators to the moved values are invalidated.
+             * \note If an exception is thrown, the nodes moved so far stay on the heap and the others are untouched (the values are only moved
+             * if their move constructor does not throw, copied otherwise).
+             */
+            typename Base::ConstIterator unload_inline(typename Base::ConstIterator first, typename Base::ConstIterator last)
+            {
+                if(!arena_.used() || first == last)
+                    return first;
+                Node * stop = Base::node_of(last);
+                Node * head = Base::node_of(first);
+                for(Node * node = head; node != stop;)
+                {
+                    Node * next = node->next;
+                    if(arena_.owns(node))
+                    {
+                        Node * tmp = create_heap_node(std::move_if_noexcept(node->value));
+                        tmp->next = node->next;
+                        tmp->previous = node->previous;
+                        if(tmp->previous)
+                            tmp->previous->next = tmp;
+                        else
+                            this->head_ = tmp;
+                        if(tmp->next)
+                            tmp->next->previous = tmp;
+                        else
+                            this->tail_ = tmp;
+                        if(node == head)
+                            head = tmp;
+                        this->destroy_node(node);
+                    }
+                    node = next;
+                }
+                return static_cast<const Base &>(*this).iterator_to(head->value);
+            }
+            /*!
+             * \brief Prepare a range of another SmallDoublyLinkedList to be moved.
+             * \param[in,out] other The SmallDoublyLinkedList holding the range
+             * \param[in,out] first The first element of the range (updated if its node is moved)
+             * \param[in] last The element following the range (can be end())
+             * \return \p other, as a DoublyLinkedList
+             */
+            Base & source(SmallDoublyLinkedList<T, N> & other, typename Base::ConstIterator & first, typename Base::ConstIterator last)
+            {
+                if(&other != this)
+                    first = other.unload_inline(first, last);
+                return other;
+            }
+            /*!
+             * \brief Prepare a range of a heap_list_type to be moved (nothing to do).
+             * \param[in,out] other The list holding the range
+             * \return \p other
+             */
+            static Base & source(heap_list_type & other, typename Base::ConstIterator &, typename Base::ConstIterator) noexcept
+            {
+                return other;
+            }
+
+            /*!
+             * \brief Steal the nodes of \p other, and move the values of its inline nodes into the inline nodes of this container.
+             * \param[in,out] other The SmallDoublyLinkedList to move from
+             *
+             * \warning The container must be empty, without spare nodes.
+             */
+            void move_from(SmallDoublyLinkedList<T, N> & other, std::true_type) noexcept
+            {
+                other.release_spare_nodes();
+                size_t inline_count = other.arena_.used();
+                this->head_ = std::exchange(other.head_, nullptr);
+                this->tail_ = std::exchange(other.tail_, nullptr);
+                this->size_ = std::exchange(other.size_, 0);
+                for(Node * node = this->head_; inline_count; node = node->next)
+                {
+                    if(!other.arena_.owns(node))
+                        continue;
+                    // The inline slots of this container are all free: the creation cannot fail
+                    Node * tmp = this->create_node(std::move(node->value));
+                    tmp->next = node->next;
+                    tmp->previous = node->previous;
+                    if(tmp->previous)
+                        tmp->previous->next = tmp;
+                    else
+                        this->head_ = tmp;
+                    if(tmp->next)
+                        tmp->next->previous = tmp;
+                    else
+                        this->tail_ = tmp;
+                    other.destroy_node(node);
+                    node = tmp;
+                    --inline_count;
+                }
+            }
+            /*!
+             * \brief Steal the nodes of \p other if they are all on the heap, move the values one by one otherwise.
+             * \param[in,out] other The SmallDoublyLinkedList to move from
+             *
+             * \warning The container must be empty, without spare nodes.
+             */
+            void move_from(SmallDoublyLinkedList<T, N> & other, std::false_type)
+            {
+                other.release_spare_nodes();
+                if(!other.arena_.used())
+                {
+                    this->head_ = std::exchange(other.head_, nullptr);
+                    this->tail_ = std::exchange(other.tail_, nullptr);
+                    this->size_ = std::exchange(other.size_, 0);
+                    return;
+                }
+                this->append_values(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            SmallDoublyLinkedList() noexcept : Base(SmallNodeAllocator<T>(&arena_)), arena_()
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The SmallDoublyLinkedList to copy
+             */
+            SmallDoublyLinkedList(const SmallDoublyLinkedList<T, N> & other) : SmallDoublyLinkedList(other.cbegin(), other.cend())
+            {}
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The SmallDoublyLinkedList to move from
+             *
+             * \note The moved SmallDoublyLinkedList will be left empty but still valid.
+             */
+            SmallDoublyLinkedList(SmallDoublyLinkedList<T, N> && other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallDoublyLinkedList()
+            {
+                move_from(other, std::is_nothrow_move_constructible<T>());
+            }
+            /*!
+             * \brief Initialization constructor.
+             * \param[in] init_list An initializer list to copy
+             */
+            SmallDoublyLinkedList(const std::initializer_list<T> & init_list) : SmallDoublyLinkedList(init_list.begin(), init_list.end())
+            {}
+            /*!
+             * \brief Range constructor.
+             * \param[in] first The first element to copy
+             * \param[in] last The element following the last one to copy
+             */
+            template <typename InputIt, typename = typename Base::template RequireInputIterator<InputIt>>
+            SmallDoublyLinkedList(InputIt first, InputIt last) : SmallDoublyLinkedList()
+            {
+                this->append_values(first, last);
+            }
+            ~SmallDoublyLinkedList()
+            {
+                // The nodes are given back while the arena is still alive
+                this->clear();
+                this->release_spare_nodes();
+            }
+
+            // Standard container types (see DoublyLinkedList)
+            typedef typename Base::Iterator Iterator;
+            typedef typename Base::ConstIterator ConstIterator;
+            typedef typename Base::ReverseIterator ReverseIterator;
+            typedef typename Base::ConstReverseIterator ConstReverseIterator;
+            typedef typename Base::value_type value_type;
+            typedef typename Base::reference reference;
+            typedef typename Base::const_reference const_reference;
+            typedef typename Base::size_type size_type;
+            typedef typename Base::difference_type difference_type;
+            typedef typename Base::iterator iterator;
+            typedef typename Base::const_iterator const_iterator;
+            typedef typename Base::reverse_iterator reverse_iterator;
+            typedef typename Base::const_reverse_iterator const_reverse_iterator;
+            typedef typename Base::allocator_type allocator_type;
+
+            // Capacity (see DoublyLinkedList)
+            using Base::empty;
+            using Base::size;
+            using Base::capacity;
+            using Base::reserve;
+            using Base::shrink_to_fit;
+            using Base::compact;
+            using Base::get_allocator;
+            using Base::stats;
+            using Base::reset_stats;
+            using Base::validate;
+            /*!
+             * \brief Get the number of nodes stored inside the container object.
+             * \return \p N
+             */
+            static constexpr size_t inline_capacity() noexcept
+            {
+                return N;
+            }
+            /*!
+             * \brief Get the number of inline nodes in use (including the spare ones).
+             * \return The number of inline nodes in use
+             */
+            size_t inline_nodes() const noexcept
+            {
+                return arena_.used();
+            }
+
+            // Element Access (see DoublyLinkedList)
+            using Base::front;
+            using Base::back;
+            using Base::at;
+            using Base::operator[];
+
+            // Lookup (see DoublyLinkedList)
+            using Base::find;
+            using Base::find_if;
+            using Base::contains;
+            using Base::count;
+            using Base::count_if;
+
+            // Iterator (see DoublyLinkedList)
+            using Base::begin;
+            using Base::cbegin;
+            using Base::end;
+            using Base::cend;
+            using Base::rbegin;
+            using Base::crbegin;
+            using Base::rend;
+            using Base::crend;
+            using Base::iterator_to;
+
+            // Modifiers (see DoublyLinkedList)
+            using Base::clear;
+            using Base::assign;
+            using Base::push_back;
+            using Base::push_front;
+            using Base::emplace_back;
+            using Base::emplace_front;
+            using Base::pop_back;
+            using Base::pop_front;
+            using Base::insert;
+            using Base::insert_range;
+            using Base::append_range;
+            using Base::emplace;
+            using Base::erase;
+            using Base::remove;
+            /*!
+             * \brief Swap the contents with another SmallDoublyLinkedList.
+             * \param[in,out] other The SmallDoublyLinkedList to swap with
+             *
+             * \note Done with three moves: see the move constructor.
+             */
+            void swap(SmallDoublyLinkedList<T, N> & other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                SmallDoublyLinkedList<T, N> tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+            }
+
+            // Operations (see DoublyLinkedList)
+            using Base::remove_if;
+            using Base::remove_value;
+            using Base::unique;
+            using Base::sort;
+            using Base::reverse;
+            /*!
+             * \brief Move all the elements of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to take the elements from (left empty)
+             *
+             * \warning \p other must not be `*this` (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice(ConstIterator pos, List && other)
+            {
+                ConstIterator first = other.cbegin();
+                Base & from = source(other, first, other.cend());
+                Base::splice(pos, from);
+            }
+            /*!
+             * \brief Move one element of another list before the given position.
+             * \param[in] pos The element before which to move the element (can be end())
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to take the element from (can be `*this`)
+             * \param[in] it The element to move
+             *
+             * \note The node is relinked. If it is an inline node of another container, its value is first moved into a heap node (its iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice(ConstIterator pos, List && other, ConstIterator it)
+            {
+                ConstIterator last = it;
+                ++last;
+                Base & from = source(other, it, last);
+                Base::splice(pos, from, it);
+            }
+            /*!
+             * \brief Move the elements [first, last) of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to take the elements from (can be `*this`)
+             * \param[in] first The first element to move
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning \p pos must not be in [first, last) (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of another container are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice(ConstIterator pos, List && other, ConstIterator first, ConstIterator last)
+            {
+                Base & from = source(other, first, last);
+                Base::splice(pos, from, first, last);
+            }
+            /*!
+             * \brief Move all the elements of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to take the elements from (left empty)
+             *
+             * \warning \p other must not be `*this` (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice(Iterator pos, List && other)
+            {
+                splice(Base::template iterator_cast<ConstIterator>(pos), other);
+            }
+            /*!
+             * \brief Move one element of another list before the given position.
+             * \param[in] pos The element before which to move the element (can be end())
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to take the element from (can be `*this`)
+             * \param[in] it The element to move
+             *
+             * \note The node is relinked. If it is an inline node of another container, its value is first moved into a heap node (its iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice(Iterator pos, List && other, Iterator it)
+            {
+                splice(Base::template iterator_cast<ConstIterator>(pos), other, Base::template iterator_cast<ConstIterator>(it));
+            }
+            /*!
+             * \brief Move the elements [first, last) of another list before the given position.
+             * \param[in] pos The element before which to move the elements (can be end())
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to take the elements from (can be `*this`)
+             * \param[in] first The first element to move
+             * \param[in] last The element following the last one to move (can be end())
+             *
+             * \warning \p pos must not be in [first, last) (Undefined Behaviour).
+             * \note The heap nodes are relinked. The values of the inline nodes of another container are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void splice(Iterator pos, List && other, Iterator first, Iterator last)
+            {
+                splice(Base::template iterator_cast<ConstIterator>(pos), other, Base::template iterator_cast<ConstIterator>(first), Base::template iterator_cast<ConstIterator>(last));
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list.
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to merge (left empty)
+             * \param[in] comp The "less than" comparison function object
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \note Linear time. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename Compare, typename = RequireSource<List>>
+            void merge(List && other, Compare comp)
+            {
+                if(&other != this)
+                {
+                    ConstIterator first = other.cbegin();
+                    Base::merge(source(other, first, other.cend()), comp);
+                }
+            }
+            /*!
+             * \brief Merge another sorted list into this sorted list (using `operator<`).
+             * \param[in,out] other The SmallDoublyLinkedList or heap_list_type to merge (left empty)
+             *
+             * The merge is stable: for equivalent elements, the ones of `*this` precede the ones of \p other.
+             *
+             * \note Linear time. The values of the inline nodes of \p other are first moved into heap nodes (their iterators are invalidated).
+             */
+            template <typename List, typename = RequireSource<List>>
+            void merge(List && other)
+            {
+                if(&other != this)
+                {
+                    ConstIterator first = other.cbegin();
+                    Base::merge(source(other, first, other.cend()));
+                }
+            }
+            /*!
+             * \brief Split the container in two at the given position.
+             * \param[in] pos The first element to move to the new list (can be end())
+             * \return A heap_list_type holding the elements [pos, end()), allocating from the global heap
+             *
+             * \note The heap nodes are relinked. The values of the inline nodes are first moved into heap nodes (their iterators are invalidated),
+             * so that the new list does not depend on this container.
+             */
+            heap_list_type split_at(ConstIterator pos)
+            {
+                pos = unload_inline(pos, this->cend());
+                heap_list_type res;
+                res.splice(res.cend(), static_cast<Base &>(*this), pos, this->cend());
+                return res;
+            }
+            /*!
+             * \brief Split the container in two at the given position.
+             * \param[in] pos The first element to move to the new list (can be end())
+             * \return A heap_list_type holding the elements [pos, end()), allocating from the global heap
+             *
+             * \note The heap nodes are relinked. The values of the inline nodes are first moved into heap nodes (their iterators are invalidated),
+             * so that the new list does not depend on this container.
+             */
+            heap_list_type split_at(Iterator pos)
+            {
+                return split_at(Base::template iterator_cast<ConstIterator>(pos));
+            }
+
+            // Operators
+            /*!
+             * \brief Copy assignment operator.
+             * \param[in] other The SmallDoublyLinkedList to copy
+             * \return A reference to the current list
+             */
+            SmallDoublyLinkedList<T, N> & operator=(const SmallDoublyLinkedList<T, N> & other)
+            {
+                Base::operator=(other);
+                return *this;
+            }
+            /*!
+             * \brief Move assignment operator.
+             * \param[in,out] other The SmallDoublyLinkedList to move from
+             * \return A reference to the current list
+             *
+             * \note The moved SmallDoublyLinkedList will be left empty but still valid.
+             */
+            SmallDoublyLinkedList<T, N> & operator=(SmallDoublyLinkedList<T, N> && other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                if(this != &other)
+                {
+                    this->clear();
+                    this->release_spare_nodes();
+                    move_from(other, std::is_nothrow_move_constructible<T>());
+                }
+                return *this;
+            }
+
+            /*!
+             * \brief Swap two SmallDoublyLinkedList.
+             * \param[in,out] lhs The first list
+             * \param[in,out] rhs The second list
+             */
+            friend void swap(SmallDoublyLinkedList<T, N> & lhs, SmallDoublyLinkedList<T, N> & rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+            {
+                lhs.swap(rhs);
+            }
+    };
+
+    // The moves do not throw: a std::vector of small lists relocates them by move
+    static_assert(std::is_nothrow_move_constructible<SmallLinkedList<int>>::value && std::is_nothrow_move_assignable<SmallLinkedList<int>>::value, "manual::SmallLinkedList - The moves may throw.");
+    static_assert(std::is_nothrow_move_constructible<SmallDoublyLinkedList<int>>::value && std::is_nothrow_move_assignable<SmallDoublyLinkedList<int>>::value, "manual::SmallDoublyLinkedList - The moves may throw.");
+}
+
+#endif // MANUAL_SMALLLIST_H
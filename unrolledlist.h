@@ -0,0 +1,1871 @@
+#ifndef MANUAL_UNROLLEDLIST_H
+#define MANUAL_UNROLLEDLIST_H
+
+/*!
+ * \file unrolledlist.h
+ * \brief An unrolled (chunked) doubly linked list implementation (proposal).
+ * \author Raphaël Lefèvre
+ */
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "listscan.h"
+
+#if defined(__has_include)
+#if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#include <memory_resource>
+#define MANUAL_HAS_PMR
+#endif
+#endif
+
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(no_unique_address)
+#define MANUAL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+#endif
+#ifndef MANUAL_NO_UNIQUE_ADDRESS
+#define MANUAL_NO_UNIQUE_ADDRESS
+#endif
+#endif
+
+namespace manual
+{
+    /*!
+     * \brief Get the default number of elements per chunk of an UnrolledList.
+     * \return The number of elements fitting in about 512 bytes (at least 8)
+     */
+    template <typename T>
+    constexpr size_t unrolled_chunk_size()
+    {
+        return (sizeof(T) <= 64) ? 512 / sizeof(T) : 8;
+    }
+
+    /*!
+     * \class UnrolledList
+     * \brief An unrolled doubly linked list implementation.
+     *
+     * Each node (_chunk_) stores up to \p N elements in contiguous storage, so that a traversal only follows a link every \p N elements
+     * and the link overhead is shared by all the elements of a chunk.<br/>
+     * The chunks are obtained from \p Allocator (rebound to the chunk type).
+     *
+     * \warning Unlike DoublyLinkedList, inserting or removing an element moves the other elements of its chunk (and may split or merge chunks):
+     * it invalidates the iterators and references to the elements of the affected chunks.
+     * \note \p T must be move constructible.
+     */
+    template <typename T, size_t N = unrolled_chunk_size<T>(), typename Allocator = std::allocator<T>>
+    class UnrolledList
+    {
+        static_assert(N >= 2, "manual::UnrolledList - A chunk must be able to hold at least 2 elements.");
+
+        public:
+            class Iterator;
+            class ConstIterator;
+
+        protected:
+            /*!
+             * \struct Chunk
+             * \brief Internal representation of a node.
+             */
+            struct Chunk final
+            {
+                /*!
+                 * \brief Default constructor.
+                 *
+                 * Creates an empty chunk (not linked).
+                 */
+                Chunk() : next(nullptr), previous(nullptr), count(0)
+                {}
+
+                /*!
+                 * \brief Get the storage of the values.
+                 * \return A pointer to the first value
+                 */
+                T * data()
+                {
+                    return reinterpret_cast<T*>(storage);
+                }
+                /*!
+                 * \brief Get the storage of the values.
+                 * \return A `const` pointer to the first value
+                 */
+                const T * data() const
+                {
+                    return reinterpret_cast<const T*>(storage);
+                }
+
+                Chunk * next;                                    /*!< Link to the next chunk */
+                Chunk * previous;                                /*!< Link to the previous chunk */
+                size_t count;                                    /*!< The number of values in the chunk (stored in `[0, count)`) */
+                alignas(T) unsigned char storage[N * sizeof(T)]; /*!< The storage of the values */
+            };
+
+            typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk> ChunkAllocator; /*!< The allocator rebound to the chunk type */
+            typedef std::allocator_traits<ChunkAllocator> ChunkAllocatorTraits;                             /*!< The chunk allocator traits */
+
+            // data members
+            Chunk * head_;                                      /*!< Pointer to the first chunk */
+            Chunk * tail_;                                      /*!< Pointer to the last chunk */
+            size_t size_;                                       /*!< The size */
+            MANUAL_NO_UNIQUE_ADDRESS ChunkAllocator allocator_; /*!< The chunk allocator */
+
+            // Chunk management
+            /*!
+             * \brief Allocate and construct an empty chunk.
+             * \return The new chunk (not linked)
+             */
+            Chunk * create_chunk()
+            {
+                Chunk * chunk = ChunkAllocatorTraits::allocate(allocator_, 1);
+                ChunkAllocatorTraits::construct(allocator_, chunk);
+                return chunk;
+            }
+            /*!
+             * \brief Destroy the values of a chunk, then the chunk itself.
+             * \param[in] chunk The chunk to destroy (already unlinked)
+             */
+            void destroy_chunk(Chunk * chunk)
+            {
+                for(size_t i = 0; i < chunk->count; ++i)
+                    destroy_value(chunk->data() + i);
+                ChunkAllocatorTraits::destroy(allocator_, chunk);
+                ChunkAllocatorTraits::deallocate(allocator_, chunk, 1);
+            }
+            /*!
+             * \brief Construct a value in place.
+             * \param[out] p The uninitialized storage
+             * \param[in] args The arguments to construct the value from
+             */
+            template <typename... Args>
+            void construct_value(T * p, Args &&... args)
+            {
+                ChunkAllocatorTraits::construct(allocator_, p, std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Destroy a value (the storage is kept).
+             * \param[in,out] p The value to destroy
+             */
+            void destroy_value(T * p)
+            {
+                ChunkAllocatorTraits::destroy(allocator_, p);
+            }
+            /*!
+             * \brief Move a value to an uninitialized storage and destroy the source.
+             * \param[out] dst The uninitialized storage
+             * \param[in,out] src The value to move
+             */
+            void relocate(T * dst, T * src)
+            {
+                construct_value(dst, std::move(*src));
+                destroy_value(src);
+            }
+            /*!
+             * \brief Link a chunk after a given chunk.
+             * \param[in,out] pos The chunk after which to link (`nullptr` to prepend)
+             * \param[in,out] chunk The chunk to link (not linked)
+             */
+            void link_chunk_after(Chunk * pos, Chunk * chunk)
+            {
+                chunk->previous = pos;
+                chunk->next = pos ? pos->next : head_;
+                if(chunk->next)
+                    chunk->next->previous = chunk;
+                else
+                    tail_ = chunk;
+                if(pos)
+                    pos->next = chunk;
+                else
+                    head_ = chunk;
+            }
+            /*!
+             * \brief Unlink and destroy a chunk.
+             * \param[in,out] chunk The chunk to remove
+             * \return The chunk following the removed one
+             *
+             * \note The values of the chunk are destroyed but not accounted in the size.
+             */
+            Chunk * erase_chunk(Chunk * chunk)
+            {
+                Chunk * next = chunk->next;
+                if(chunk->previous)
+                    chunk->previous->next = next;
+                else
+                    head_ = next;
+                if(next)
+                    next->previous = chunk->previous;
+                else
+                    tail_ = chunk->previous;
+                destroy_chunk(chunk);
+                return next;
+            }
+            /*!
+             * \brief Find the chunk holding an element.
+             * \param[in,out] index The position of the element in the container (in), its position within the chunk (out)
+             * \return The chunk holding the element
+             *
+             * \warning \p index must be lower than the size.
+             * \note Iterates over the chunks (from the closest end) until the index is reached.
+             */
+            Chunk * locate(size_t & index) const
+            {
+                if((size_-1 - index) < index) // closer to the end
+                {
+                    size_t remaining = size_ - index;
+                    Chunk * current = tail_;
+                    while(remaining > current->count)
+                    {
+                        remaining -= current->count;
+                        current = current->previous;
+                    }
+                    index = current->count - remaining;
+                    return current;
+                }
+                else // closer to the beginning
+                {
+                    Chunk * current = head_;
+                    while(index >= current->count)
+                    {
+                        index -= current->count;
+                        current = current->next;
+                    }
+                    return current;
+                }
+            }
+            /*!
+             * \brief Split a full chunk in two halves.
+             * \param[in,out] chunk The chunk to split
+             * \return The new chunk (linked after \p chunk) holding the upper half
+             */
+            Chunk * split_chunk(Chunk * chunk)
+            {
+                Chunk * tmp = create_chunk();
+                size_t keep = (chunk->count + 1) / 2;
+                for(size_t i = keep; i < chunk->count; ++i)
+                    relocate(tmp->data() + (i - keep), chunk->data() + i);
+                tmp->count = chunk->count - keep;
+                chunk->count = keep;
+                link_chunk_after(chunk, tmp);
+                return tmp;
+            }
+            /*!
+             * \brief Construct a value in place at the given position.
+             * \param[in,out] chunk The chunk where to insert
+             * \param[in] offset The position within the chunk (can be the count of the chunk)
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator to the new value
+             *
+             * \note The values following \p offset in the chunk are shifted, the chunk is split first if it is full.
+             * An insertion at the beginning of a chunk goes to the end of the previous one if it has room.
+             */
+            template <typename... Args>
+            Iterator emplace_in(Chunk * chunk, size_t offset, Args &&... args)
+            {
+                if(offset == 0 && chunk->previous && chunk->previous->count < N)
+                {
+                    chunk = chunk->previous;
+                    offset = chunk->count;
+                }
+
+                if(offset == chunk->count && chunk->count < N) // nothing to move
+                {
+                    construct_value(chunk->data() + offset, std::forward<Args>(args)...);
+                }
+                else
+                {
+                    T tmp(std::forward<Args>(args)...); // args may refer to a value about to be moved
+                    if(chunk->count == N)
+                    {
+                        Chunk * upper = split_chunk(chunk);
+                        if(offset > chunk->count)
+                        {
+                            offset -= chunk->count;
+                            chunk = upper;
+                        }
+                    }
+                    for(size_t i = chunk->count; i > offset; --i)
+                        relocate(chunk->data() + i, chunk->data() + (i-1));
+                    construct_value(chunk->data() + offset, std::move(tmp));
+                }
+                ++chunk->count;
+                ++size_;
+
+                Iterator it;
+                it.chunk = chunk;
+                it.index = offset;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Remove the value at the given position.
+             * \param[in,out] chunk The chunk holding the value
+             * \param[in] offset The position within the chunk
+             * \return An iterator to the value following the removed one
+             *
+             * \note The values following \p offset in the chunk are shifted.
+             * A chunk left empty is destroyed and a chunk left less than half full absorbs the next one if it fits.
+             */
+            Iterator erase_in(Chunk * chunk, size_t offset)
+            {
+                destroy_value(chunk->data() + offset);
+                for(size_t i = offset + 1; i < chunk->count; ++i)
+                    relocate(chunk->data() + (i-1), chunk->data() + i);
+                --chunk->count;
+                --size_;
+
+                Iterator it;
+                if(!chunk->count)
+                {
+                    it.chunk = erase_chunk(chunk);
+                    it.index = 0;
+                    it.list = this;
+                    return it;
+                }
+
+                Chunk * next = chunk->next;
+                if(next && chunk->count < N / 2 && chunk->count + next->count <= N)
+                {
+                    for(size_t i = 0; i < next->count; ++i)
+                        relocate(chunk->data() + chunk->count + i, next->data() + i);
+                    chunk->count += next->count;
+                    next->count = 0;
+                    erase_chunk(next);
+                }
+
+                if(offset < chunk->count)
+                {
+                    it.chunk = chunk;
+                    it.index = offset;
+                    it.list = this;
+                }
+                else
+                {
+                    it.chunk = chunk->next;
+                    it.index = 0;
+                    it.list = this;
+                }
+                return it;
+            }
+            /*!
+             * \brief Close the gap left in a chunk by removed values.
+             * \param[in,out] chunk The chunk to compact
+             * \param[in] kept The number of values kept so far (stored in `[0, kept)`)
+             * \param[in] from The position of the first value not visited yet (the values in `[kept, from)` are destroyed)
+             *
+             * \note The values in `[from, count)` are shifted down to \p kept, the count and the size are updated.
+             */
+            void close_gap(Chunk * chunk, size_t kept, size_t from)
+            {
+                size_ -= from - kept;
+                for(size_t i = from; i < chunk->count; ++i, ++kept)
+                    relocate(chunk->data() + kept, chunk->data() + i);
+                chunk->count = kept;
+            }
+            /*!
+             * \brief Copy the allocator of \p other (it follows the copied content).
+             * \param[in] other The UnrolledList being copied
+             *
+             * \warning The container must be empty.
+             */
+            void copy_allocator(const UnrolledList<T, N, Allocator> & other, std::true_type)
+            {
+                allocator_ = other.allocator_;
+            }
+            /*!
+             * \brief Keep the current allocator (it does not follow the copied content).
+             */
+            void copy_allocator(const UnrolledList<T, N, Allocator> &, std::false_type)
+            {}
+            /*!
+             * \brief Steal the content of \p other (the allocator follows the moved content).
+             * \param[in,out] other The UnrolledList to move from
+             *
+             * \warning The container must be empty.
+             */
+            void move_from(UnrolledList<T, N, Allocator> & other, std::true_type) noexcept
+            {
+                allocator_ = std::move(other.allocator_);
+                head_ = std::exchange(other.head_, nullptr);
+                tail_ = std::exchange(other.tail_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            /*!
+             * \brief Steal the content of \p other if the allocators are equal, move the values one by one otherwise.
+             * \param[in,out] other The UnrolledList to move from
+             *
+             * \warning The container must be empty.
+             */
+            void move_from(UnrolledList<T, N, Allocator> & other, std::false_type)
+            {
+                if(allocator_ == other.allocator_)
+                {
+                    head_ = std::exchange(other.head_, nullptr);
+                    tail_ = std::exchange(other.tail_, nullptr);
+                    size_ = std::exchange(other.size_, 0);
+                }
+                else
+                {
+                    for(Chunk * current = other.head_; current; current = current->next)
+                    {
+                        for(size_t i = 0; i < current->count; ++i)
+                            emplace_back(std::move(current->data()[i]));
+                    }
+                    other.clear();
+                }
+            }
+
+        public:
+            // Constructors
+            /*!
+             * \brief Default constructor.
+             *
+             * Creates an empty list.
+             */
+            UnrolledList() : head_(nullptr), tail_(nullptr), size_(0), allocator_()
+            {}
+            /*!
+             * \brief Allocator constructor.
+             * \param[in] alloc The allocator to get the chunks from
+             *
+             * Creates an empty list.
+             */
+            explicit UnrolledList(const Allocator & alloc) : head_(nullptr), tail_(nullptr), size_(0), allocator_(alloc)
+            {}
+            /*!
+             * \brief Copy constructor.
+             * \param[in] other The UnrolledList to copy
+             *
+             * \note The copy is packed: all its chunks but the last one are full.
+             */
+            UnrolledList(const UnrolledList<T, N, Allocator> & other) : head_(nullptr), tail_(nullptr), size_(0), allocator_(ChunkAllocatorTraits::select_on_container_copy_construction(other.allocator_))
+            {
+                for(Chunk * current = other.head_; current; current = current->next)
+                {
+                    for(size_t i = 0; i < current->count; ++i)
+                        emplace_back(current->data()[i]);
+                }
+            }
+            /*!
+             * \brief Move constructor.
+             * \param[in,out] other The UnrolledList to move from
+             *
+             * \note The moved UnrolledList will be left empty but still valid.
+             */
+            UnrolledList(UnrolledList<T, N, Allocator> && other) noexcept : head_{std::exchange(other.head_, nullptr)},
+                                                                            tail_{std::exchange(other.tail_, nullptr)},
+                                                                            size_{std::exchange(other.size_, 0)},
+                                                                            allocator_{std::move(other.allocator_)}
+            {}
+            /*!
+             * \brief Initialization constructor.
+             * \param[in] init_list An initializer list to copy
+             * \param[in] alloc The allocator to get the chunks from
+             */
+            UnrolledList(const std::initializer_list<T> & init_list, const Allocator & alloc = Allocator()) : head_(nullptr), tail_(nullptr), size_(0), allocator_(alloc)
+            {
+                for(const T & val : init_list)
+                    emplace_back(val);
+            }
+            ~UnrolledList()
+            {
+                clear();
+            }
+
+            /*!
+             * \brief Get the allocator.
+             * \return A copy of the allocator the chunks are obtained from
+             */
+            Allocator get_allocator() const
+            {
+                return Allocator(allocator_);
+            }
+
+            // Capacity
+            /*!
+             * \brief Get the size of the container.
+             * \return The size
+             */
+            size_t size() const
+            {
+                return size_;
+            }
+            /*!
+             * \brief Check if the container is empty.
+             * \return `true` if the list is empty, `false` otherwise
+             */
+            bool empty() const
+            {
+                return !head_;
+            }
+
+            // Element Access
+            /*!
+             * \brief Get the first element.
+             * \return A direct reference to the first value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & front()
+            {
+                return head_->data()[0];
+            }
+            /*!
+             * \brief Get the first element.
+             * \return A direct `const` reference to the first value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & front() const
+            {
+                return head_->data()[0];
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct reference to the last value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            T & back()
+            {
+                return tail_->data()[tail_->count-1];
+            }
+            /*!
+             * \brief Get the last element.
+             * \return A direct `const` reference to the last value
+             *
+             * \warning Never call this function on an empty container (Undefined Behaviour).
+             */
+            const T & back() const
+            {
+                return tail_->data()[tail_->count-1];
+            }
+            /*!
+             * \brief Access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A `const` reference to the element value at the given index
+             *
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
+             * \note Iterates over the chunks (from the closest end) until the index is reached. No direct access.
+             */
+            const T & operator[](size_t index) const
+            {
+                Chunk * chunk = locate(index);
+                return chunk->data()[index];
+            }
+            /*!
+             * \brief Access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A reference to the element value at the given index
+             *
+             * \warning Never call this function with an out-of-range index (Undefined Behaviour).
+             * \note Iterates over the chunks (from the closest end) until the index is reached. No direct access.
+             */
+            T & operator[](size_t index)
+            {
+                return const_cast<T&>(const_cast<const UnrolledList<T, N, Allocator> &>(*this)[index]);
+            }
+            /*!
+             * \brief Safely access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A `const` reference to the element value at the given index
+             *
+             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
+             * \note Iterates over the chunks (from the closest end) until the index is reached. No direct access.
+             */
+            const T & at(size_t index) const
+            {
+                if(index >= size_)
+                    throw std::out_of_range(std::string("[Out of range error] - manual::UnrolledList::at() - (index: ") + std::to_string(index) + ", size: " + std::to_string(size_) + ").");
+
+                return (*this)[index];
+            }
+            /*!
+             * \brief Safely access to an element by index.
+             * \param[in] index The position of the element to access
+             * \return A reference to the element value at the given index
+             *
+             * \throws std::out_of_range Automatically checks whether the index is within the bounds of the container.
+             * \note Iterates over the chunks (from the closest end) until the index is reached. No direct access.
+             */
+            T & at(size_t index)
+            {
+                return const_cast<T&>(const_cast<const UnrolledList<T, N, Allocator> &>(*this).at(index));
+            }
+
+            // Modifiers
+            /*!
+             * \brief Clear the container.
+             */
+            void clear()
+            {
+                Chunk * current = head_;
+                while(current)
+                {
+                    Chunk * tmp = current->next;
+                    destroy_chunk(current);
+                    current = tmp;
+                }
+                head_ = nullptr;
+                tail_ = nullptr;
+                size_ = 0;
+            }
+            /*!
+             * \brief Add a value at the end of the container.
+             * \param[in] val The value to append
+             */
+            void push_back(const T & val)
+            {
+                emplace_back(val);
+            }
+            /*!
+             * \brief Add a value at the end of the container.
+             * \param[in,out] val The value to append (moved)
+             */
+            void push_back(T && val)
+            {
+                emplace_back(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the end of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             *
+             * \note A new chunk is only allocated when the last one is full.
+             */
+            template <typename... Args>
+            T & emplace_back(Args &&... args)
+            {
+                if(!tail_ || tail_->count == N)
+                {
+                    Chunk * tmp = create_chunk();
+                    try
+                    {
+                        construct_value(tmp->data(), std::forward<Args>(args)...);
+                    }
+                    catch(...)
+                    {
+                        destroy_chunk(tmp);
+                        throw;
+                    }
+                    tmp->count = 1;
+                    link_chunk_after(tail_, tmp);
+                }
+                else
+                {
+                    construct_value(tail_->data() + tail_->count, std::forward<Args>(args)...);
+                    ++tail_->count;
+                }
+                ++size_;
+                return tail_->data()[tail_->count-1];
+            }
+            /*!
+             * \brief Add a value at the beginning of the container.
+             * \param[in] val The value to prepend
+             */
+            void push_front(const T & val)
+            {
+                emplace_front(val);
+            }
+            /*!
+             * \brief Add a value at the beginning of the container.
+             * \param[in,out] val The value to prepend (moved)
+             */
+            void push_front(T && val)
+            {
+                emplace_front(std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the beginning of the container.
+             * \param[in] args The arguments to construct the value from
+             * \return A reference to the new value
+             *
+             * \note The values of the first chunk are shifted, a new chunk is allocated when it is full.
+             */
+            template <typename... Args>
+            T & emplace_front(Args &&... args)
+            {
+                if(!head_ || head_->count == N)
+                {
+                    Chunk * tmp = create_chunk();
+                    try
+                    {
+                        construct_value(tmp->data(), std::forward<Args>(args)...);
+                    }
+                    catch(...)
+                    {
+                        destroy_chunk(tmp);
+                        throw;
+                    }
+                    tmp->count = 1;
+                    link_chunk_after(nullptr, tmp);
+                    ++size_;
+                    return head_->data()[0];
+                }
+                return *emplace_in(head_, 0, std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the last value of the container (if any).
+             */
+            void pop_back()
+            {
+                if(size_)
+                {
+                    destroy_value(tail_->data() + (tail_->count-1));
+                    --tail_->count;
+                    --size_;
+                    if(!tail_->count)
+                        erase_chunk(tail_);
+                }
+            }
+            /*!
+             * \brief Remove the first value of the container (if any).
+             *
+             * \note The other values of the first chunk are shifted.
+             */
+            void pop_front()
+            {
+                if(size_)
+                    erase_in(head_, 0);
+            }
+            /*!
+             * \brief Insert a value at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in] val The element to be inserted
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            void insert(size_t index, const T & val)
+            {
+                emplace(index, val);
+            }
+            /*!
+             * \brief Insert a value at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in,out] val The element to be inserted (moved)
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            void insert(size_t index, T && val)
+            {
+                emplace(index, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place at the specified index.
+             * \param[in] index The position where to insert the element
+             * \param[in] args The arguments to construct the value from
+             *
+             * \note Does nothing if the index exceeds the size value.
+             */
+            template <typename... Args>
+            void emplace(size_t index, Args &&... args)
+            {
+                if(index <= size_)
+                {
+                    if(index == 0)
+                    {
+                        emplace_front(std::forward<Args>(args)...);
+                    }
+                    else if(index == size_)
+                    {
+                        emplace_back(std::forward<Args>(args)...);
+                    }
+                    else
+                    {
+                        Chunk * chunk = locate(index);
+                        emplace_in(chunk, index, std::forward<Args>(args)...);
+                    }
+                }
+            }
+            /*!
+             * \brief Remove the element at the given index.
+             * \param[in] index The position of the element to remove
+             *
+             * \note Does nothing if the index is out-of-range or if the container is empty.
+             */
+            void remove(size_t index)
+            {
+                if(index < size_)
+                {
+                    Chunk * chunk = locate(index);
+                    erase_in(chunk, index);
+                }
+            }
+
+            // Operators
+            /*!
+             * \brief Copy assign new contents to the container (replacing the current contents).
+             * \param other An UnrolledList of the same type (to copy)
+             * \return A reference to `*this`
+             */
+            UnrolledList<T, N, Allocator> & operator=(const UnrolledList<T, N, Allocator> & other)
+            {
+                if(this != &other)
+                {
+                    clear();
+                    copy_allocator(other, typename ChunkAllocatorTraits::propagate_on_container_copy_assignment());
+                    for(Chunk * current = other.head_; current; current = current->next)
+                    {
+                        for(size_t i = 0; i < current->count; ++i)
+                            emplace_back(current->data()[i]);
+                    }
+                }
+                return *this;
+            }
+            /*!
+             * \brief Move assign new contents to the container (replacing the current contents).
+             * \param[in,out] other An UnrolledList of the same type (to move from)
+             * \return A reference to `*this`
+             *
+             * \note The moved UnrolledList will be left empty but still valid.
+             * \note If the allocator does not follow the moved content and both allocators are not equal, the values are moved one by one.
+             */
+            UnrolledList<T, N, Allocator> & operator=(UnrolledList<T, N, Allocator> && other) noexcept(ChunkAllocatorTraits::propagate_on_container_move_assignment::value)
+            {
+                if(this != &other)
+                {
+                    clear();
+                    move_from(other, typename ChunkAllocatorTraits::propagate_on_container_move_assignment());
+                }
+                return *this;
+            }
+
+            // Iterator
+            /*!
+             * \class Iterator
+             * \brief An iterator implementation.
+             */
+            class Iterator final
+            {
+                friend class UnrolledList;
+
+                private:
+                    Chunk * chunk;
+                    size_t index;
+                    const UnrolledList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another Iterator.
+                     * \param[in] last The Iterator to reach
+                     * \return The distance
+                     *
+                     * \note Whole chunks are counted at once.
+                     */
+                    std::ptrdiff_t distance_to(const Iterator & last) const
+                    {
+                        if(list && chunk == list->head_ && !index && !last.chunk)
+                            return static_cast<std::ptrdiff_t>(list->size_);
+                        if(chunk == last.chunk)
+                            return static_cast<std::ptrdiff_t>(last.index) - static_cast<std::ptrdiff_t>(index);
+
+                        size_t res = chunk->count - index;
+                        for(const Chunk * current = chunk->next; current != last.chunk; current = current->next)
+                            res += current->count;
+                        return static_cast<std::ptrdiff_t>(res + last.index);
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef T * pointer;                                       /*!< The pointer to a pointed value */
+                    typedef T & reference;                                     /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    Iterator() : chunk(nullptr), index(0), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] it The Iterator to copy
+                     */
+                    Iterator(const Iterator & it) : chunk(it.chunk), index(it.index), list(it.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The Iterator to copy
+                     * \return A reference to `*this`
+                     */
+                    Iterator & operator=(const Iterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            chunk = other.chunk;
+                            index = other.index;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return lhs.chunk == rhs.chunk && lhs.index == rhs.index;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const Iterator & lhs, const Iterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T & operator*() const
+                    {
+                        return chunk->data()[index];
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The address of the pointed value
+                     *
+                     * \note Dereference an out-of-range Iterator is Undefined Behaviour.
+                     */
+                    T * operator->() const
+                    {
+                        return chunk->data() + index;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator & operator++() //prefix
+                    {
+                        if(chunk && ++index == chunk->count)
+                        {
+                            chunk = chunk->next;
+                            index = 0;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment Iterator
+                     *
+                     * Shift to the next element.
+                     */
+                    Iterator operator++(int) //postfix
+                    {
+                        Iterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the Iterator `rhs` times.
+                     * \note Whole chunks are skipped at once.
+                     */
+                    Iterator & operator+=(size_t rhs)
+                    {
+                        while(chunk && index + rhs >= chunk->count)
+                        {
+                            rhs -= chunk->count - index;
+                            chunk = chunk->next;
+                            index = 0;
+                        }
+                        if(chunk)
+                            index += rhs;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend Iterator operator+(Iterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend Iterator operator+(size_t lhs, Iterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ Iterator of a container refers to its last element.
+                     */
+                    Iterator & operator--() //prefix
+                    {
+                        if(chunk)
+                        {
+                            if(index)
+                                --index;
+                            else
+                            {
+                                chunk = chunk->previous;
+                                index = chunk ? chunk->count-1 : 0;
+                            }
+                        }
+                        else if(list && list->tail_)
+                        {
+                            chunk = list->tail_;
+                            index = chunk->count-1;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement Iterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    Iterator operator--(int) //postfix
+                    {
+                        Iterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the Iterator `rhs` times.
+                     * \note Whole chunks are skipped at once.
+                     */
+                    Iterator & operator-=(size_t rhs)
+                    {
+                        if(!chunk && rhs && list && list->tail_)
+                        {
+                            chunk = list->tail_;
+                            index = chunk->count-1;
+                            --rhs;
+                        }
+                        while(chunk && rhs > index)
+                        {
+                            rhs -= index + 1;
+                            chunk = chunk->previous;
+                            index = chunk ? chunk->count-1 : 0;
+                        }
+                        if(chunk)
+                            index -= rhs;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend Iterator operator-(Iterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting Iterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend Iterator operator-(size_t lhs, Iterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first Iterator
+                     * \param[in] last The Iterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time and skips whole chunks otherwise.
+                     */
+                    friend difference_type distance(const Iterator & first, const Iterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+            /*!
+             * \class ConstIterator
+             * \brief A `const` iterator implementation.
+             */
+            class ConstIterator final
+            {
+                friend class UnrolledList;
+
+                private:
+                    Chunk * chunk;
+                    size_t index;
+                    const UnrolledList * list;
+
+                    /*!
+                     * \brief Get the number of increments to reach another ConstIterator.
+                     * \param[in] last The ConstIterator to reach
+                     * \return The distance
+                     *
+                     * \note Whole chunks are counted at once.
+                     */
+                    std::ptrdiff_t distance_to(const ConstIterator & last) const
+                    {
+                        if(list && chunk == list->head_ && !index && !last.chunk)
+                            return static_cast<std::ptrdiff_t>(list->size_);
+                        if(chunk == last.chunk)
+                            return static_cast<std::ptrdiff_t>(last.index) - static_cast<std::ptrdiff_t>(index);
+
+                        size_t res = chunk->count - index;
+                        for(const Chunk * current = chunk->next; current != last.chunk; current = current->next)
+                            res += current->count;
+                        return static_cast<std::ptrdiff_t>(res + last.index);
+                    }
+
+                public:
+                    typedef std::bidirectional_iterator_tag iterator_category; /*!< The iterator category */
+                    typedef T value_type;                                      /*!< The type of the pointed values */
+                    typedef std::ptrdiff_t difference_type;                    /*!< The type of the distance between two iterators */
+                    typedef const T * pointer;                                 /*!< The pointer to a pointed value */
+                    typedef const T & reference;                               /*!< The reference to a pointed value */
+
+                    /*!
+                     * \brief Default constructor.
+                     *
+                     * \warning Should not be dereferenced (Undefined Behaviour).
+                     */
+                    ConstIterator() : chunk(nullptr), index(0), list(nullptr)
+                    {}
+                    /*!
+                     * \brief Copy constructor.
+                     * \param[in] cit The ConstIterator to copy
+                     */
+                    ConstIterator(const ConstIterator & cit) : chunk(cit.chunk), index(cit.index), list(cit.list)
+                    {}
+                    /*!
+                     * \brief Assignment operator.
+                     * \param[in] other The ConstIterator to copy
+                     * \return A reference to `*this`
+                     */
+                    ConstIterator & operator=(const ConstIterator & other)
+                    {
+                        if(this != &other)
+                        {
+                            chunk = other.chunk;
+                            index = other.index;
+                            list = other.list;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Equality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if equality, `false` otherwise
+                     */
+                    friend bool operator==(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return lhs.chunk == rhs.chunk && lhs.index == rhs.index;
+                    }
+                    /*!
+                     * \brief Inequality operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return `true` if inequality, `false` otherwise
+                     */
+                    friend bool operator!=(const ConstIterator & lhs, const ConstIterator & rhs)
+                    {
+                        return !(lhs == rhs);
+                    }
+                    /*!
+                     * \brief Indirection (dereference) operator.
+                     * \return A `const` reference to the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T & operator*() const
+                    {
+                        return chunk->data()[index];
+                    }
+                    /*!
+                     * \brief Member of pointer (dereference) operator.
+                     * \return The `const` address of the pointed value
+                     *
+                     * \note Dereference an out-of-range ConstIterator is Undefined Behaviour.
+                     */
+                    const T * operator->() const
+                    {
+                        return chunk->data() + index;
+                    }
+                    /*!
+                     * \brief Prefix increment operator.
+                     * \return A reference to the incremented `*this`
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator & operator++() //prefix
+                    {
+                        if(chunk && ++index == chunk->count)
+                        {
+                            chunk = chunk->next;
+                            index = 0;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix increment operator.
+                     * \return The before-increment ConstIterator
+                     *
+                     * Shift to the next element.
+                     */
+                    ConstIterator operator++(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        ++(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Addition assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Increment the ConstIterator `rhs` times.
+                     * \note Whole chunks are skipped at once.
+                     */
+                    ConstIterator & operator+=(size_t rhs)
+                    {
+                        while(chunk && index + rhs >= chunk->count)
+                        {
+                            rhs -= chunk->count - index;
+                            chunk = chunk->next;
+                            index = 0;
+                        }
+                        if(chunk)
+                            index += rhs;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `lhs` by `rhs`.
+                     */
+                    friend ConstIterator operator+(ConstIterator lhs, size_t rhs)
+                    {
+                        lhs += rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Addition operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Increment `rhs` by `lhs`.
+                     */
+                    friend ConstIterator operator+(size_t lhs, ConstIterator rhs)
+                    {
+                        return rhs + lhs;
+                    }
+                    /*!
+                     * \brief Prefix decrement operator.
+                     * \return A reference to the decremented `*this`
+                     *
+                     * Shift to the previous element.
+                     *
+                     * \note Decrementing the _past-the-end_ ConstIterator of a container refers to its last element.
+                     */
+                    ConstIterator & operator--() //prefix
+                    {
+                        if(chunk)
+                        {
+                            if(index)
+                                --index;
+                            else
+                            {
+                                chunk = chunk->previous;
+                                index = chunk ? chunk->count-1 : 0;
+                            }
+                        }
+                        else if(list && list->tail_)
+                        {
+                            chunk = list->tail_;
+                            index = chunk->count-1;
+                        }
+                        return *this;
+                    }
+                    /*!
+                     * \brief Postfix decrement operator.
+                     * \return The before-decrement ConstIterator
+                     *
+                     * Shift to the previous element.
+                     */
+                    ConstIterator operator--(int) //postfix
+                    {
+                        ConstIterator tmp(*this);
+                        --(*this);
+                        return tmp;
+                    }
+                    /*!
+                     * \brief Subtraction assignment operator.
+                     * \param[in] rhs The right-hand side
+                     * \return A reference to `*this`
+                     *
+                     * Decrement the ConstIterator `rhs` times.
+                     * \note Whole chunks are skipped at once.
+                     */
+                    ConstIterator & operator-=(size_t rhs)
+                    {
+                        if(!chunk && rhs && list && list->tail_)
+                        {
+                            chunk = list->tail_;
+                            index = chunk->count-1;
+                            --rhs;
+                        }
+                        while(chunk && rhs > index)
+                        {
+                            rhs -= index + 1;
+                            chunk = chunk->previous;
+                            index = chunk ? chunk->count-1 : 0;
+                        }
+                        if(chunk)
+                            index -= rhs;
+                        return *this;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Decrement `lhs` by `rhs`.
+                     */
+                    friend ConstIterator operator-(ConstIterator lhs, size_t rhs)
+                    {
+                        lhs -= rhs;
+                        return lhs;
+                    }
+                    /*!
+                     * \brief Subtraction operator.
+                     * \param[in] lhs The left-hand side
+                     * \param[in] rhs The right-hand side
+                     * \return The resulting ConstIterator
+                     *
+                     * Decrement `rhs` by `lhs`.
+                     */
+                    friend ConstIterator operator-(size_t lhs, ConstIterator rhs)
+                    {
+                        return rhs - lhs;
+                    }
+                    /*!
+                     * \brief Get the number of increments from \p first to \p last.
+                     * \param[in] first The first ConstIterator
+                     * \param[in] last The ConstIterator to reach (reachable from \p first)
+                     * \return The distance between \p first and \p last
+                     *
+                     * \note Found by argument-dependent lookup: an unqualified call (`using std::distance; distance(first, last);`) measures the whole range in constant time and skips whole chunks otherwise.
+                     */
+                    friend difference_type distance(const ConstIterator & first, const ConstIterator & last)
+                    {
+                        return first.distance_to(last);
+                    }
+            };
+
+            // Standard container types
+            typedef T value_type;                   /*!< The type of the elements */
+            typedef T & reference;                  /*!< The reference to an element */
+            typedef const T & const_reference;      /*!< The `const` reference to an element */
+            typedef size_t size_type;               /*!< The type of the sizes and indexes */
+            typedef std::ptrdiff_t difference_type; /*!< The type of the distance between two iterators */
+            typedef Iterator iterator;              /*!< The iterator type */
+            typedef ConstIterator const_iterator;   /*!< The `const` iterator type */
+            typedef Allocator allocator_type;       /*!< The allocator type */
+
+            /*!
+             * \brief Get an iterator referring to the first element.
+             * \return An iterator
+             */
+            Iterator begin()
+            {
+                Iterator it;
+                it.chunk = head_;
+                it.index = 0;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get an iterator referring to the _past-the-end_ element.
+             * \return An iterator
+             */
+            Iterator end()
+            {
+                Iterator it;
+                it.chunk = nullptr;
+                it.index = 0;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator cbegin() const
+            {
+                ConstIterator cit;
+                cit.chunk = head_;
+                cit.index = 0;
+                cit.list = this;
+                return cit;
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator cend() const
+            {
+                ConstIterator cit;
+                cit.chunk = nullptr;
+                cit.index = 0;
+                cit.list = this;
+                return cit;
+            }
+            //extras
+            /*!
+             * \brief Get a `const` iterator referring to the first element.
+             * \return A `const` iterator
+             */
+            ConstIterator begin() const
+            {
+                return cbegin();
+            }
+            /*!
+             * \brief Get a `const` iterator referring to the _past-the-end_ element.
+             * \return A `const` iterator
+             */
+            ConstIterator end() const
+            {
+                return cend();
+            }
+
+            // Iterator-based modifiers
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element preceding which to insert (can be end())
+             * \param[in] val The element to be inserted
+             * \return An iterator to the inserted element
+             *
+             * \note Invalidates the iterators to the elements of the chunk holding \p pos.
+             */
+            Iterator insert(ConstIterator pos, const T & val)
+            {
+                return emplace(pos, val);
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element preceding which to insert (can be end())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator to the inserted element
+             *
+             * \note Invalidates the iterators to the elements of the chunk holding \p pos.
+             */
+            Iterator insert(ConstIterator pos, T && val)
+            {
+                return emplace(pos, std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position.
+             * \param[in] pos The element preceding which to insert (can be end())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator to the inserted element
+             *
+             * \note Invalidates the iterators to the elements of the chunk holding \p pos.
+             */
+            template <typename... Args>
+            Iterator emplace(ConstIterator pos, Args &&... args)
+            {
+                if(!pos.chunk)
+                {
+                    emplace_back(std::forward<Args>(args)...);
+                    Iterator it;
+                    it.chunk = tail_;
+                    it.index = tail_->count-1;
+                    it.list = this;
+                    return it;
+                }
+                return emplace_in(pos.chunk, pos.index, std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove (must be dereferenceable)
+             * \return An iterator to the element following the removed one
+             *
+             * \note Invalidates the iterators to the elements of the chunk holding \p pos (and of the next chunk).
+             */
+            Iterator erase(ConstIterator pos)
+            {
+                return erase_in(pos.chunk, pos.index);
+            }
+            /*!
+             * \brief Remove the elements in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove
+             * \return An iterator to the element following the last removed one
+             *
+             * \note The range is measured first (chunk by chunk), since \p last may be moved by the removals.
+             */
+            Iterator erase(ConstIterator first, ConstIterator last)
+            {
+                size_t count = static_cast<size_t>(first.distance_to(last));
+
+                Iterator it;
+                it.chunk = first.chunk;
+                it.index = first.index;
+                it.list = this;
+                for(size_t i = 0; i < count; ++i)
+                    it = erase_in(it.chunk, it.index);
+                return it;
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element preceding which to insert (can be end())
+             * \param[in] val The element to be inserted
+             * \return An iterator to the inserted element
+             */
+            Iterator insert(Iterator pos, const T & val)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), val);
+            }
+            /*!
+             * \brief Insert a value before the given position.
+             * \param[in] pos The element preceding which to insert (can be end())
+             * \param[in,out] val The element to be inserted (moved)
+             * \return An iterator to the inserted element
+             */
+            Iterator insert(Iterator pos, T && val)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), std::move(val));
+            }
+            /*!
+             * \brief Construct a value in place before the given position.
+             * \param[in] pos The element preceding which to insert (can be end())
+             * \param[in] args The arguments to construct the value from
+             * \return An iterator to the inserted element
+             */
+            template <typename... Args>
+            Iterator emplace(Iterator pos, Args &&... args)
+            {
+                return emplace(iterator_cast<ConstIterator>(pos), std::forward<Args>(args)...);
+            }
+            /*!
+             * \brief Remove the element at the given position.
+             * \param[in] pos The element to remove (must be dereferenceable)
+             * \return An iterator to the element following the removed one
+             */
+            Iterator erase(Iterator pos)
+            {
+                return erase(iterator_cast<ConstIterator>(pos));
+            }
+            /*!
+             * \brief Remove the elements in the range [first, last).
+             * \param[in] first The first element to remove
+             * \param[in] last The element following the last one to remove
+             * \return An iterator to the element following the last removed one
+             */
+            Iterator erase(Iterator first, Iterator last)
+            {
+                return erase(iterator_cast<ConstIterator>(first), iterator_cast<ConstIterator>(last));
+            }
+
+            // Lookup
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return An iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time, each chunk is scanned at once (with SIMD comparisons for arithmetic types when available, see ScanKernel).
+             */
+            Iterator find(const T & val)
+            {
+                ConstIterator cit = static_cast<const UnrolledList &>(*this).find(val);
+                Iterator it;
+                it.chunk = cit.chunk;
+                it.index = cit.index;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Find the first element equal to a value.
+             * \param[in] val The value to look for
+             * \return A `const` iterator referring to the first element equal to \p val, end() if there is none
+             *
+             * \note Linear time, each chunk is scanned at once (with SIMD comparisons for arithmetic types when available, see ScanKernel).
+             */
+            ConstIterator find(const T & val) const
+            {
+                ConstIterator cit;
+                cit.list = this;
+                for(cit.chunk = head_; cit.chunk; cit.chunk = cit.chunk->next)
+                {
+                    cit.index = ScanKernel<T>::find(cit.chunk->data(), cit.chunk->count, val);
+                    if(cit.index < cit.chunk->count)
+                        return cit;
+                }
+                cit.index = 0;
+                return cit;
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return An iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            Iterator find_if(UnaryPredicate pred)
+            {
+                ConstIterator cit = static_cast<const UnrolledList &>(*this).find_if(pred);
+                Iterator it;
+                it.chunk = cit.chunk;
+                it.index = cit.index;
+                it.list = this;
+                return it;
+            }
+            /*!
+             * \brief Find the first element satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return A `const` iterator referring to the first element satisfying \p pred, end() if there is none
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            ConstIterator find_if(UnaryPredicate pred) const
+            {
+                ConstIterator cit;
+                cit.list = this;
+                for(cit.chunk = head_; cit.chunk; cit.chunk = cit.chunk->next)
+                {
+                    const T * values = cit.chunk->data();
+                    for(cit.index = 0; cit.index < cit.chunk->count; ++cit.index)
+                    {
+                        if(pred(values[cit.index]))
+                            return cit;
+                    }
+                }
+                cit.index = 0;
+                return cit;
+            }
+            /*!
+             * \brief Check if an element is equal to a value.
+             * \param[in] val The value to look for
+             * \return `true` if an element is equal to \p val, `false` otherwise
+             *
+             * \note Linear time.
+             */
+            bool contains(const T & val) const
+            {
+                return find(val).chunk != nullptr;
+            }
+            /*!
+             * \brief Count the elements equal to a value.
+             * \param[in] val The value to look for
+             * \return The number of elements equal to \p val
+             *
+             * \note Linear time, each chunk is scanned at once (with SIMD comparisons for arithmetic types when available, see ScanKernel).
+             */
+            size_t count(const T & val) const
+            {
+                size_t res = 0;
+                for(const Chunk * current = head_; current; current = current->next)
+                    res += ScanKernel<T>::count(current->data(), current->count, val);
+                return res;
+            }
+            /*!
+             * \brief Count the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of elements satisfying \p pred
+             *
+             * \note Linear time.
+             */
+            template <typename UnaryPredicate>
+            size_t count_if(UnaryPredicate pred) const
+            {
+                size_t res = 0;
+                for(const Chunk * current = head_; current; current = current->next)
+                {
+                    const T * values = current->data();
+                    for(size_t i = 0; i < current->count; ++i)
+                    {
+                        if(pred(values[i]))
+                            ++res;
+                    }
+                }
+                return res;
+            }
+
+            // Operations
+            /*!
+             * \brief Remove the elements satisfying a predicate.
+             * \param[in] pred The predicate
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass: the kept values of each chunk are compacted in place,
+             * a chunk left empty is destroyed and a chunk absorbs the next one if they fit and either is less than half full.
+             * If \p pred throws, the elements already removed stay removed.
+             */
+            template <typename UnaryPredicate>
+            size_t remove_if(UnaryPredicate pred)
+            {
+                const size_t old_size = size_;
+                for(Chunk * current = head_; current;)
+                {
+                    T * values = current->data();
+                    size_t kept = 0;
+                    size_t i = 0;
+                    try
+                    {
+                        for(; i < current->count; ++i)
+                        {
+                            if(pred(values[i]))
+                                destroy_value(values + i);
+                            else
+                            {
+                                if(kept != i)
+                                    relocate(values + kept, values + i);
+                                ++kept;
+                            }
+                        }
+                    }
+                    catch(...)
+                    {
+                        close_gap(current, kept, i);
+                        if(!current->count)
+                            erase_chunk(current);
+                        throw;
+                    }
+                    close_gap(current, kept, i);
+
+                    Chunk * next = current->next;
+                    Chunk * previous = current->previous;
+                    if(!current->count)
+                        erase_chunk(current);
+                    else if(previous && (previous->count < N / 2 || current->count < N / 2) && previous->count + current->count <= N)
+                    {
+                        for(size_t j = 0; j < current->count; ++j)
+                            relocate(previous->data() + previous->count + j, values + j);
+                        previous->count += current->count;
+                        current->count = 0;
+                        erase_chunk(current);
+                    }
+                    current = next;
+                }
+                return old_size - size_;
+            }
+            /*!
+             * \brief Remove the elements equal to a value.
+             * \param[in] val The value to remove
+             * \return The number of removed elements
+             *
+             * \note Linear time, in a single pass. (erase() removes by position.)
+             * If \p val is an element of the container, it is copied first (the values are moved within the chunks): the chunks are walked to find it.
+             */
+            size_t remove_value(const T & val)
+            {
+                const T * address = std::addressof(val);
+                for(const Chunk * current = head_; current; current = current->next)
+                {
+                    if(!std::less<const T*>()(address, current->data()) && std::less<const T*>()(address, current->data() + current->count))
+                    {
+                        const T tmp(val);
+                        return remove_if([&tmp](const T & value){ return value == tmp; });
+                    }
+                }
+                return remove_if([&val](const T & value){ return value == val; });
+            }
+
+            // Iterator conversions
+            /*!
+             * \brief Iterator conversion.
+             * \param[in] it An Iterator to convert
+             * \return The converted iterator
+             *
+             * \note An Iterator can only be casted into an Iterator or a ConstIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const Iterator & it)
+            {
+                static_assert((std::is_same<IT_type, Iterator>::value || std::is_same<IT_type, ConstIterator>::value), "manual::UnrolledList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.chunk = it.chunk;
+                res.index = it.index;
+                res.list = it.list;
+                return res;
+            }
+            /*!
+             * \brief ConstIterator conversion.
+             * \param[in] cit A ConstIterator to convert
+             * \return The converted iterator
+             *
+             * \note A ConstIterator can only be casted into a ConstIterator.
+             */
+            template <typename IT_type>
+            static IT_type iterator_cast(const ConstIterator & cit)
+            {
+                static_assert((std::is_same<IT_type, ConstIterator>::value), "manual::UnrolledList::iterator_cast - Forbidden template type provided.");
+
+                IT_type res;
+                res.chunk = cit.chunk;
+                res.index = cit.index;
+                res.list = cit.list;
+                return res;
+            }
+    };
+
+#ifdef MANUAL_HAS_PMR
+    namespace pmr
+    {
+        template <typename T, size_t N = unrolled_chunk_size<T>()> using UnrolledList = manual::UnrolledList<T, N, std::pmr::polymorphic_allocator<T>>; /*!< UnrolledList using a `std::pmr::memory_resource` */
+    }
+#endif
+
+#ifdef __cpp_lib_ranges
+    // The container models the standard range concepts (C++20)
+    static_assert(std::ranges::bidirectional_range<UnrolledList<int>> && std::ranges::sized_range<UnrolledList<int>>, "manual::UnrolledList - Not a bidirectional_range.");
+    static_assert(std::ranges::bidirectional_range<const UnrolledList<int>>, "manual::UnrolledList - Not a `const` bidirectional_range.");
+#endif
+}
+
+#endif // MANUAL_UNROLLEDLIST_H